@@ -0,0 +1,133 @@
+// Measures the delay between a container being committed by the data
+// transfer thread and it being returned by a blocking data get call,
+// comparing polling (1ms sleeps) against producer notification.
+
+#include "data_exchange.h"
+#include "portable_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CONTAINERS_NUMBER 2000
+#define COMMIT_INTERVAL_US 500
+
+struct latency_run {
+	struct data_exchange dataExchange;
+	atomic_uint_fast32_t transfersRunning;
+	int64_t commitTimes[CONTAINERS_NUMBER];
+};
+
+static int64_t monotonicNs(void) {
+	struct timespec time;
+	portable_clock_gettime_monotonic(&time);
+
+	return ((I64T(time.tv_sec) * 1000000000LL) + I64T(time.tv_nsec));
+}
+
+static int producerThread(void *runPtr) {
+	struct latency_run *run = runPtr;
+
+	for (size_t i = 0; i < CONTAINERS_NUMBER; i++) {
+		thrd_sleep(COMMIT_INTERVAL_US);
+
+		caerEventPacketContainer container = caerEventPacketContainerAllocate(1);
+
+		run->commitTimes[i] = monotonicNs();
+
+		dataExchangePutForce(&run->dataExchange, &run->transfersRunning, container);
+	}
+
+	return (EXIT_SUCCESS);
+}
+
+static int compareInt64(const void *a, const void *b) {
+	const int64_t aa = *((const int64_t *) a);
+	const int64_t bb = *((const int64_t *) b);
+
+	return ((aa > bb) - (aa < bb));
+}
+
+static bool runLatency(bool blockingNotify, const char *modeName) {
+	struct latency_run *run = calloc(1, sizeof(struct latency_run));
+	if (run == NULL) {
+		return (false);
+	}
+
+	int64_t *latencies = calloc(CONTAINERS_NUMBER, sizeof(int64_t));
+	if (latencies == NULL) {
+		free(run);
+		return (false);
+	}
+
+	dataExchangeSettingsInit(&run->dataExchange);
+	dataExchangeConfigSet(&run->dataExchange, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING, true);
+	dataExchangeConfigSet(&run->dataExchange, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_NOTIFY, blockingNotify);
+
+	if (!dataExchangeBufferInit(&run->dataExchange)) {
+		free(latencies);
+		free(run);
+		return (false);
+	}
+
+	atomic_store(&run->transfersRunning, THR_RUNNING);
+
+	thrd_t producer;
+	if (thrd_create(&producer, &producerThread, run) != thrd_success) {
+		dataExchangeDestroy(&run->dataExchange);
+		free(latencies);
+		free(run);
+		return (false);
+	}
+
+	size_t received = 0;
+
+	while (received < CONTAINERS_NUMBER) {
+		caerEventPacketContainer container = dataExchangeGet(&run->dataExchange, &run->transfersRunning);
+		if (container == NULL) {
+			continue;
+		}
+
+		int64_t now = monotonicNs();
+
+		// Containers are delivered in FIFO order.
+		latencies[received] = now - run->commitTimes[received];
+		received++;
+
+		caerEventPacketContainerFree(container);
+	}
+
+	thrd_join(producer, NULL);
+
+	qsort(latencies, CONTAINERS_NUMBER, sizeof(int64_t), &compareInt64);
+
+	int64_t sum = 0;
+	for (size_t i = 0; i < CONTAINERS_NUMBER; i++) {
+		sum += latencies[i];
+	}
+
+	printf("%-8s containers: %d, mean: %8.2f us, p50: %8.2f us, p99: %8.2f us, max: %8.2f us\n", modeName,
+		CONTAINERS_NUMBER, ((double) sum / CONTAINERS_NUMBER) / 1000.0,
+		(double) latencies[CONTAINERS_NUMBER / 2] / 1000.0, (double) latencies[(CONTAINERS_NUMBER * 99) / 100] / 1000.0,
+		(double) latencies[CONTAINERS_NUMBER - 1] / 1000.0);
+
+	dataExchangeDestroy(&run->dataExchange);
+	free(latencies);
+	free(run);
+
+	return (true);
+}
+
+int main(void) {
+	printf("Commit to data get latency, one container every %d us.\n", COMMIT_INTERVAL_US);
+
+	if (!runLatency(false, "polling")) {
+		return (EXIT_FAILURE);
+	}
+
+	if (!runLatency(true, "notify")) {
+		return (EXIT_FAILURE);
+	}
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,295 @@
+// Measures the throughput of the DVS correlation filter kernels, on synthetic
+// polarity streams for several sensor sizes, and compares them with the DVS
+// noise filter's Background-Activity filter. Reports, as JSON, the fraction of
+// events each one filters out, and how often it decides like the noise filter.
+// The lattice kernel without sub-sampling must decide exactly like it.
+
+#include "libcaer/filters/dvs_correlation.h"
+#include "libcaer/filters/dvs_noise.h"
+#include "portable_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PACKET_EVENTS     100000
+#define PACKETS_NUMBER    20
+#define RUNS_NUMBER       3
+#define CORRELATION_TIME  2000
+#define TIMESTAMP_INITIAL 0
+
+struct sensor_size {
+	const char *name;
+	uint16_t sizeX;
+	uint16_t sizeY;
+};
+
+static const struct sensor_size sensorSizes[] = {
+	{"346x260", 346, 260},
+	{"640x480", 640, 480},
+	{"1280x720", 1280, 720},
+};
+
+struct filter_variant {
+	const char *name;
+	// Else the DVS noise filter's Background-Activity filter.
+	bool correlation;
+	uint8_t kernel;
+	uint8_t subsample;
+};
+
+static const struct filter_variant filterVariants[] = {
+	{"noise_background_activity", false, 0, 0},
+	{"correlation_row_column", true, CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN, 0},
+	{"correlation_nearest_time", true, CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME, 0},
+	{"correlation_lattice_1x1", true, CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE, 0},
+	{"correlation_lattice_2x2", true, CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE, 1},
+	{"correlation_lattice_4x4", true, CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE, 2},
+};
+
+static int64_t monotonicNs(void) {
+	struct timespec time;
+	portable_clock_gettime_monotonic(&time);
+
+	return ((I64T(time.tv_sec) * 1000000000LL) + I64T(time.tv_nsec));
+}
+
+static uint32_t xorshift32(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+
+	*state = x;
+	return (x);
+}
+
+// Mostly correlated activity, two edges sweeping the sensor, plus uniform background noise.
+// Timestamps start at zero, so that events are also supported by the filters' initial,
+// zero, timestamps.
+static caerPolarityEventPacket *streamGenerate(const struct sensor_size *sensor) {
+	caerPolarityEventPacket *packets = calloc(PACKETS_NUMBER, sizeof(caerPolarityEventPacket));
+	if (packets == NULL) {
+		return (NULL);
+	}
+
+	uint32_t random   = 0x12345678;
+	int32_t timestamp = TIMESTAMP_INITIAL;
+
+	for (size_t i = 0; i < PACKETS_NUMBER; i++) {
+		packets[i] = caerPolarityEventPacketAllocate(PACKET_EVENTS, 1, 0);
+		if (packets[i] == NULL) {
+			for (size_t j = 0; j < i; j++) {
+				caerEventPacketFree((caerEventPacketHeader) packets[j]);
+			}
+
+			free(packets);
+			return (NULL);
+		}
+
+		for (int32_t j = 0; j < PACKET_EVENTS; j++) {
+			uint32_t value = xorshift32(&random);
+			uint16_t x;
+			uint16_t y;
+
+			timestamp += I32T(value & 0x01);
+
+			if ((value % 4) == 0) {
+				x = U16T((value >> 8) % sensor->sizeX);
+				y = U16T((value >> 20) % sensor->sizeY);
+			}
+			else if ((value % 4) == 1) {
+				x = U16T((U32T(timestamp / 20) + ((value >> 8) % 3)) % sensor->sizeX);
+				y = U16T((value >> 12) % sensor->sizeY);
+			}
+			else {
+				x = U16T((value >> 12) % sensor->sizeX);
+				y = U16T((U32T(timestamp / 15) + ((value >> 8) % 3)) % sensor->sizeY);
+			}
+
+			caerPolarityEvent event = caerPolarityEventPacketGetEvent(packets[i], j);
+
+			caerPolarityEventSetTimestamp(event, timestamp);
+			caerPolarityEventSetX(event, x);
+			caerPolarityEventSetY(event, y);
+			caerPolarityEventSetPolarity(event, (value >> 31) != 0);
+			caerPolarityEventValidate(event, packets[i]);
+		}
+	}
+
+	return (packets);
+}
+
+// Filter a copy of the stream with the given filter, storing the validity of every event.
+static bool runFilter(const struct sensor_size *sensor, const struct filter_variant *variant,
+	caerPolarityEventPacket *packets, double *nsPerEvent, uint8_t *valid) {
+	caerFilterDVSNoise noiseFilter             = NULL;
+	caerFilterDVSCorrelation correlationFilter = NULL;
+
+	if (variant->correlation) {
+		correlationFilter = caerFilterDVSCorrelationInitialize(sensor->sizeX, sensor->sizeY);
+		if (correlationFilter == NULL) {
+			return (false);
+		}
+
+		if (!caerFilterDVSCorrelationConfigSet(correlationFilter, CAER_FILTER_DVS_CORRELATION_KERNEL, variant->kernel)
+			|| !caerFilterDVSCorrelationConfigSet(
+				correlationFilter, CAER_FILTER_DVS_CORRELATION_SUBSAMPLE, variant->subsample)) {
+			caerFilterDVSCorrelationDestroy(correlationFilter);
+			return (false);
+		}
+
+		caerFilterDVSCorrelationConfigSet(correlationFilter, CAER_FILTER_DVS_CORRELATION_TIME, CORRELATION_TIME);
+	}
+	else {
+		noiseFilter = caerFilterDVSNoiseInitialize(sensor->sizeX, sensor->sizeY);
+		if (noiseFilter == NULL) {
+			return (false);
+		}
+
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_ENABLE, true);
+		caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TIME, CORRELATION_TIME);
+	}
+
+	int64_t filterTime = 0;
+	bool success       = true;
+
+	for (size_t i = 0; i < PACKETS_NUMBER; i++) {
+		caerPolarityEventPacket packet
+			= (caerPolarityEventPacket) caerEventPacketCopy((caerEventPacketHeader) packets[i]);
+		if (packet == NULL) {
+			success = false;
+			break;
+		}
+
+		int64_t startTime = monotonicNs();
+
+		if (variant->correlation) {
+			caerFilterDVSCorrelationApply(correlationFilter, packet);
+		}
+		else {
+			caerFilterDVSNoiseApply(noiseFilter, packet);
+		}
+
+		filterTime += monotonicNs() - startTime;
+
+		for (int32_t j = 0; j < PACKET_EVENTS; j++) {
+			valid[(i * PACKET_EVENTS) + (size_t) j]
+				= caerPolarityEventIsValid(caerPolarityEventPacketGetEventConst(packet, j));
+		}
+
+		caerEventPacketFree((caerEventPacketHeader) packet);
+	}
+
+	if (variant->correlation) {
+		caerFilterDVSCorrelationDestroy(correlationFilter);
+	}
+	else {
+		caerFilterDVSNoiseDestroy(noiseFilter);
+	}
+
+	*nsPerEvent = (double) filterTime / (double) (PACKETS_NUMBER * PACKET_EVENTS);
+
+	return (success);
+}
+
+// Best of RUNS_NUMBER runs, their results must all be the same.
+static bool runFilterBest(const struct sensor_size *sensor, const struct filter_variant *variant,
+	caerPolarityEventPacket *packets, double *nsPerEvent, uint8_t *valid, uint8_t *runValid) {
+	for (size_t i = 0; i < RUNS_NUMBER; i++) {
+		double runNsPerEvent;
+
+		if (!runFilter(sensor, variant, packets, &runNsPerEvent, (i == 0) ? (valid) : (runValid))) {
+			return (false);
+		}
+
+		if ((i != 0) && (memcmp(valid, runValid, PACKETS_NUMBER * PACKET_EVENTS) != 0)) {
+			return (false);
+		}
+
+		if ((i == 0) || (runNsPerEvent < *nsPerEvent)) {
+			*nsPerEvent = runNsPerEvent;
+		}
+	}
+
+	return (true);
+}
+
+int main(void) {
+	bool allMatch = true;
+
+	uint8_t *referenceValid = malloc(PACKETS_NUMBER * PACKET_EVENTS);
+	uint8_t *valid          = malloc(PACKETS_NUMBER * PACKET_EVENTS);
+	uint8_t *runValid       = malloc(PACKETS_NUMBER * PACKET_EVENTS);
+	if ((referenceValid == NULL) || (valid == NULL) || (runValid == NULL)) {
+		fprintf(stderr, "Failed to allocate memory for event validity.\n");
+		return (EXIT_FAILURE);
+	}
+
+	printf("{\n\t\"benchmark\": \"filter_dvs_correlation_throughput\",\n\t\"packetEvents\": %d,\n\t\"packets\": %d,\n"
+		   "\t\"correlationTime\": %d,\n\t\"results\": [\n",
+		PACKET_EVENTS, PACKETS_NUMBER, CORRELATION_TIME);
+
+	for (size_t i = 0; i < (sizeof(sensorSizes) / sizeof(sensorSizes[0])); i++) {
+		caerPolarityEventPacket *packets = streamGenerate(&sensorSizes[i]);
+		if (packets == NULL) {
+			fprintf(stderr, "Failed to generate synthetic %s stream.\n", sensorSizes[i].name);
+			return (EXIT_FAILURE);
+		}
+
+		double referenceNsPerEvent = 0;
+
+		// The first variant is the noise filter, the reference for all others.
+		for (size_t j = 0; j < (sizeof(filterVariants) / sizeof(filterVariants[0])); j++) {
+			double nsPerEvent = 0;
+
+			if (!runFilterBest(&sensorSizes[i], &filterVariants[j], packets, &nsPerEvent,
+					(j == 0) ? (referenceValid) : (valid), runValid)) {
+				fprintf(stderr, "Failed to filter synthetic %s stream with %s.\n", sensorSizes[i].name,
+					filterVariants[j].name);
+				return (EXIT_FAILURE);
+			}
+
+			if (j == 0) {
+				referenceNsPerEvent = nsPerEvent;
+				memcpy(valid, referenceValid, PACKETS_NUMBER * PACKET_EVENTS);
+			}
+
+			size_t filtered = 0;
+			size_t agreed   = 0;
+
+			for (size_t k = 0; k < (PACKETS_NUMBER * PACKET_EVENTS); k++) {
+				filtered += (valid[k] == 0) ? (1) : (0);
+				agreed += (valid[k] == referenceValid[k]) ? (1) : (0);
+			}
+
+			if (filterVariants[j].correlation
+				&& (filterVariants[j].kernel == CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE)
+				&& (filterVariants[j].subsample == 0) && (agreed != (PACKETS_NUMBER * PACKET_EVENTS))) {
+				allMatch = false;
+			}
+
+			printf("%s\t\t{\"sensor\": \"%s\", \"filter\": \"%s\", \"eventsPerSecond\": %.4e, \"nsPerEvent\": %.2f, "
+				   "\"speedup\": %.2f, \"filtered\": %.4f, \"agreement\": %.4f}",
+				((i == 0) && (j == 0)) ? ("") : (",\n"), sensorSizes[i].name, filterVariants[j].name,
+				1.0e9 / nsPerEvent, nsPerEvent, referenceNsPerEvent / nsPerEvent,
+				(double) filtered / (double) (PACKETS_NUMBER * PACKET_EVENTS),
+				(double) agreed / (double) (PACKETS_NUMBER * PACKET_EVENTS));
+		}
+
+		for (size_t j = 0; j < PACKETS_NUMBER; j++) {
+			caerEventPacketFree((caerEventPacketHeader) packets[j]);
+		}
+
+		free(packets);
+	}
+
+	printf("\n\t]\n}\n");
+
+	free(referenceValid);
+	free(valid);
+	free(runValid);
+
+	return ((allMatch) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
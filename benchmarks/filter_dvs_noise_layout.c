@@ -0,0 +1,313 @@
+// Compares the DVS noise filter's two timestamp map layouts, rows and 4x4 tiles,
+// on synthetic, uniformly active polarity streams for several sensor sizes. Each
+// is measured with a single filter, whose map stays in the CPU caches, and with
+// as many filters as needed for their maps to add up to a working set larger than
+// the caches, all filtering the same stream one packet after the other, so that
+// each filter's map has been evicted by the others by the time it gets the next
+// packet. The valid events and statistics of both layouts must be exactly the
+// same, the results are reported as JSON.
+
+#include "libcaer/filters/dvs_noise.h"
+#include "portable_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RUNS_NUMBER 2
+// Single filter: the whole stream in large packets.
+#define CACHED_PACKET_EVENTS  100000
+#define CACHED_PACKETS_NUMBER 20
+// Many filters: small packets, so that the filters take turns often, at least
+// UNCACHED_PACKETS_MIN per filter, for about UNCACHED_EVENTS in total.
+#define UNCACHED_PACKET_EVENTS 1000
+#define UNCACHED_PACKETS_MIN   16
+#define UNCACHED_EVENTS        10000000
+// Default working set of all the filters' maps, in MB.
+#define WORKING_SET_DEFAULT 512
+
+struct sensor_size {
+	const char *name;
+	uint16_t sizeX;
+	uint16_t sizeY;
+};
+
+static const struct sensor_size sensorSizes[] = {
+	{"346x260", 346, 260},
+	{"640x480", 640, 480},
+	{"1280x720", 1280, 720},
+};
+
+struct filter_config {
+	const char *name;
+	bool twoLevels;
+	bool checkPolarity;
+	bool refractoryPeriod;
+};
+
+static const struct filter_config filterConfigs[] = {
+	{"background_activity", false, false, false},
+	{"check_polarity", false, true, false},
+	{"two_levels", true, false, false},
+	{"refractory_period", false, false, true},
+};
+
+static int64_t monotonicNs(void) {
+	struct timespec time;
+	portable_clock_gettime_monotonic(&time);
+
+	return ((I64T(time.tv_sec) * 1000000000LL) + I64T(time.tv_nsec));
+}
+
+static uint32_t xorshift32(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+
+	*state = x;
+	return (x);
+}
+
+static void streamFree(caerPolarityEventPacket *packets, size_t packetsNumber) {
+	for (size_t i = 0; i < packetsNumber; i++) {
+		caerEventPacketFree((caerEventPacketHeader) packets[i]);
+	}
+
+	free(packets);
+}
+
+// Uniform activity over the whole sensor, a microsecond passing every four events.
+static caerPolarityEventPacket *streamGenerate(
+	const struct sensor_size *sensor, int32_t packetEvents, size_t packetsNumber) {
+	caerPolarityEventPacket *packets = calloc(packetsNumber, sizeof(caerPolarityEventPacket));
+	if (packets == NULL) {
+		return (NULL);
+	}
+
+	uint32_t random   = 0x12345678;
+	int32_t timestamp = 0;
+
+	for (size_t i = 0; i < packetsNumber; i++) {
+		packets[i] = caerPolarityEventPacketAllocate(packetEvents, 1, 0);
+		if (packets[i] == NULL) {
+			streamFree(packets, i);
+			return (NULL);
+		}
+
+		for (int32_t j = 0; j < packetEvents; j++) {
+			uint32_t value = xorshift32(&random);
+
+			timestamp += ((value & 0x03) == 0) ? (1) : (0);
+
+			caerPolarityEvent event = caerPolarityEventPacketGetEvent(packets[i], j);
+
+			caerPolarityEventSetTimestamp(event, timestamp);
+			caerPolarityEventSetX(event, U16T((value >> 8) % sensor->sizeX));
+			caerPolarityEventSetY(event, U16T((value >> 20) % sensor->sizeY));
+			caerPolarityEventSetPolarity(event, (value >> 31) != 0);
+			caerPolarityEventValidate(event, packets[i]);
+		}
+	}
+
+	return (packets);
+}
+
+// Filter copies of the stream with filtersNumber filters using the given map layout,
+// each packet going to all filters in turn before the next one. The hash covers the
+// validity of every event and the statistics of every filter.
+static bool runFilters(const struct sensor_size *sensor, const struct filter_config *config, uint8_t mapLayout,
+	size_t filtersNumber, caerPolarityEventPacket *packets, size_t packetsNumber, double *nsPerEvent,
+	uint64_t *hash) {
+	caerFilterDVSNoise *noiseFilters = calloc(filtersNumber, sizeof(caerFilterDVSNoise));
+	if (noiseFilters == NULL) {
+		return (false);
+	}
+
+	// About two events per neighborhood within the background-activity time.
+	uint32_t backgroundActivityTime = U32T((sensor->sizeX * sensor->sizeY) / 16);
+	bool success                    = true;
+	int64_t filterTime              = 0;
+	size_t eventsNumber             = 0;
+
+	for (size_t i = 0; i < filtersNumber; i++) {
+		noiseFilters[i] = caerFilterDVSNoiseInitializeLayout(sensor->sizeX, sensor->sizeY, mapLayout);
+		if (noiseFilters[i] == NULL) {
+			success = false;
+			goto Cleanup;
+		}
+
+		caerFilterDVSNoiseConfigSet(noiseFilters[i], CAER_FILTER_DVS_BACKGROUND_ACTIVITY_ENABLE, true);
+		caerFilterDVSNoiseConfigSet(
+			noiseFilters[i], CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TIME, backgroundActivityTime);
+		caerFilterDVSNoiseConfigSet(
+			noiseFilters[i], CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TWO_LEVELS, config->twoLevels);
+		caerFilterDVSNoiseConfigSet(
+			noiseFilters[i], CAER_FILTER_DVS_BACKGROUND_ACTIVITY_CHECK_POLARITY, config->checkPolarity);
+		caerFilterDVSNoiseConfigSet(
+			noiseFilters[i], CAER_FILTER_DVS_REFRACTORY_PERIOD_ENABLE, config->refractoryPeriod);
+		caerFilterDVSNoiseConfigSet(
+			noiseFilters[i], CAER_FILTER_DVS_REFRACTORY_PERIOD_TIME, backgroundActivityTime / 2);
+	}
+
+	*hash = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < packetsNumber; i++) {
+		int32_t packetEvents = caerEventPacketHeaderGetEventNumber(&packets[i]->packetHeader);
+
+		for (size_t j = 0; j < filtersNumber; j++) {
+			caerPolarityEventPacket packet
+				= (caerPolarityEventPacket) caerEventPacketCopy((caerEventPacketHeader) packets[i]);
+			if (packet == NULL) {
+				success = false;
+				goto Cleanup;
+			}
+
+			int64_t startTime = monotonicNs();
+
+			caerFilterDVSNoiseApply(noiseFilters[j], packet);
+
+			filterTime += monotonicNs() - startTime;
+			eventsNumber += (size_t) packetEvents;
+
+			for (int32_t k = 0; k < packetEvents; k++) {
+				*hash ^= caerPolarityEventIsValid(caerPolarityEventPacketGetEventConst(packet, k));
+				*hash *= 1099511628211ULL;
+			}
+
+			caerEventPacketFree((caerEventPacketHeader) packet);
+		}
+	}
+
+	for (size_t i = 0; i < filtersNumber; i++) {
+		uint64_t statistic;
+
+		caerFilterDVSNoiseConfigGet(noiseFilters[i], CAER_FILTER_DVS_BACKGROUND_ACTIVITY_STATISTICS, &statistic);
+		*hash ^= statistic;
+		*hash *= 1099511628211ULL;
+
+		caerFilterDVSNoiseConfigGet(noiseFilters[i], CAER_FILTER_DVS_REFRACTORY_PERIOD_STATISTICS, &statistic);
+		*hash ^= statistic;
+		*hash *= 1099511628211ULL;
+	}
+
+	*nsPerEvent = (double) filterTime / (double) eventsNumber;
+
+Cleanup:
+	for (size_t i = 0; i < filtersNumber; i++) {
+		if (noiseFilters[i] != NULL) {
+			caerFilterDVSNoiseDestroy(noiseFilters[i]);
+		}
+	}
+
+	free(noiseFilters);
+
+	return (success);
+}
+
+// Best of RUNS_NUMBER runs for each layout, alternating between them. All results
+// of a layout must be the same. Prints one JSON result, returns if both layouts
+// gave exactly the same result through 'match'.
+static bool runLayouts(const struct sensor_size *sensor, const struct filter_config *config, const char *mode,
+	size_t filtersNumber, caerPolarityEventPacket *packets, size_t packetsNumber, bool first, bool *match) {
+	const uint8_t mapLayouts[2] = {CAER_FILTER_DVS_MAP_LAYOUT_ROWS, CAER_FILTER_DVS_MAP_LAYOUT_TILES};
+	double nsPerEvent[2];
+	uint64_t hash[2];
+
+	for (size_t i = 0; i < RUNS_NUMBER; i++) {
+		for (size_t j = 0; j < 2; j++) {
+			double runNsPerEvent;
+			uint64_t runHash;
+
+			if (!runFilters(
+					sensor, config, mapLayouts[j], filtersNumber, packets, packetsNumber, &runNsPerEvent, &runHash)) {
+				return (false);
+			}
+
+			if ((i != 0) && (runHash != hash[j])) {
+				return (false);
+			}
+
+			if ((i == 0) || (runNsPerEvent < nsPerEvent[j])) {
+				nsPerEvent[j] = runNsPerEvent;
+			}
+
+			hash[j] = runHash;
+		}
+	}
+
+	*match = (hash[0] == hash[1]);
+
+	printf("%s\t\t{\"sensor\": \"%s\", \"config\": \"%s\", \"mode\": \"%s\", \"filters\": %zu, "
+		   "\"rowsNsPerEvent\": %.2f, \"tilesNsPerEvent\": %.2f, \"tilesSpeedup\": %.2f, \"exact\": %s}",
+		(first) ? ("") : (",\n"), sensor->name, config->name, mode, filtersNumber, nsPerEvent[0], nsPerEvent[1],
+		nsPerEvent[0] / nsPerEvent[1], (*match) ? ("true") : ("false"));
+	fflush(stdout);
+
+	return (true);
+}
+
+int main(int argc, char *argv[]) {
+	size_t workingSet = WORKING_SET_DEFAULT;
+
+	if (argc > 1) {
+		workingSet = strtoul(argv[1], NULL, 10);
+
+		if (workingSet == 0) {
+			fprintf(stderr, "Usage: %s [working set in MB, default %d]\n", argv[0], WORKING_SET_DEFAULT);
+			return (EXIT_FAILURE);
+		}
+	}
+
+	bool allMatch = true;
+	bool first    = true;
+
+	printf("{\n\t\"benchmark\": \"filter_dvs_noise_layout\",\n\t\"workingSetMB\": %zu,\n\t\"results\": [\n",
+		workingSet);
+
+	for (size_t i = 0; i < (sizeof(sensorSizes) / sizeof(sensorSizes[0])); i++) {
+		const struct sensor_size *sensor = &sensorSizes[i];
+
+		// Enough filters for their maps, at least a 32 bit entry per pixel, to exceed the working set.
+		size_t mapBytes             = (size_t) sensor->sizeX * (size_t) sensor->sizeY * sizeof(uint32_t);
+		size_t uncachedFilters      = ((workingSet * 1024 * 1024) / mapBytes) + 1;
+		size_t uncachedPacketsNumber = UNCACHED_EVENTS / (uncachedFilters * UNCACHED_PACKET_EVENTS);
+
+		if (uncachedPacketsNumber < UNCACHED_PACKETS_MIN) {
+			uncachedPacketsNumber = UNCACHED_PACKETS_MIN;
+		}
+
+		caerPolarityEventPacket *cachedPackets = streamGenerate(sensor, CACHED_PACKET_EVENTS, CACHED_PACKETS_NUMBER);
+		caerPolarityEventPacket *uncachedPackets
+			= streamGenerate(sensor, UNCACHED_PACKET_EVENTS, uncachedPacketsNumber);
+		if ((cachedPackets == NULL) || (uncachedPackets == NULL)) {
+			fprintf(stderr, "Failed to generate synthetic %s stream.\n", sensor->name);
+			return (EXIT_FAILURE);
+		}
+
+		for (size_t j = 0; j < (sizeof(filterConfigs) / sizeof(filterConfigs[0])); j++) {
+			bool cachedMatch;
+			bool uncachedMatch;
+
+			if (!runLayouts(
+					sensor, &filterConfigs[j], "cached", 1, cachedPackets, CACHED_PACKETS_NUMBER, first, &cachedMatch)
+				|| !runLayouts(sensor, &filterConfigs[j], "uncached", uncachedFilters, uncachedPackets,
+					uncachedPacketsNumber, false, &uncachedMatch)) {
+				fprintf(stderr, "Failed to filter synthetic %s stream with %s configuration.\n", sensor->name,
+					filterConfigs[j].name);
+				return (EXIT_FAILURE);
+			}
+
+			allMatch = allMatch && cachedMatch && uncachedMatch;
+			first    = false;
+		}
+
+		streamFree(cachedPackets, CACHED_PACKETS_NUMBER);
+		streamFree(uncachedPackets, uncachedPacketsNumber);
+	}
+
+	printf("\n\t]\n}\n");
+
+	return ((allMatch) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
@@ -0,0 +1,240 @@
+// Measures the throughput of the DVS noise filter's background-activity lookup,
+// on synthetic polarity streams dense enough for neighbors to support events
+// about half of the time. The valid events and statistics must be exactly the
+// same as those of the previous implementation of the noise filter, with a 64 bit
+// timestamp map and border checks for each neighbor, recorded as golden hashes
+// below. The results are reported as JSON.
+
+#include "libcaer/filters/dvs_noise.h"
+#include "portable_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PACKET_EVENTS  100000
+#define PACKETS_NUMBER 20
+#define RUNS_NUMBER    3
+
+struct sensor_size {
+	const char *name;
+	uint16_t sizeX;
+	uint16_t sizeY;
+};
+
+static const struct sensor_size sensorSizes[] = {
+	{"128x128", 128, 128},
+	{"346x260", 346, 260},
+	{"640x480", 640, 480},
+	{"1280x720", 1280, 720},
+};
+
+struct filter_config {
+	const char *name;
+	bool twoLevels;
+	bool checkPolarity;
+	bool refractoryPeriod;
+};
+
+static const struct filter_config filterConfigs[] = {
+	{"background_activity", false, false, false},
+	{"check_polarity", false, true, false},
+	{"two_levels", true, false, false},
+	{"refractory_period", false, false, true},
+};
+
+// Hashes of the results of the previous noise filter implementation (libcaer 3.3.15),
+// for each sensor size (rows) and filter configuration (columns), see runFilter().
+static const uint64_t goldenHashes[][sizeof(filterConfigs) / sizeof(filterConfigs[0])] = {
+	{0x7622FD8F04178257ULL, 0x67B1A7BE2F0B6407ULL, 0xA612DAAD7EA32157ULL, 0x2553A1EB0AB2AEDFULL},
+	{0x1F5C77D59AA36569ULL, 0x9A31E2328444AEC1ULL, 0x66F43F701DF2C867ULL, 0x6D0DCE902B10A323ULL},
+	{0xE841DCEE4EDEB8C5ULL, 0x04F5DFAD639301B3ULL, 0x8F00701C1FF7597DULL, 0xB57E92006438678DULL},
+	{0xD79430352AB7618FULL, 0xD1EE8E021BAD890DULL, 0xA4A3550B88A7B99FULL, 0x08C1DF82710B6C37ULL},
+};
+
+static int64_t monotonicNs(void) {
+	struct timespec time;
+	portable_clock_gettime_monotonic(&time);
+
+	return ((I64T(time.tv_sec) * 1000000000LL) + I64T(time.tv_nsec));
+}
+
+static uint32_t xorshift32(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+
+	*state = x;
+	return (x);
+}
+
+// Uniform activity over the whole sensor, a microsecond passing every four events.
+static caerPolarityEventPacket *streamGenerate(const struct sensor_size *sensor) {
+	caerPolarityEventPacket *packets = calloc(PACKETS_NUMBER, sizeof(caerPolarityEventPacket));
+	if (packets == NULL) {
+		return (NULL);
+	}
+
+	uint32_t random   = 0x12345678;
+	int32_t timestamp = 0;
+
+	for (size_t i = 0; i < PACKETS_NUMBER; i++) {
+		packets[i] = caerPolarityEventPacketAllocate(PACKET_EVENTS, 1, 0);
+		if (packets[i] == NULL) {
+			for (size_t j = 0; j < i; j++) {
+				caerEventPacketFree((caerEventPacketHeader) packets[j]);
+			}
+
+			free(packets);
+			return (NULL);
+		}
+
+		for (int32_t j = 0; j < PACKET_EVENTS; j++) {
+			uint32_t value = xorshift32(&random);
+
+			timestamp += ((value & 0x03) == 0) ? (1) : (0);
+
+			caerPolarityEvent event = caerPolarityEventPacketGetEvent(packets[i], j);
+
+			caerPolarityEventSetTimestamp(event, timestamp);
+			caerPolarityEventSetX(event, U16T((value >> 8) % sensor->sizeX));
+			caerPolarityEventSetY(event, U16T((value >> 20) % sensor->sizeY));
+			caerPolarityEventSetPolarity(event, (value >> 31) != 0);
+			caerPolarityEventValidate(event, packets[i]);
+		}
+	}
+
+	return (packets);
+}
+
+// Filter a copy of the stream. The hash covers the validity of every event and the statistics.
+static bool runFilter(const struct sensor_size *sensor, const struct filter_config *config,
+	caerPolarityEventPacket *packets, double *nsPerEvent, uint64_t *hash) {
+	// About two events per neighborhood within the background-activity time.
+	uint32_t backgroundActivityTime = U32T((sensor->sizeX * sensor->sizeY) / 16);
+
+	caerFilterDVSNoise noiseFilter = caerFilterDVSNoiseInitialize(sensor->sizeX, sensor->sizeY);
+	if (noiseFilter == NULL) {
+		return (false);
+	}
+
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_ENABLE, true);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TIME, backgroundActivityTime);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TWO_LEVELS, config->twoLevels);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_CHECK_POLARITY, config->checkPolarity);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_REFRACTORY_PERIOD_ENABLE, config->refractoryPeriod);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_REFRACTORY_PERIOD_TIME, backgroundActivityTime / 2);
+
+	int64_t filterTime = 0;
+	*hash              = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < PACKETS_NUMBER; i++) {
+		caerPolarityEventPacket packet
+			= (caerPolarityEventPacket) caerEventPacketCopy((caerEventPacketHeader) packets[i]);
+		if (packet == NULL) {
+			caerFilterDVSNoiseDestroy(noiseFilter);
+			return (false);
+		}
+
+		int64_t startTime = monotonicNs();
+
+		caerFilterDVSNoiseApply(noiseFilter, packet);
+
+		filterTime += monotonicNs() - startTime;
+
+		for (int32_t j = 0; j < PACKET_EVENTS; j++) {
+			*hash ^= caerPolarityEventIsValid(caerPolarityEventPacketGetEventConst(packet, j));
+			*hash *= 1099511628211ULL;
+		}
+
+		caerEventPacketFree((caerEventPacketHeader) packet);
+	}
+
+	uint64_t statistic;
+
+	caerFilterDVSNoiseConfigGet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_STATISTICS, &statistic);
+	*hash ^= statistic;
+	*hash *= 1099511628211ULL;
+
+	caerFilterDVSNoiseConfigGet(noiseFilter, CAER_FILTER_DVS_REFRACTORY_PERIOD_STATISTICS, &statistic);
+	*hash ^= statistic;
+	*hash *= 1099511628211ULL;
+
+	caerFilterDVSNoiseDestroy(noiseFilter);
+
+	*nsPerEvent = (double) filterTime / (double) (PACKETS_NUMBER * PACKET_EVENTS);
+
+	return (true);
+}
+
+// Best of RUNS_NUMBER runs, their results must all be the same.
+static bool runFilterBest(const struct sensor_size *sensor, const struct filter_config *config,
+	caerPolarityEventPacket *packets, double *nsPerEvent, uint64_t *hash) {
+	for (size_t i = 0; i < RUNS_NUMBER; i++) {
+		double runNsPerEvent;
+		uint64_t runHash;
+
+		if (!runFilter(sensor, config, packets, &runNsPerEvent, &runHash)) {
+			return (false);
+		}
+
+		if ((i != 0) && (runHash != *hash)) {
+			return (false);
+		}
+
+		if ((i == 0) || (runNsPerEvent < *nsPerEvent)) {
+			*nsPerEvent = runNsPerEvent;
+		}
+
+		*hash = runHash;
+	}
+
+	return (true);
+}
+
+int main(void) {
+	bool allMatch = true;
+
+	printf("{\n\t\"benchmark\": \"filter_dvs_noise_lookup\",\n\t\"packetEvents\": %d,\n\t\"packets\": %d,\n"
+		   "\t\"results\": [\n",
+		PACKET_EVENTS, PACKETS_NUMBER);
+
+	for (size_t i = 0; i < (sizeof(sensorSizes) / sizeof(sensorSizes[0])); i++) {
+		caerPolarityEventPacket *packets = streamGenerate(&sensorSizes[i]);
+		if (packets == NULL) {
+			fprintf(stderr, "Failed to generate synthetic %s stream.\n", sensorSizes[i].name);
+			return (EXIT_FAILURE);
+		}
+
+		for (size_t j = 0; j < (sizeof(filterConfigs) / sizeof(filterConfigs[0])); j++) {
+			double nsPerEvent = 0;
+			uint64_t hash     = 0;
+
+			if (!runFilterBest(&sensorSizes[i], &filterConfigs[j], packets, &nsPerEvent, &hash)) {
+				fprintf(stderr, "Failed to filter synthetic %s stream with %s configuration.\n", sensorSizes[i].name,
+					filterConfigs[j].name);
+				return (EXIT_FAILURE);
+			}
+
+			bool match = (hash == goldenHashes[i][j]);
+			allMatch   = allMatch && match;
+
+			printf("%s\t\t{\"sensor\": \"%s\", \"config\": \"%s\", \"eventsPerSecond\": %.4e, \"nsPerEvent\": %.2f, "
+				   "\"exact\": %s}",
+				((i == 0) && (j == 0)) ? ("") : (",\n"), sensorSizes[i].name, filterConfigs[j].name, 1.0e9 / nsPerEvent,
+				nsPerEvent, (match) ? ("true") : ("false"));
+		}
+
+		for (size_t j = 0; j < PACKETS_NUMBER; j++) {
+			caerEventPacketFree((caerEventPacketHeader) packets[j]);
+		}
+
+		free(packets);
+	}
+
+	printf("\n\t]\n}\n");
+
+	return ((allMatch) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
@@ -0,0 +1,224 @@
+// Measures how the DVS noise filter scales with its number of threads, on
+// synthetic polarity streams for several sensor sizes, and reports the
+// throughput for each thread count as JSON. Every multi-threaded run is
+// checked against the single-threaded one: the resulting valid events and
+// statistics must be exactly the same.
+
+#include "libcaer/filters/dvs_noise.h"
+#include "portable_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PACKET_EVENTS  100000
+#define PACKETS_NUMBER 50
+#define THREADS_MAX    16
+
+struct sensor_size {
+	const char *name;
+	uint16_t sizeX;
+	uint16_t sizeY;
+};
+
+static const struct sensor_size sensorSizes[] = {
+	{"346x260", 346, 260},
+	{"640x480", 640, 480},
+	{"1280x720", 1280, 720},
+};
+
+static const uint8_t statisticsParams[] = {CAER_FILTER_DVS_HOTPIXEL_STATISTICS,
+	CAER_FILTER_DVS_BACKGROUND_ACTIVITY_STATISTICS, CAER_FILTER_DVS_REFRACTORY_PERIOD_STATISTICS};
+
+static int64_t monotonicNs(void) {
+	struct timespec time;
+	portable_clock_gettime_monotonic(&time);
+
+	return ((I64T(time.tv_sec) * 1000000000LL) + I64T(time.tv_nsec));
+}
+
+static uint32_t xorshift32(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+
+	*state = x;
+	return (x);
+}
+
+// Mostly correlated activity, two edges sweeping the sensor, plus uniform background noise.
+static caerPolarityEventPacket *streamGenerate(const struct sensor_size *sensor) {
+	caerPolarityEventPacket *packets = calloc(PACKETS_NUMBER, sizeof(caerPolarityEventPacket));
+	if (packets == NULL) {
+		return (NULL);
+	}
+
+	uint32_t random   = 0x12345678;
+	int32_t timestamp = 0;
+
+	for (size_t i = 0; i < PACKETS_NUMBER; i++) {
+		packets[i] = caerPolarityEventPacketAllocate(PACKET_EVENTS, 1, 0);
+		if (packets[i] == NULL) {
+			for (size_t j = 0; j < i; j++) {
+				caerEventPacketFree((caerEventPacketHeader) packets[j]);
+			}
+
+			free(packets);
+			return (NULL);
+		}
+
+		for (int32_t j = 0; j < PACKET_EVENTS; j++) {
+			uint32_t value = xorshift32(&random);
+			uint16_t x;
+			uint16_t y;
+
+			timestamp += I32T(value & 0x01);
+
+			if ((value % 4) == 0) {
+				x = U16T((value >> 8) % sensor->sizeX);
+				y = U16T((value >> 20) % sensor->sizeY);
+			}
+			else if ((value % 4) == 1) {
+				x = U16T((U32T(timestamp / 20) + ((value >> 8) % 3)) % sensor->sizeX);
+				y = U16T((value >> 12) % sensor->sizeY);
+			}
+			else {
+				x = U16T((value >> 12) % sensor->sizeX);
+				y = U16T((U32T(timestamp / 15) + ((value >> 8) % 3)) % sensor->sizeY);
+			}
+
+			caerPolarityEvent event = caerPolarityEventPacketGetEvent(packets[i], j);
+
+			caerPolarityEventSetTimestamp(event, timestamp);
+			caerPolarityEventSetX(event, x);
+			caerPolarityEventSetY(event, y);
+			caerPolarityEventSetPolarity(event, (value >> 31) != 0);
+			caerPolarityEventValidate(event, packets[i]);
+		}
+	}
+
+	return (packets);
+}
+
+// Filter a copy of the stream with the given number of threads. The hash covers
+// the validity of every event and the filter statistics.
+static bool runFilter(const struct sensor_size *sensor, caerPolarityEventPacket *packets, uint8_t threads,
+	double *nsPerEvent, uint64_t *hash) {
+	caerFilterDVSNoise noiseFilter = caerFilterDVSNoiseInitialize(sensor->sizeX, sensor->sizeY);
+	if (noiseFilter == NULL) {
+		return (false);
+	}
+
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_BACKGROUND_ACTIVITY_ENABLE, true);
+	caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_REFRACTORY_PERIOD_ENABLE, true);
+
+	if (!caerFilterDVSNoiseConfigSet(noiseFilter, CAER_FILTER_DVS_THREADS, threads)) {
+		caerFilterDVSNoiseDestroy(noiseFilter);
+		return (false);
+	}
+
+	int64_t filterTime = 0;
+	*hash              = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < PACKETS_NUMBER; i++) {
+		caerPolarityEventPacket packet
+			= (caerPolarityEventPacket) caerEventPacketCopy((caerEventPacketHeader) packets[i]);
+		if (packet == NULL) {
+			caerFilterDVSNoiseDestroy(noiseFilter);
+			return (false);
+		}
+
+		int64_t startTime = monotonicNs();
+
+		caerFilterDVSNoiseApply(noiseFilter, packet);
+
+		filterTime += monotonicNs() - startTime;
+
+		for (int32_t j = 0; j < PACKET_EVENTS; j++) {
+			*hash ^= caerPolarityEventIsValid(caerPolarityEventPacketGetEventConst(packet, j));
+			*hash *= 1099511628211ULL;
+		}
+
+		caerEventPacketFree((caerEventPacketHeader) packet);
+	}
+
+	for (size_t i = 0; i < (sizeof(statisticsParams) / sizeof(statisticsParams[0])); i++) {
+		uint64_t statistic;
+		caerFilterDVSNoiseConfigGet(noiseFilter, statisticsParams[i], &statistic);
+
+		*hash ^= statistic;
+		*hash *= 1099511628211ULL;
+	}
+
+	caerFilterDVSNoiseDestroy(noiseFilter);
+
+	*nsPerEvent = (double) filterTime / (double) (PACKETS_NUMBER * PACKET_EVENTS);
+
+	return (true);
+}
+
+int main(int argc, char *argv[]) {
+	uint8_t threadsMax = 8;
+
+	if (argc > 1) {
+		threadsMax = U8T(strtoul(argv[1], NULL, 10));
+
+		if ((threadsMax == 0) || (threadsMax > THREADS_MAX)) {
+			fprintf(stderr, "Usage: %s [maximum threads, 1 to %d, default 8]\n", argv[0], THREADS_MAX);
+			return (EXIT_FAILURE);
+		}
+	}
+
+	bool allMatch = true;
+
+	printf("{\n\t\"benchmark\": \"filter_dvs_noise_scaling\",\n\t\"packetEvents\": %d,\n\t\"packets\": %d,\n"
+		   "\t\"results\": [\n",
+		PACKET_EVENTS, PACKETS_NUMBER);
+
+	for (size_t i = 0; i < (sizeof(sensorSizes) / sizeof(sensorSizes[0])); i++) {
+		caerPolarityEventPacket *packets = streamGenerate(&sensorSizes[i]);
+		if (packets == NULL) {
+			fprintf(stderr, "Failed to generate synthetic %s stream.\n", sensorSizes[i].name);
+			return (EXIT_FAILURE);
+		}
+
+		double singleNsPerEvent = 0;
+		uint64_t singleHash     = 0;
+
+		for (uint8_t threads = 1; threads <= threadsMax; threads = U8T(threads * 2)) {
+			double nsPerEvent;
+			uint64_t hash;
+
+			if (!runFilter(&sensorSizes[i], packets, threads, &nsPerEvent, &hash)) {
+				fprintf(stderr, "Failed to filter synthetic %s stream with %" PRIu8 " threads.\n",
+					sensorSizes[i].name, threads);
+				return (EXIT_FAILURE);
+			}
+
+			if (threads == 1) {
+				singleNsPerEvent = nsPerEvent;
+				singleHash       = hash;
+			}
+
+			bool match = (hash == singleHash);
+			allMatch   = allMatch && match;
+
+			printf("%s\t\t{\"sensor\": \"%s\", \"threads\": %" PRIu8
+				   ", \"eventsPerSecond\": %.4e, \"nsPerEvent\": %.2f, \"speedup\": %.2f, \"exact\": %s}",
+				((i == 0) && (threads == 1)) ? ("") : (",\n"), sensorSizes[i].name, threads, 1.0e9 / nsPerEvent,
+				nsPerEvent, singleNsPerEvent / nsPerEvent, (match) ? ("true") : ("false"));
+		}
+
+		for (size_t j = 0; j < PACKETS_NUMBER; j++) {
+			caerEventPacketFree((caerEventPacketHeader) packets[j]);
+		}
+
+		free(packets);
+	}
+
+	printf("\n\t]\n}\n");
+
+	return ((allMatch) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
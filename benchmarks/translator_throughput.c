@@ -0,0 +1,702 @@
+// Pushes synthetic, format-correct raw data streams through the real event
+// translators of each device family, and reports their throughput and
+// heap allocations per event as JSON.
+// USB streams are written as raw recordings and fed to the translators by the
+// replay thread at maximum speed. Serial (eDVS) streams have no raw recording,
+// they are kept in memory and fed to the translator directly, when serial
+// device support is compiled in. Containers are consumed directly from the
+// data available notification, in the translator's thread, so it never
+// blocks on a full ring-buffer and the measured time is translation time.
+
+#include "davis.h"
+#include "dvs128.h"
+#include "dvxplorer.h"
+#include "portable_time.h"
+#include "samsung_evk.h"
+
+#if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 1
+#	include "edvs.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRANSFER_SIZE          16384
+#define TRANSFERS_NUMBER       2048
+#define RECYCLE_POOL_SIZE      16
+#define RECORDING_FILE_PATTERN "translator_throughput_%s.raw"
+
+// Heap allocation counting, by interposing the allocator entry points.
+// Only available with glibc, which exposes the real implementations. The
+// replacements must be visible to the library, which is built separately.
+#if defined(__GLIBC__)
+#	define ALLOCATIONS_COUNTED 1
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+
+static atomic_bool allocationsCount;
+static atomic_uint_fast64_t allocations;
+
+static inline void allocationCount(void) {
+	if (atomic_load_explicit(&allocationsCount, memory_order_relaxed)) {
+		atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+	}
+}
+
+LIBRARY_PUBLIC_VISIBILITY void *malloc(size_t size) {
+	allocationCount();
+	return (__libc_malloc(size));
+}
+
+LIBRARY_PUBLIC_VISIBILITY void *calloc(size_t nmemb, size_t size) {
+	allocationCount();
+	return (__libc_calloc(nmemb, size));
+}
+
+LIBRARY_PUBLIC_VISIBILITY void *realloc(void *ptr, size_t size) {
+	allocationCount();
+	return (__libc_realloc(ptr, size));
+}
+
+LIBRARY_PUBLIC_VISIBILITY void *aligned_alloc(size_t alignment, size_t size) {
+	allocationCount();
+	return (__libc_memalign(alignment, size));
+}
+
+LIBRARY_PUBLIC_VISIBILITY int posix_memalign(void **memptr, size_t alignment, size_t size) {
+	allocationCount();
+
+	void *mem = __libc_memalign(alignment, size);
+	if (mem == NULL) {
+		return (ENOMEM);
+	}
+
+	*memptr = mem;
+	return (0);
+}
+#else
+#	define ALLOCATIONS_COUNTED 0
+#endif
+
+struct stream_state {
+	int64_t timestamp;
+	uint32_t step;
+	uint64_t events;
+	uint64_t bytes;
+};
+
+typedef struct stream_state *streamState;
+
+struct stream_family {
+	const char *name;
+	uint16_t deviceType;
+	// Largest number of bytes a single generator step can produce.
+	size_t stepMaxSize;
+	// Allocate a device handle, with the state the translator needs, to make the recording from.
+	caerDeviceHandle (*handleCreate)(usbState *usbStatePtr);
+	// Append one step of the stream to the buffer, return number of bytes written.
+	size_t (*generateStep)(streamState stream, uint8_t *buffer);
+};
+
+static inline size_t putWord16(uint8_t *buffer, size_t pos, uint16_t word) {
+	word = htole16(word);
+	memcpy(&buffer[pos], &word, sizeof(word));
+	return (pos + sizeof(word));
+}
+
+static inline size_t putWord32(uint8_t *buffer, size_t pos, uint32_t word, bool bigEndian) {
+	word = (bigEndian) ? (htobe32(word)) : (htole32(word));
+	memcpy(&buffer[pos], &word, sizeof(word));
+	return (pos + sizeof(word));
+}
+
+// 15 bit timestamps, with a wrap event (code 7) every 2^15 µs. The first
+// timestamp after a wrap is implied by the wrap event itself.
+static inline size_t putTimestamp16(streamState stream, uint8_t *buffer, size_t pos) {
+	uint16_t timestamp = U16T(stream->timestamp & 0x7FFF);
+
+	if ((timestamp == 0) && (stream->timestamp != 0)) {
+		return (putWord16(buffer, pos, 0x7001));
+	}
+
+	return (putWord16(buffer, pos, U16T(0x8000 | timestamp)));
+}
+
+// DAVIS346: timestamp, row address, then eight column addresses of alternating polarity.
+static caerDeviceHandle davisHandleCreate(usbState *usbStatePtr) {
+	davisHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		return (NULL);
+	}
+
+	handle->cHandle.deviceType = CAER_DEVICE_DAVIS;
+
+	handle->cHandle.info.dvsSizeX       = 346;
+	handle->cHandle.info.dvsSizeY       = 260;
+	handle->cHandle.info.apsSizeX       = 346;
+	handle->cHandle.info.apsSizeY       = 260;
+	handle->cHandle.info.apsColorFilter = MONO;
+
+	handle->cHandle.state.dvs.sizeX          = 346;
+	handle->cHandle.state.dvs.sizeY          = 260;
+	handle->cHandle.state.aps.sizeX          = 346;
+	handle->cHandle.state.aps.sizeY          = 260;
+	handle->cHandle.state.aps.expectedCountX = 346;
+	handle->cHandle.state.aps.expectedCountY = 260;
+
+	*usbStatePtr = &handle->usbState;
+	return ((caerDeviceHandle) handle);
+}
+
+static size_t davisGenerateStep(streamState stream, uint8_t *buffer) {
+	size_t pos = putTimestamp16(stream, buffer, 0);
+
+	pos = putWord16(buffer, pos, U16T(0x1000 | (stream->step % 260)));
+
+	for (uint16_t i = 0; i < 8; i++) {
+		uint16_t code = (i & 0x01) ? (0x3000) : (0x2000);
+		pos           = putWord16(buffer, pos, U16T(code | ((stream->step * 8 + i) % 346)));
+	}
+
+	stream->timestamp++;
+	stream->events += 8;
+	return (pos);
+}
+
+// DVXplorer FX3: timestamp, column address, group addresses, then the two full 8-pixel groups.
+static caerDeviceHandle dvXplorerHandleCreate(usbState *usbStatePtr) {
+	dvXplorerHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		return (NULL);
+	}
+
+	handle->deviceType = CAER_DEVICE_DVXPLORER;
+
+	handle->info.dvsSizeX = 640;
+	handle->info.dvsSizeY = 480;
+
+	handle->state.dvs.sizeX = 640;
+	handle->state.dvs.sizeY = 480;
+
+	*usbStatePtr = &handle->state.usbState;
+	return ((caerDeviceHandle) handle);
+}
+
+static size_t dvXplorerGenerateStep(streamState stream, uint8_t *buffer) {
+	size_t pos = putTimestamp16(stream, buffer, 0);
+
+	pos = putWord16(buffer, pos, U16T(0x1000 | (stream->step % 640)));
+	pos = putWord16(buffer, pos, U16T(0x4000 | (0x01 << 6) | (stream->step % 59))); // Group 2 is group 1 + 1.
+	pos = putWord16(buffer, pos, 0x30FF);                                            // Group 1, ON.
+	pos = putWord16(buffer, pos, 0x21FF);                                            // Group 2, OFF.
+
+	stream->timestamp++;
+	stream->events += 16;
+	return (pos);
+}
+
+// MIPI CX3 and Samsung EVK share the 32 bit format, little and big endian respectively:
+// one frame per millisecond, made of a reference timestamp, then increasing column addresses,
+// starting with a start-of-frame one, each followed by group events with two full 8-pixel groups.
+#define FRAME_COLUMNS       320
+#define FRAME_COLUMN_GROUPS 2
+
+static size_t frameGenerateStep(streamState stream, uint8_t *buffer, uint32_t groupsNumber, bool bigEndian) {
+	uint32_t column = stream->step % FRAME_COLUMNS;
+	size_t pos      = 0;
+
+	if (column == 0) {
+		stream->timestamp += 1000;
+		pos = putWord32(buffer, pos, U32T(0x08000000 | ((stream->timestamp / 1000) & 0x003FFFFF)), bigEndian);
+		pos = putWord32(buffer, pos, U32T(0x04000000 | (0x01 << 21)), bigEndian);
+	}
+	else {
+		pos = putWord32(buffer, pos, U32T(0x04000000 | column), bigEndian);
+	}
+
+	for (uint32_t i = 0; i < FRAME_COLUMN_GROUPS; i++) {
+		uint32_t group1Address = ((column * FRAME_COLUMN_GROUPS) + i) % (groupsNumber - 1);
+
+		pos = putWord32(
+			buffer, pos, 0x80000000U | (0x01U << 26) | (group1Address << 18) | (0x01U << 17) | 0xFFFFU, bigEndian);
+	}
+
+	stream->events += FRAME_COLUMN_GROUPS * 16;
+	return (pos);
+}
+
+static void frameParserReset(int16_t *lastColumn, int64_t *reference, int32_t *lastReference, int32_t *lastUsedSub,
+	int64_t *lastUsedReference) {
+	*lastColumn        = -1;
+	*reference         = -1;
+	*lastReference     = -1;
+	*lastUsedSub       = -1;
+	*lastUsedReference = -1;
+}
+
+static caerDeviceHandle mipiCx3HandleCreate(usbState *usbStatePtr) {
+	dvXplorerHandle handle = (dvXplorerHandle) dvXplorerHandleCreate(usbStatePtr);
+	if (handle == NULL) {
+		return (NULL);
+	}
+
+	handle->state.isMipiCX3Device = true;
+
+	frameParserReset(&handle->state.dvs.lastColumn, &handle->state.timestampsMIPI.reference,
+		&handle->state.timestampsMIPI.lastReference, &handle->state.timestampsMIPI.lastUsedSub,
+		&handle->state.timestampsMIPI.lastUsedReference);
+
+	return ((caerDeviceHandle) handle);
+}
+
+static size_t mipiCx3GenerateStep(streamState stream, uint8_t *buffer) {
+	return (frameGenerateStep(stream, buffer, 480 / 8, false));
+}
+
+static caerDeviceHandle samsungEVKHandleCreate(usbState *usbStatePtr) {
+	samsungEVKHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		return (NULL);
+	}
+
+	handle->deviceType = CAER_DEVICE_SAMSUNG_EVK;
+
+	handle->info.dvsSizeX = 1280;
+	handle->info.dvsSizeY = 960;
+
+	frameParserReset(&handle->state.dvs.lastColumn, &handle->state.timestamps.reference,
+		&handle->state.timestamps.lastReference, &handle->state.timestamps.lastUsedSub,
+		&handle->state.timestamps.lastUsedReference);
+
+	*usbStatePtr = &handle->state.usbState;
+	return ((caerDeviceHandle) handle);
+}
+
+static size_t samsungEVKGenerateStep(streamState stream, uint8_t *buffer) {
+	return (frameGenerateStep(stream, buffer, 960 / 8, true));
+}
+
+// DVS128: four byte events (address, timestamp), one timestamp every eight events,
+// 14 bit timestamps with a wrap event every 2^14 µs.
+static caerDeviceHandle dvs128HandleCreate(usbState *usbStatePtr) {
+	dvs128Handle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		return (NULL);
+	}
+
+	handle->deviceType = CAER_DEVICE_DVS128;
+
+	handle->info.dvsSizeX = DVS_ARRAY_SIZE_X;
+	handle->info.dvsSizeY = DVS_ARRAY_SIZE_Y;
+
+	*usbStatePtr = &handle->state.usbState;
+	return ((caerDeviceHandle) handle);
+}
+
+static size_t dvs128GenerateStep(streamState stream, uint8_t *buffer) {
+	uint16_t timestamp = U16T(stream->timestamp & 0x3FFF);
+	size_t pos         = 0;
+
+	if ((timestamp == 0) && (stream->timestamp != 0)) {
+		pos = putWord16(buffer, pos, 0);
+		pos = putWord16(buffer, pos, 0x8000);
+	}
+
+	for (uint16_t i = 0; i < 8; i++) {
+		uint16_t x = U16T((stream->step * 8 + i) % DVS_ARRAY_SIZE_X);
+		uint16_t y = U16T(stream->step % DVS_ARRAY_SIZE_Y);
+
+		pos = putWord16(buffer, pos, U16T((y << 8) | (x << 1) | (i & 0x01)));
+		pos = putWord16(buffer, pos, timestamp);
+	}
+
+	stream->timestamp++;
+	stream->events += 8;
+	return (pos);
+}
+
+static const struct stream_family families[] = {
+	{"davis", CAER_DEVICE_DAVIS, 11 * 2, &davisHandleCreate, &davisGenerateStep},
+	{"dvxplorer", CAER_DEVICE_DVXPLORER, 5 * 2, &dvXplorerHandleCreate, &dvXplorerGenerateStep},
+	{"dvxplorer_mipi", CAER_DEVICE_DVXPLORER, (2 + FRAME_COLUMN_GROUPS) * 4, &mipiCx3HandleCreate,
+	 &mipiCx3GenerateStep},
+	{"samsung_evk", CAER_DEVICE_SAMSUNG_EVK, (2 + FRAME_COLUMN_GROUPS) * 4, &samsungEVKHandleCreate,
+	 &samsungEVKGenerateStep},
+	{"dvs128", CAER_DEVICE_DVS128, 9 * 4, &dvs128HandleCreate, &dvs128GenerateStep},
+};
+
+// Fill a transfer with as many generator steps as fit, return number of bytes written.
+static size_t transferGenerate(const struct stream_family *family, uint8_t *buffer, streamState stream) {
+	size_t bufferSize = 0;
+
+	while ((bufferSize + family->stepMaxSize) <= TRANSFER_SIZE) {
+		bufferSize += family->generateStep(stream, &buffer[bufferSize]);
+		stream->step++;
+	}
+
+	stream->bytes += bufferSize;
+	return (bufferSize);
+}
+
+// Write the raw recording of a synthetic stream, filling in the number of events and bytes in it.
+static bool streamRecord(
+	const struct stream_family *family, const char *filePath, size_t transfersNumber, streamState stream) {
+	usbState recordUSBState       = NULL;
+	caerDeviceHandle recordHandle = family->handleCreate(&recordUSBState);
+	if (recordHandle == NULL) {
+		return (false);
+	}
+
+	if (!caerDeviceRawRecordStart(recordHandle, filePath)) {
+		free(recordHandle);
+		return (false);
+	}
+
+	// Recording is armed, append the transfers directly, as they would come from USB.
+	FILE *recordFile = recordUSBState->recordFile;
+
+	uint8_t *buffer = malloc(TRANSFER_SIZE);
+	if (buffer == NULL) {
+		fclose(recordFile);
+		free(recordHandle);
+		return (false);
+	}
+
+	bool writeOk = true;
+
+	for (size_t i = 0; (i < transfersNumber) && writeOk; i++) {
+		size_t bufferSize = transferGenerate(family, buffer, stream);
+
+		writeOk = usbRecordEntryWrite(recordFile, 0, buffer, bufferSize);
+	}
+
+	fclose(recordFile);
+	free(buffer);
+	free(recordHandle);
+
+	return (writeOk);
+}
+
+struct throughput_run {
+	caerDeviceHandle handle;
+	bool recycle;
+	uint64_t events;
+	atomic_bool done;
+	int64_t endTime;
+};
+
+static int64_t monotonicNs(void) {
+	struct timespec time;
+	portable_clock_gettime_monotonic(&time);
+
+	return ((I64T(time.tv_sec) * 1000000000LL) + I64T(time.tv_nsec));
+}
+
+static void dataConsume(void *runPtr) {
+	struct throughput_run *run = runPtr;
+
+	caerEventPacketContainer container;
+	while ((container = caerDeviceDataGet(run->handle)) != NULL) {
+		for (int32_t i = 0; i < caerEventPacketContainerGetEventPacketsNumber(container); i++) {
+			caerEventPacketHeaderConst packet = caerEventPacketContainerGetEventPacketConst(container, i);
+
+			if (packet != NULL) {
+				run->events += U64T(caerEventPacketHeaderGetEventNumber(packet));
+			}
+		}
+
+		if (run->recycle) {
+			caerDeviceDataRecycle(run->handle, container);
+		}
+		else {
+			caerEventPacketContainerFree(container);
+		}
+	}
+}
+
+static void dataShutdown(void *runPtr) {
+	struct throughput_run *run = runPtr;
+
+#if ALLOCATIONS_COUNTED == 1
+	atomic_store(&allocationsCount, false);
+#endif
+
+	run->endTime = monotonicNs();
+	atomic_store(&run->done, true);
+}
+
+static void resultPrint(const char *familyName, streamState stream, bool recycle, uint64_t events, double seconds,
+	bool firstResult) {
+	printf("%s\t\t{\"family\": \"%s\", \"recycle\": %s, \"bytes\": %" PRIu64 ", \"streamEvents\": %" PRIu64
+		   ", \"events\": %" PRIu64 ", \"seconds\": %.6f, \"meventsPerSecond\": %.3f, \"nsPerEvent\": %.3f, "
+		   "\"allocations\": ",
+		(firstResult) ? ("") : (",\n"), familyName, (recycle) ? ("true") : ("false"), stream->bytes, stream->events,
+		events, seconds, ((double) events / seconds) / 1.0E6, (seconds * 1.0E9) / (double) events);
+
+#if ALLOCATIONS_COUNTED == 1
+	uint64_t allocationsNumber = atomic_load(&allocations);
+	printf("%" PRIu64 ", \"allocationsPerEvent\": %.3e}", allocationsNumber,
+		(double) allocationsNumber / (double) events);
+#else
+	printf("null, \"allocationsPerEvent\": null}");
+#endif
+}
+
+static bool runThroughput(
+	const struct stream_family *family, const char *filePath, streamState stream, bool recycle, bool firstResult) {
+	struct throughput_run run = {.handle = NULL, .recycle = recycle, .events = 0, .endTime = 0};
+	atomic_store(&run.done, false);
+
+	run.handle = caerDeviceRawReplayOpen(1, family->deviceType, filePath, true);
+	if (run.handle == NULL) {
+		return (false);
+	}
+
+	caerDeviceConfigSet(run.handle, CAER_HOST_CONFIG_PACKETS, CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_SIZE,
+		(recycle) ? (RECYCLE_POOL_SIZE) : (0));
+
+#if ALLOCATIONS_COUNTED == 1
+	atomic_store(&allocations, 0);
+	atomic_store(&allocationsCount, true);
+#endif
+
+	int64_t startTime = monotonicNs();
+
+	if (!caerDeviceDataStart(run.handle, &dataConsume, NULL, &run, &dataShutdown, &run)) {
+		caerDeviceClose(&run.handle);
+		return (false);
+	}
+
+	while (!atomic_load(&run.done)) {
+		thrd_sleep(1000);
+	}
+
+	caerDeviceDataStop(run.handle);
+	caerDeviceClose(&run.handle);
+
+	resultPrint(family->name, stream, recycle, run.events, (double) (run.endTime - startTime) / 1.0E9, firstResult);
+
+	return (true);
+}
+
+#if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 1
+// eDVS: four byte events, Y address with the high bit set to mark the start of an event,
+// X address with the high bit set for OFF polarity, then a 16 bit big endian timestamp,
+// eight events per timestamp. Timestamps wrap every 2^16 µs.
+static size_t edvsGenerateStep(streamState stream, uint8_t *buffer) {
+	uint16_t timestamp = U16T(stream->timestamp & 0xFFFF);
+	size_t pos         = 0;
+
+	for (uint32_t i = 0; i < 8; i++) {
+		uint8_t x = U8T((stream->step * 8 + i) % EDVS_ARRAY_SIZE_X);
+		uint8_t y = U8T(stream->step % EDVS_ARRAY_SIZE_Y);
+
+		buffer[pos++] = U8T(0x80 | y);
+		buffer[pos++] = U8T(((i & 0x01) ? (0x00) : (0x80)) | x);
+		buffer[pos++] = U8T(timestamp >> 8);
+		buffer[pos++] = U8T(timestamp);
+	}
+
+	stream->timestamp++;
+	stream->events += 8;
+	return (pos);
+}
+
+static const struct stream_family edvsFamily = {"edvs", CAER_DEVICE_EDVS, 8 * 4, NULL, &edvsGenerateStep};
+
+static void edvsHandleDestroy(edvsHandle handle) {
+	edvsState state = &handle->state;
+
+	dataExchangeBufferEmpty(&state->dataExchange);
+	dataExchangeDestroy(&state->dataExchange);
+
+	// Current packets aren't necessarily part of the current container, free them separately.
+	if (state->currentPackets.polarity != NULL) {
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.polarity);
+		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
+	}
+
+	if (state->currentPackets.special != NULL) {
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
+		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
+	}
+
+	containerGenerationDestroy(&state->container);
+
+	free(handle);
+}
+
+// Set up the data path as edvsDataStart() does, without serial port and thread:
+// the translator is called directly, from this thread, one transfer at a time.
+static bool runSerialThroughput(const uint8_t *data, streamState stream, bool recycle, bool firstResult) {
+	struct throughput_run run = {.handle = NULL, .recycle = recycle, .events = 0, .endTime = 0};
+	atomic_store(&run.done, false);
+
+	edvsHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		return (false);
+	}
+
+	static char deviceString[] = EDVS_DEVICE_NAME " ID-1";
+
+	handle->deviceType        = CAER_DEVICE_EDVS;
+	handle->info.deviceID     = 1;
+	handle->info.deviceString = deviceString;
+	handle->info.dvsSizeX     = EDVS_ARRAY_SIZE_X;
+	handle->info.dvsSizeY     = EDVS_ARRAY_SIZE_Y;
+
+	edvsState state = &handle->state;
+
+	dataExchangeSettingsInit(&state->dataExchange);
+	containerGenerationSettingsInit(&state->container);
+	atomic_store(&state->deviceLogLevel, caerLogLevelGet());
+
+	run.handle = (caerDeviceHandle) handle;
+
+	caerDeviceConfigSet(run.handle, CAER_HOST_CONFIG_PACKETS, CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_SIZE,
+		(recycle) ? (RECYCLE_POOL_SIZE) : (0));
+
+	dataExchangeSetNotify(&state->dataExchange, &dataConsume, NULL, &run);
+	containerGenerationCommitTimestampReset(&state->container);
+
+	if (!dataExchangeBufferInit(&state->dataExchange) || !containerGenerationPoolInit(&state->container)) {
+		edvsHandleDestroy(handle);
+		return (false);
+	}
+
+	atomic_store(&state->serialState.serialThreadState, THR_RUNNING);
+
+#	if ALLOCATIONS_COUNTED == 1
+	atomic_store(&allocations, 0);
+	atomic_store(&allocationsCount, true);
+#	endif
+
+	int64_t startTime = monotonicNs();
+
+	for (size_t pos = 0; pos < stream->bytes; pos += TRANSFER_SIZE) {
+		size_t bytesSent = ((stream->bytes - pos) < TRANSFER_SIZE) ? (stream->bytes - pos) : (TRANSFER_SIZE);
+
+		edvsEventTranslator(handle, &data[pos], bytesSent);
+	}
+
+	dataShutdown(&run);
+
+	atomic_store(&state->serialState.serialThreadState, THR_EXITED);
+
+	edvsHandleDestroy(handle);
+
+	resultPrint(edvsFamily.name, stream, recycle, run.events, (double) (run.endTime - startTime) / 1.0E9, firstResult);
+
+	return (true);
+}
+
+// Generate the whole stream in memory, with the same transfers a recording would have.
+static bool runSerialFamily(size_t transfersNumber, bool firstResult) {
+	uint8_t *data = malloc(transfersNumber * TRANSFER_SIZE);
+	if (data == NULL) {
+		return (false);
+	}
+
+	// Start at 1, a first timestamp of 0 is not strictly monotonic.
+	struct stream_state stream = {.timestamp = 1, .step = 0, .events = 0, .bytes = 0};
+
+	for (size_t i = 0; i < transfersNumber; i++) {
+		transferGenerate(&edvsFamily, &data[stream.bytes], &stream);
+	}
+
+	for (int recycle = 0; recycle < 2; recycle++) {
+		if (!runSerialThroughput(data, &stream, recycle, firstResult)) {
+			free(data);
+			return (false);
+		}
+
+		firstResult = false;
+	}
+
+	free(data);
+	return (true);
+}
+#else
+static bool runSerialFamily(size_t transfersNumber, bool firstResult) {
+	(void) (transfersNumber);
+
+	printf("%s\t\t{\"family\": \"edvs\", \"skipped\": true, \"reason\": \"serial device support not compiled in\"}",
+		(firstResult) ? ("") : (",\n"));
+
+	return (true);
+}
+#endif
+
+int main(int argc, char *argv[]) {
+	size_t transfersNumber = TRANSFERS_NUMBER;
+	const char *familyName = NULL;
+
+	if (argc > 1) {
+		transfersNumber = strtoul(argv[1], NULL, 10);
+
+		if (transfersNumber == 0) {
+			fprintf(stderr, "Usage: %s [transfers per stream, default %d] [family, default all]\n", argv[0],
+				TRANSFERS_NUMBER);
+			return (EXIT_FAILURE);
+		}
+	}
+
+	if (argc > 2) {
+		familyName = argv[2];
+	}
+
+	// Keep the translators' error logging only.
+	caerLogLevelSet(CAER_LOG_ERROR);
+
+	printf("{\n\t\"benchmark\": \"translator_throughput\",\n\t\"transferSize\": %d,\n\t\"transfers\": %zu,\n"
+		   "\t\"allocationsCounted\": %s,\n\t\"results\": [\n",
+		TRANSFER_SIZE, transfersNumber, (ALLOCATIONS_COUNTED == 1) ? ("true") : ("false"));
+
+	bool firstResult = true;
+
+	for (size_t i = 0; i < (sizeof(families) / sizeof(families[0])); i++) {
+		if ((familyName != NULL) && (strcmp(familyName, families[i].name) != 0)) {
+			continue;
+		}
+
+		char filePath[64];
+		snprintf(filePath, sizeof(filePath), RECORDING_FILE_PATTERN, families[i].name);
+
+		// Start at 1, a first timestamp of 0 is not strictly monotonic.
+		struct stream_state stream = {.timestamp = 1, .step = 0, .events = 0, .bytes = 0};
+
+		if (!streamRecord(&families[i], filePath, transfersNumber, &stream)) {
+			fprintf(stderr, "Failed to write synthetic %s stream to '%s'.\n", families[i].name, filePath);
+			remove(filePath);
+			return (EXIT_FAILURE);
+		}
+
+		for (int recycle = 0; recycle < 2; recycle++) {
+			if (!runThroughput(&families[i], filePath, &stream, recycle, firstResult)) {
+				fprintf(stderr, "Failed to replay synthetic %s stream.\n", families[i].name);
+				remove(filePath);
+				return (EXIT_FAILURE);
+			}
+
+			firstResult = false;
+		}
+
+		remove(filePath);
+	}
+
+	// Serial device families, not replayed.
+	if ((familyName == NULL) || (strcmp(familyName, "edvs") == 0)) {
+		if (!runSerialFamily(transfersNumber, firstResult)) {
+			fprintf(stderr, "Failed to translate synthetic edvs stream.\n");
+			return (EXIT_FAILURE);
+		}
+	}
+
+	printf("\n\t]\n}\n");
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,313 @@
+// Streams numbered data through the USB data transfers, with and without
+// completion coalescing, while they are reallocated: by buffer number and
+// size changes, and by buffer auto-tuning on the USB thread itself. Every
+// byte must arrive exactly once and in order. Reports the result as JSON.
+// libusb is replaced by an in-process fake device, by interposing the
+// transfer entry points the USB helpers use.
+
+#include "portable_time.h"
+#include "usb_utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRANSFERS_NUMBER_INITIAL 8
+#define TRANSFERS_SIZE_INITIAL   USB_AUTO_TUNE_SIZE_MIN
+#define EVENT_TIMEOUT_US         1000
+#define AUTO_TUNE_WAIT_US        (8 * USB_AUTO_TUNE_WINDOW_US)
+// Transfers the fake device fills at once, at most every FILL_INTERVAL_US,
+// delivered in the next event handling round. The interval leaves time for
+// cancel passes to catch the transfers resubmitted meanwhile.
+#define FILLED_PER_ROUND 3
+#define FILL_INTERVAL_US 5000
+#define FAKE_TRANSFERS_MAX (2 * USB_AUTO_TUNE_NUMBER_MAX)
+
+// Fake device: fills the submitted transfers in order with consecutive 32 bit
+// words. Filled transfers complete in the next event handling round, so they
+// can't be cancelled anymore. Cancelled ones complete in order, the first one
+// half filled, as if the device was sending data when the cancel arrived.
+struct fake_pending_transfer {
+	struct libusb_transfer *transfer;
+	bool cancelled;
+};
+
+static struct {
+	mtx_t lock;
+	struct fake_pending_transfer pending[FAKE_TRANSFERS_MAX];
+	size_t pendingNumber;
+	struct libusb_transfer *filled[FAKE_TRANSFERS_MAX];
+	size_t filledNumber;
+	int64_t lastFill;
+	uint32_t nextWord;
+	uint64_t cancelledWithData;
+} fakeDevice;
+
+// Receiving side, only accessed by the USB thread while transfers run.
+static struct {
+	uint32_t expectedWord;
+	uint64_t bytes;
+	uint64_t errors;
+} receiver;
+
+LIBRARY_PUBLIC_VISIBILITY struct libusb_transfer *LIBUSB_CALL libusb_alloc_transfer(int iso_packets) {
+	(void) (iso_packets);
+
+	return (calloc(1, sizeof(struct libusb_transfer)));
+}
+
+LIBRARY_PUBLIC_VISIBILITY void LIBUSB_CALL libusb_free_transfer(struct libusb_transfer *transfer) {
+	if (transfer == NULL) {
+		return;
+	}
+
+	if ((transfer->flags & LIBUSB_TRANSFER_FREE_BUFFER) != 0) {
+		free(transfer->buffer);
+	}
+
+	free(transfer);
+}
+
+LIBRARY_PUBLIC_VISIBILITY int LIBUSB_CALL libusb_submit_transfer(struct libusb_transfer *transfer) {
+	mtx_lock(&fakeDevice.lock);
+
+	if (fakeDevice.pendingNumber == FAKE_TRANSFERS_MAX) {
+		mtx_unlock(&fakeDevice.lock);
+		return (LIBUSB_ERROR_OTHER);
+	}
+
+	fakeDevice.pending[fakeDevice.pendingNumber++]
+		= (struct fake_pending_transfer){.transfer = transfer, .cancelled = false};
+
+	mtx_unlock(&fakeDevice.lock);
+
+	return (LIBUSB_SUCCESS);
+}
+
+LIBRARY_PUBLIC_VISIBILITY int LIBUSB_CALL libusb_cancel_transfer(struct libusb_transfer *transfer) {
+	int result = LIBUSB_ERROR_NOT_FOUND;
+
+	mtx_lock(&fakeDevice.lock);
+
+	for (size_t i = 0; i < fakeDevice.pendingNumber; i++) {
+		if (fakeDevice.pending[i].transfer == transfer) {
+			fakeDevice.pending[i].cancelled = true;
+			result                          = LIBUSB_SUCCESS;
+			break;
+		}
+	}
+
+	mtx_unlock(&fakeDevice.lock);
+
+	return (result);
+}
+
+static int64_t monotonicUs(void) {
+	struct timespec time;
+	portable_clock_gettime_monotonic(&time);
+
+	return ((I64T(time.tv_sec) * 1000000LL) + I64T(time.tv_nsec / 1000));
+}
+
+static void fakeTransferFill(struct libusb_transfer *transfer, size_t length) {
+	for (size_t i = 0; i < length; i += sizeof(uint32_t)) {
+		uint32_t word = fakeDevice.nextWord++;
+		memcpy(&transfer->buffer[i], &word, sizeof(uint32_t));
+	}
+
+	transfer->actual_length = (int) length;
+}
+
+LIBRARY_PUBLIC_VISIBILITY int LIBUSB_CALL libusb_handle_events_timeout(libusb_context *ctx, struct timeval *tv) {
+	(void) (ctx);
+
+	struct libusb_transfer *completed[2 * FAKE_TRANSFERS_MAX];
+	size_t completedNumber = 0;
+
+	mtx_lock(&fakeDevice.lock);
+
+	// Transfers filled in the previous round complete first.
+	for (size_t i = 0; i < fakeDevice.filledNumber; i++) {
+		completed[completedNumber++] = fakeDevice.filled[i];
+	}
+
+	fakeDevice.filledNumber = 0;
+
+	// Then the cancelled ones, and new ones are filled, all in submission order.
+	int64_t now      = monotonicUs();
+	bool fill        = ((now - fakeDevice.lastFill) >= FILL_INTERVAL_US);
+	size_t remaining = 0;
+	bool first       = true;
+
+	if (fill) {
+		fakeDevice.lastFill = now;
+	}
+
+	for (size_t i = 0; i < fakeDevice.pendingNumber; i++) {
+		struct libusb_transfer *transfer = fakeDevice.pending[i].transfer;
+
+		if (fakeDevice.pending[i].cancelled) {
+			transfer->status = LIBUSB_TRANSFER_CANCELLED;
+			fakeTransferFill(transfer, (first) ? ((size_t) transfer->length / 2) : (0));
+
+			fakeDevice.cancelledWithData += first;
+			completed[completedNumber++] = transfer;
+		}
+		else if (fill && (fakeDevice.filledNumber < FILLED_PER_ROUND)) {
+			transfer->status = LIBUSB_TRANSFER_COMPLETED;
+			fakeTransferFill(transfer, (size_t) transfer->length);
+
+			fakeDevice.filled[fakeDevice.filledNumber++] = transfer;
+		}
+		else {
+			fakeDevice.pending[remaining++] = fakeDevice.pending[i];
+		}
+
+		first = false;
+	}
+
+	fakeDevice.pendingNumber = remaining;
+
+	mtx_unlock(&fakeDevice.lock);
+
+	// Callbacks resubmit transfers, so they run without the lock, as in libusb.
+	for (size_t i = 0; i < completedNumber; i++) {
+		(*completed[i]->callback)(completed[i]);
+	}
+
+	if (completedNumber == 0) {
+		thrd_sleep(U32T(tv->tv_usec));
+	}
+
+	return (LIBUSB_SUCCESS);
+}
+
+static void dataCheck(void *dataPtr, const uint8_t *buffer, size_t bytesSent) {
+	(void) (dataPtr);
+
+	for (size_t i = 0; (i + sizeof(uint32_t)) <= bytesSent; i += sizeof(uint32_t)) {
+		uint32_t word;
+		memcpy(&word, &buffer[i], sizeof(uint32_t));
+
+		if (word != receiver.expectedWord) {
+			receiver.errors++;
+		}
+
+		// Continue from the received word, to count each reordering once.
+		receiver.expectedWord = word + 1;
+	}
+
+	receiver.bytes += bytesSent;
+}
+
+// Wait for auto-tuning to change the transfers' size, with full transfers it grows them.
+static bool autoTuneWait(usbState state) {
+	uint32_t transfersSize = usbGetTransfersSize(state);
+	int64_t waitEnd        = monotonicUs() + AUTO_TUNE_WAIT_US;
+
+	while (usbGetTransfersSize(state) == transfersSize) {
+		if (monotonicUs() > waitEnd) {
+			return (false);
+		}
+
+		thrd_sleep(10000);
+	}
+
+	return (true);
+}
+
+static bool runTransfers(bool completionCoalescing, bool *first) {
+	struct usb_state *state = calloc(1, sizeof(struct usb_state));
+	if (state == NULL) {
+		return (false);
+	}
+
+	memset(&fakeDevice.pending, 0, sizeof(fakeDevice.pending));
+	fakeDevice.pendingNumber     = 0;
+	fakeDevice.filledNumber      = 0;
+	fakeDevice.lastFill          = 0;
+	fakeDevice.nextWord          = 0;
+	fakeDevice.cancelledWithData = 0;
+
+	memset(&receiver, 0, sizeof(receiver));
+
+	atomic_store(&state->usbLogLevel, CAER_LOG_WARNING);
+	atomic_store(&state->usbEventTimeout, EVENT_TIMEOUT_US);
+	atomic_store(&state->usbBufferNumber, TRANSFERS_NUMBER_INITIAL);
+	atomic_store(&state->usbBufferSize, TRANSFERS_SIZE_INITIAL);
+	atomic_store(&state->completionCoalescing, completionCoalescing);
+	atomic_store(&state->autoTune, true);
+	strncpy(state->usbThreadName, "USBOrder", MAX_THREAD_NAME_LENGTH);
+	state->dataEndPoint = USB_DEFAULT_DATA_ENDPOINT;
+	portable_clock_gettime_monotonic(&state->autoTuneWindowStart);
+
+	usbSetDataCallback(state, &dataCheck, NULL);
+
+	if (mtx_init(&state->dataTransfersLock, mtx_plain) != thrd_success) {
+		free(state);
+		return (false);
+	}
+
+	if (!usbThreadStart(state)) {
+		mtx_destroy(&state->dataTransfersLock);
+		free(state);
+		return (false);
+	}
+
+	if (!usbDataTransfersStart(state)) {
+		usbThreadStop(state);
+		mtx_destroy(&state->dataTransfersLock);
+		free(state);
+		return (false);
+	}
+
+	// Reallocations from another thread, then from the USB thread itself.
+	thrd_sleep(50000);
+	usbSetTransfersNumber(state, 2 * TRANSFERS_NUMBER_INITIAL);
+	thrd_sleep(50000);
+	usbSetTransfersSize(state, 2 * TRANSFERS_SIZE_INITIAL);
+	thrd_sleep(50000);
+	usbSetTransfersNumber(state, TRANSFERS_NUMBER_INITIAL);
+
+	bool autoTuned = autoTuneWait(state);
+
+	thrd_sleep(50000);
+
+	usbDataTransfersStop(state);
+	usbThreadStop(state);
+
+	mtx_destroy(&state->dataTransfersLock);
+
+	bool inOrder = autoTuned && (receiver.errors == 0)
+				   && (receiver.bytes == (U64T(fakeDevice.nextWord) * sizeof(uint32_t)));
+
+	printf("%s\t\t{\"completionCoalescing\": %s, \"autoTuned\": %s, \"transfersSize\": %" PRIu32
+		   ", \"bytes\": %" PRIu64 ", \"sentBytes\": %" PRIu64 ", \"cancelledWithData\": %" PRIu64
+		   ", \"orderErrors\": %" PRIu64 ", \"inOrder\": %s}",
+		(*first) ? ("") : (",\n"), (completionCoalescing) ? ("true") : ("false"), (autoTuned) ? ("true") : ("false"),
+		usbGetTransfersSize(state), receiver.bytes, U64T(fakeDevice.nextWord) * sizeof(uint32_t),
+		fakeDevice.cancelledWithData, receiver.errors, (inOrder) ? ("true") : ("false"));
+	*first = false;
+
+	free(state);
+
+	return (inOrder);
+}
+
+int main(void) {
+	if (mtx_init(&fakeDevice.lock, mtx_plain) != thrd_success) {
+		return (EXIT_FAILURE);
+	}
+
+	printf("{\n\t\"benchmark\": \"usb_transfer_order\",\n\t\"results\": [\n");
+
+	bool first   = true;
+	bool inOrder = runTransfers(false, &first);
+	inOrder      = runTransfers(true, &first) && inOrder;
+
+	printf("\n\t]\n}\n");
+
+	mtx_destroy(&fakeDevice.lock);
+
+	return ((inOrder) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
@@ -49,6 +49,10 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * Module address: host-side logging configuration.
  */
 #define CAER_HOST_CONFIG_LOG -4
+/**
+ * Module address: host-side data-path statistics (read-only).
+ */
+#define CAER_HOST_CONFIG_STATISTICS -5
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
@@ -89,6 +93,71 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * need precise control over which ones are running at any time.
  */
 #define CAER_HOST_CONFIG_DATAEXCHANGE_STOP_PRODUCERS 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * when caerDeviceDataGet() is blocking (see CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING),
+ * wait to be notified by the data transfer thread as soon as a new
+ * EventPacketContainer is available (true, default), or poll for new
+ * data every millisecond (false). Notification gives the lowest
+ * latency and avoids waking up an idle consumer needlessly.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_NOTIFY 4
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * what to do with a new EventPacketContainer when the FIFO buffer
+ * between the data transfer thread and the main thread is full,
+ * see the CAER_HOST_CONFIG_DATAEXCHANGE_DROP_* values.
+ * Only takes effect on the next caerDeviceDataStart() call.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY 5
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * read-only statistic, number of new EventPacketContainers dropped
+ * because the FIFO buffer was full, with the DROP_NEWEST policy.
+ * Reset on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_NEWEST 6
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * read-only statistic, number of old EventPacketContainers dropped
+ * from the FIFO buffer to make space for new ones, with the
+ * DROP_OLDEST policy.
+ * Reset on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_OLDEST 7
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * read-only statistic, number of times the data transfer thread
+ * had to wait for space in the FIFO buffer, with the BLOCK_PRODUCER
+ * policy.
+ * Reset on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_PRODUCER_BLOCKED 8
+
+/**
+ * Drop policy for CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY:
+ * drop the new EventPacketContainer when the FIFO buffer is full,
+ * keeping the older data already in it (default).
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_DROP_NEWEST 0
+/**
+ * Drop policy for CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY:
+ * drop the oldest EventPacketContainer in the FIFO buffer to make
+ * space for the new one, so that the freshest data is always
+ * available. Getting data takes an additional lock with this policy.
+ * Replacing a container doesn't change the amount of data available,
+ * so neither data notification callback is called in that case.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_DROP_OLDEST 1
+/**
+ * Drop policy for CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY:
+ * never drop data, the data transfer thread waits until there is
+ * space in the FIFO buffer, woken up as soon as data is gotten.
+ * Be aware that this stops all USB data transfers while waiting,
+ * so data might instead be lost on the device side, if it can't
+ * buffer it long enough.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER 2
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_PACKETS:
@@ -107,6 +176,96 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * types of events contained in the EventPacketContainer.
  */
 #define CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_INTERVAL 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * set the number of packet containers that can be given back
+ * with caerDeviceDataRecycle() for reuse, instead of allocating
+ * new containers and packets for every commit.
+ * Set to zero to disable (default).
+ * Only takes effect on the next caerDeviceDataStart() call.
+ */
+#define CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_SIZE 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * read-only statistic, number of packet containers and packets
+ * that could be reused from the recycling pool.
+ * Reset on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_HITS 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * read-only statistic, number of packet containers and packets
+ * that had to be newly allocated because the recycling pool
+ * had nothing suitable available.
+ * Reset on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_MISSES 4
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * read-only statistic, capacity (in events) new polarity packets
+ * are currently allocated with. This is predicted from a moving
+ * average of the number of polarity events per packet container,
+ * so that packets rarely need to grow while being filled, and rounded
+ * up to a power of two, so that recycled packets fit it most of the time.
+ * Supported by DAVIS, DVXplorer and Samsung EVK devices.
+ */
+#define CAER_HOST_CONFIG_PACKETS_POLARITY_SIZE_PREDICTED 5
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * read-only statistic, number of polarity events in the last
+ * committed packet container, to compare with the prediction.
+ * Supported by DAVIS, DVXplorer and Samsung EVK devices.
+ */
+#define CAER_HOST_CONFIG_PACKETS_POLARITY_SIZE_ACTUAL 6
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * deliver polarity events as POLARITY_SOA_EVENT packets, with
+ * separate timestamp, X, Y and polarity arrays, instead of as
+ * POLARITY_EVENT packets. They keep the same position in the
+ * packet container. See 'events/polarity.h' for their layout.
+ * Disabled by default. Supported by all devices with polarity events.
+ */
+#define CAER_HOST_CONFIG_PACKETS_POLARITY_SOA 7
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * set the maximum wall-clock time, in microseconds, events may be
+ * held back before their packet container is made available to the
+ * user, also if neither CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE
+ * nor CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_INTERVAL trigger a commit,
+ * as is the case for low event rates, where the device timestamps move
+ * forward only slowly. This is measured on the host clock, and checked
+ * after each buffer of data from the device is translated, and while
+ * no data arrives, at least every CAER_HOST_CONFIG_USB_EVENT_TIMEOUT
+ * for USB devices; lower that one as needed to match short latencies.
+ * Set to zero to disable (default). Takes effect right away.
+ * With raw replays, commits then depend on the replay timing too.
+ */
+#define CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY 8
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * first of the per-event-type size commit triggers. The parameter
+ * address CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE + type, with type
+ * being one of the event types from SPECIAL_EVENT to RAW_DATA_EVENT
+ * (see 'enum caer_default_event_types'), sets the number of events of
+ * that type a packet container may hold before it's made available to
+ * the user, independently of CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE,
+ * which applies to all types. One commits the container as soon as an
+ * event of that type is complete, like a DAVIS frame at its end, so
+ * that it's not held back by the batching of more frequent types.
+ * Set to zero to disable (default). Takes effect right away.
+ */
+#define CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE 16
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * first of the per-event-type time commit triggers. The parameter
+ * address CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL + type, with
+ * type as for CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE, sets the time
+ * interval in microseconds, in device time, after which a packet container
+ * holding events of that type is made available to the user, counting from
+ * the first such event in it, independently of CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_INTERVAL.
+ * Set to zero to disable (default). Takes effect right away.
+ */
+#define CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL 32
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_LOG:
@@ -116,6 +275,67 @@ typedef struct caer_device_handle *caerDeviceHandle;
  */
 #define CAER_HOST_CONFIG_LOG_LEVEL 0
 
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * read-only parameter, number of bytes received from the device
+ * (USB or serial port). Sample it periodically to get the data rate.
+ * This is a 64bit value, and should always be read using the
+ * function: caerDeviceConfigGet64().
+ */
+#define CAER_HOST_CONFIG_STATISTICS_TRANSFER_BYTES 0
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * read-only parameter, number of data transfers (USB or serial
+ * port reads) that returned data from the device.
+ * This is a 64bit value, and should always be read using the
+ * function: caerDeviceConfigGet64().
+ */
+#define CAER_HOST_CONFIG_STATISTICS_TRANSFERS_COMPLETED 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * read-only parameter, number of EventPacketContainers committed
+ * to the ring-buffer, ready for caerDeviceDataGet().
+ * This is a 64bit value, and should always be read using the
+ * function: caerDeviceConfigGet64().
+ */
+#define CAER_HOST_CONFIG_STATISTICS_CONTAINERS_COMMITTED 4
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * read-only parameter, number of EventPacketContainers dropped
+ * because the ring-buffer was full, with any drop policy
+ * (see CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY).
+ * This is a 64bit value, and should always be read using the
+ * function: caerDeviceConfigGet64().
+ */
+#define CAER_HOST_CONFIG_STATISTICS_CONTAINERS_DROPPED 6
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * read-only parameter, number of times an event packet had to be
+ * grown (reallocated) because it was too small for its events.
+ * This is a 64bit value, and should always be read using the
+ * function: caerDeviceConfigGet64().
+ */
+#define CAER_HOST_CONFIG_STATISTICS_PACKETS_GROWN 8
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * read-only parameter, number of EventPacketContainers currently
+ * waiting in the ring-buffer to be read. This is tracked lock-free,
+ * so it is approximate while containers are being taken out.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_RING_OCCUPANCY 10
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * read-only parameter, maximum number of EventPacketContainers that
+ * were waiting in the ring-buffer at the same time, since the last
+ * caerDeviceDataStart() or statistics reset.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_RING_OCCUPANCY_MAX 11
+/**
+ * Parameter address for module CAER_HOST_CONFIG_STATISTICS:
+ * set to true to reset all statistics counters to zero.
+ */
+#define CAER_HOST_CONFIG_STATISTICS_RESET 12
+
 /**
  * Close a previously opened device and invalidate its handle.
  *
@@ -253,6 +473,47 @@ LIBRARY_PUBLIC_VISIBILITY bool caerDeviceDataStop(caerDeviceHandle handle);
  */
 LIBRARY_PUBLIC_VISIBILITY caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle);
 
+/**
+ * Get up to maxContainers event packet containers at once, draining the data
+ * exchange buffer in a single pass. This is more efficient than repeatedly
+ * calling caerDeviceDataGet() when many containers are queued up.
+ * Memory ownership follows caerDeviceDataGet(): each returned container must
+ * be freed with caerEventPacketContainerFree().
+ * Blocking behavior follows CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING: if no
+ * container is available, blocking mode waits until at least one is.
+ * The dataNotifyDecrease() callback passed to caerDeviceDataStart() is called
+ * only once per returned batch, not once per container.
+ *
+ * @param handle a valid device handle.
+ * @param containers array of at least maxContainers elements, into which the
+ *                   returned containers are stored, in order.
+ * @param maxContainers maximum number of containers to return.
+ *
+ * @return number of containers stored in the array. Zero will be returned on errors,
+ *         such as exceptional device shutdown, or when there is no container available
+ *         in non-blocking mode.
+ */
+LIBRARY_PUBLIC_VISIBILITY size_t caerDeviceDataGetMany(
+	caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+
+/**
+ * Give a packet container obtained from caerDeviceDataGet() back to the device,
+ * so that its memory, and the memory of the packets it holds, can be reused
+ * for new data, instead of being freed and allocated anew.
+ * This is only effective if a recycling pool was enabled with
+ * CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_SIZE before caerDeviceDataStart().
+ * If the pool is disabled or full, the container is freed, so this
+ * can always be called in place of caerEventPacketContainerFree().
+ * The container and its packets must not be used anymore after this call.
+ * Must be called from the same thread that calls caerDeviceDataGet().
+ *
+ * @param handle a valid device handle.
+ * @param container a packet container previously obtained from this device.
+ *                  Packets can be removed from it (set to NULL) before giving
+ *                  it back, they will then not be reused.
+ */
+LIBRARY_PUBLIC_VISIBILITY void caerDeviceDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,23 @@ extern "C" {
  * read size for serial port communication.
  */
 #define CAER_HOST_CONFIG_SERIAL_READ_SIZE 0
+/**
+ * Parameter address for module CAER_HOST_CONFIG_SERIAL:
+ * CPU affinity mask of the serial communication thread, bit 0 being
+ * CPU 0, so CPUs 0-31 can be selected. Zero, the default, lets the
+ * thread run on all CPUs. Takes effect right away, also while running.
+ * Supported on Linux and Windows.
+ */
+#define CAER_HOST_CONFIG_SERIAL_THREAD_CPU_AFFINITY 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_SERIAL:
+ * real-time priority of the serial communication thread. Any value
+ * from 1 to 99 switches it to SCHED_FIFO real-time scheduling with that
+ * priority, clamped to the system's range; zero, the default, keeps the
+ * default scheduling policy. Takes effect right away, also while running.
+ * This usually requires elevated privileges (CAP_SYS_NICE on Linux).
+ */
+#define CAER_HOST_CONFIG_SERIAL_THREAD_REALTIME_PRIORITY 2
 
 /**
  * Parameter values for module CAER_HOST_CONFIG_SERIAL:
@@ -34,6 +34,120 @@ extern "C" {
  * them if you're running into I/O limits.
  */
 #define CAER_HOST_CONFIG_USB_BUFFER_SIZE 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * enable raw data pass-through. The USB data is not translated into
+ * events anymore: each completed USB buffer is handed over as is, inside
+ * a RAW_DATA_EVENT packet (see 'events/raw.h'), each in its own event
+ * packet container, and replaced by an empty one for the next transfer,
+ * so no data is copied or decoded on the USB thread. With packet container
+ * recycling enabled (see CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_SIZE), the
+ * recycling pool is filled with empty buffers on caerDeviceDataStart(),
+ * and containers given back with caerDeviceDataRecycle() are reused,
+ * so that no memory is allocated in the steady state.
+ * This is meant for capturing data at full bandwidth, to process it later.
+ * Only takes effect on the next caerDeviceDataStart() call.
+ * Disabled by default.
+ */
+#define CAER_HOST_CONFIG_USB_RAW_DATA 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * translate the USB data into events on a separate decode thread.
+ * Completed USB buffers are then queued for the decode thread and
+ * replaced right away, so the USB thread can resubmit transfers
+ * without waiting for their translation, which avoids data loss on
+ * the device side when translation is temporarily slow. This uses
+ * one more thread and some more memory for the queued buffers: the
+ * queue holds up to four times CAER_HOST_CONFIG_USB_BUFFER_NUMBER
+ * buffers, at least 256, so auto-tuning can't outgrow it. When it is
+ * full anyway, the USB thread only waits for space with the
+ * CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER drop policy, otherwise
+ * the new data is dropped (see CAER_HOST_CONFIG_USB_DECODE_QUEUE_DROPPED).
+ * Has no effect with raw data pass-through (CAER_HOST_CONFIG_USB_RAW_DATA).
+ * Only takes effect on the next caerDeviceDataStart() call.
+ * Disabled by default.
+ */
+#define CAER_HOST_CONFIG_USB_DECODE_THREAD 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * read-only statistic, number of USB buffers currently queued for,
+ * or being translated by, the decode thread (see CAER_HOST_CONFIG_USB_DECODE_THREAD).
+ */
+#define CAER_HOST_CONFIG_USB_DECODE_QUEUE_DEPTH 4
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * read-only statistic, maximum value reached by
+ * CAER_HOST_CONFIG_USB_DECODE_QUEUE_DEPTH. If this reaches the queue
+ * size, the USB thread had to wait for the decode thread, or drop data.
+ * Reset on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_USB_DECODE_QUEUE_DEPTH_MAX 5
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * read-only statistic, number of USB buffers whose data was dropped
+ * because the decode queue was full (see CAER_HOST_CONFIG_USB_DECODE_THREAD).
+ * Never happens with the CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER
+ * drop policy, where the USB thread waits instead.
+ * Reset on caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_USB_DECODE_QUEUE_DROPPED 6
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * CPU affinity mask of the threads handling the USB data: the USB
+ * thread, the decode thread (see CAER_HOST_CONFIG_USB_DECODE_THREAD)
+ * and, for raw replays, the replay thread. Bit 0 is CPU 0, so
+ * CPUs 0-31 can be selected. Zero, the default, lets the threads run
+ * on all CPUs. Takes effect right away, also while running.
+ * Supported on Linux and Windows.
+ */
+#define CAER_HOST_CONFIG_USB_THREAD_CPU_AFFINITY 7
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * real-time priority of the threads handling the USB data, the same
+ * ones as for CAER_HOST_CONFIG_USB_THREAD_CPU_AFFINITY. Any value from
+ * 1 to 99 switches them to SCHED_FIFO real-time scheduling with that priority,
+ * clamped to the system's range; zero, the default, keeps the default
+ * scheduling policy. Takes effect right away, also while running.
+ * This usually requires elevated privileges (CAP_SYS_NICE on Linux).
+ */
+#define CAER_HOST_CONFIG_USB_THREAD_REALTIME_PRIORITY 8
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * timeout in microseconds for each round of libusb event handling done
+ * by the USB thread. Completions end a round early, so this mostly bounds
+ * how fast configuration changes, shutdown and the packet container latency
+ * bound (CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY) are noticed while
+ * no data arrives. Zero makes the USB thread poll continuously, using a full CPU.
+ * Takes effect right away. Default is 10000 (10 ms).
+ */
+#define CAER_HOST_CONFIG_USB_EVENT_TIMEOUT 9
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * enable completion coalescing. The libusb callback of a data transfer
+ * only marks it as completed; once a round of event handling is done,
+ * all transfers completed during it are translated in completion order,
+ * one after the other, and then resubmitted together. Under many small
+ * transfers, this avoids switching between translation and libusb's
+ * own event handling for every single buffer, at the cost of buffers
+ * being resubmitted a bit later.
+ * Takes effect right away. Disabled by default.
+ */
+#define CAER_HOST_CONFIG_USB_COMPLETION_COALESCING 10
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * enable auto-tuning of the USB buffers. Every second, the USB thread
+ * looks at how full the completed buffers were: if at least half of
+ * them were completely full, data is piling up on the device, and the
+ * buffer size is doubled, or their number once the size reaches 256 KiB;
+ * if they were filled to 1/8 or less on average, the data rate is low,
+ * and the buffer size is halved, down to 1 KiB, and then their number,
+ * to keep latency and memory use low. A change only happens after three
+ * seconds in a row calling for it, and each is logged at INFO level.
+ * The current values can be read back with CAER_HOST_CONFIG_USB_BUFFER_NUMBER
+ * and CAER_HOST_CONFIG_USB_BUFFER_SIZE, which also set the starting point.
+ * Takes effect right away. Disabled by default.
+ */
+#define CAER_HOST_CONFIG_USB_BUFFER_AUTO_TUNE 11
 
 /**
  * Open a specified USB device, assign an ID to it and return a handle for further usage.
@@ -56,6 +170,54 @@ extern "C" {
 LIBRARY_PUBLIC_VISIBILITY caerDeviceHandle caerDeviceOpen(uint16_t deviceID, uint16_t deviceType,
 	uint8_t busNumberRestrict, uint8_t devAddressRestrict, const char *serialNumberRestrict);
 
+/**
+ * Open a raw USB data recording, made with caerDeviceRawRecordStart(), as an
+ * offline device. The recorded USB buffers are fed to the same event translator
+ * as the live device, so the usual data functions (caerDeviceDataStart(),
+ * caerDeviceDataGet() and so on) produce the same event packet containers,
+ * without any device attached.
+ * Device-side configuration is not available and fails, host-side configuration
+ * works normally. The data exchange drop policy defaults to
+ * CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER, so that no data is lost.
+ * When the end of the recording is reached, data acquisition stops and the
+ * dataShutdownNotify() callback passed to caerDeviceDataStart() is called,
+ * like on device disconnection. Each caerDeviceDataStart() call replays the
+ * recording from its beginning.
+ * Currently supported are: CAER_DEVICE_DVS128, CAER_DEVICE_DAVIS, CAER_DEVICE_DAVIS_FX2,
+ * CAER_DEVICE_DAVIS_FX3, CAER_DEVICE_DVXPLORER, CAER_DEVICE_SAMSUNG_EVK.
+ *
+ * @param deviceID a unique ID to identify the device from others. Will be used as the
+ *                 source for EventPackets being generated from its data.
+ * @param deviceType type of the device that was recorded, must match the recording.
+ * @param filePath path to the raw recording file.
+ * @param maxSpeed if true, replay as fast as possible; if false, pace the data
+ *                 following the wall-clock timing at which it was recorded.
+ *
+ * @return a valid device handle that can be used with the other libcaer functions,
+ *         or NULL on error. Always check for this! On error, errno is also set to
+ *         provide more precise information about the failure cause.
+ */
+LIBRARY_PUBLIC_VISIBILITY caerDeviceHandle caerDeviceRawReplayOpen(
+	uint16_t deviceID, uint16_t deviceType, const char *filePath, bool maxSpeed);
+
+/**
+ * Record the raw USB data buffers of the next data acquisition session,
+ * from caerDeviceDataStart() to caerDeviceDataStop(), to a file, together
+ * with the host-side state needed to translate them. The recording can then be
+ * replayed offline with caerDeviceRawReplayOpen().
+ * Must be called while data acquisition is stopped, just before
+ * caerDeviceDataStart(), as the device state is captured by this call.
+ * Recordings are stored in a fixed little-endian layout, so they replay on any
+ * host architecture, as long as the libcaer version records the same state.
+ * Supported devices are the same as for caerDeviceRawReplayOpen().
+ *
+ * @param handle a valid device handle.
+ * @param filePath path to the raw recording file, it is created or overwritten.
+ *
+ * @return true if recording was armed successfully, false otherwise.
+ */
+LIBRARY_PUBLIC_VISIBILITY bool caerDeviceRawRecordStart(caerDeviceHandle handle, const char *filePath);
+
 #ifdef __cplusplus
 }
 #endif
@@ -35,6 +35,141 @@ static inline void caerLogEHO(enum caer_log_level logLevel, const char *subSyste
 }
 #endif
 
+/**
+ * Memory allocator for event packets.
+ * All event packet memory is allocated, reallocated and freed through
+ * the allocator set with caerEventPacketAllocatorSet(), which by default
+ * uses the standard malloc(), calloc(), realloc() and free() functions.
+ * The functions are called concurrently from any thread that allocates
+ * or frees event packets, such as the data acquisition threads of devices,
+ * and must be thread-safe.
+ */
+struct caer_event_packet_allocator {
+	/// Allocate 'size' bytes of memory, all zeroed if 'zero' is true. Return NULL on failure.
+	void *(*allocate)(void *userData, size_t size, bool zero);
+	/// Resize 'memory' to 'size' bytes, keeping its content, like realloc(). 'memory' can be NULL.
+	/// Return NULL on failure, leaving 'memory' untouched.
+	void *(*reallocate)(void *userData, void *memory, size_t size);
+	/// Free 'memory', from any of the two functions above. 'memory' can be NULL.
+	void (*deallocate)(void *userData, void *memory);
+	/// User data pointer, passed as is to all the functions above.
+	void *userData;
+};
+
+#ifndef CAER_EVENTS_HEADER_ONLY
+/**
+ * Set the allocator used for all event packet memory, see
+ * 'struct caer_event_packet_allocator'. The allocator is copied.
+ * This is process-wide and not synchronized with allocations: it must
+ * be set before any event packet is allocated, usually at the start of
+ * the program, or changed only once all event packets have been freed.
+ * With any allocator other than the default one, event packets must be
+ * freed with caerEventPacketFree() (or caerEventPacketContainerFree()
+ * for whole containers), and not with free().
+ *
+ * @param allocator the allocator to use. NULL restores the default one.
+ */
+LIBRARY_PUBLIC_VISIBILITY void caerEventPacketAllocatorSet(const struct caer_event_packet_allocator *allocator);
+
+/**
+ * Get the allocator currently used for all event packet memory.
+ *
+ * @return a copy of the current allocator.
+ */
+LIBRARY_PUBLIC_VISIBILITY struct caer_event_packet_allocator caerEventPacketAllocatorGet(void);
+
+/**
+ * Allocate memory for an event packet with the current allocator.
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE GENERIC PACKET FUNCTIONS.
+ *
+ * @param size memory size in bytes.
+ * @param zero if true, the memory is all zeroed.
+ *
+ * @return the memory, NULL on error.
+ */
+LIBRARY_PUBLIC_VISIBILITY void *caerEventPacketMemoryAllocate(size_t size, bool zero);
+
+/**
+ * Resize event packet memory with the current allocator, like realloc().
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE GENERIC PACKET FUNCTIONS.
+ *
+ * @param memory current memory, can be NULL.
+ * @param size new memory size in bytes.
+ *
+ * @return the new memory, NULL on error. On failure, the old memory is not touched in any way.
+ */
+LIBRARY_PUBLIC_VISIBILITY void *caerEventPacketMemoryReallocate(void *memory, size_t size);
+
+/**
+ * Free event packet memory with the current allocator.
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE GENERIC PACKET FUNCTIONS.
+ *
+ * @param memory memory to free, can be NULL.
+ */
+LIBRARY_PUBLIC_VISIBILITY void caerEventPacketMemoryFree(void *memory);
+
+/**
+ * Built-in arena allocator for event packets.
+ * Memory is carved sequentially out of big regions, with a simple pointer
+ * bump, so that the packets of a container are laid out one after the other.
+ * Freed memory is not reused on its own: a region is given back to the system
+ * as a whole, once all packets in it have been freed and the arena has moved
+ * on to a new region. Packets kept around for long thus keep their whole region
+ * alive, so this suits the usual flow of packet containers being processed
+ * and freed in order.
+ * On Linux, regions can be backed by 2 MiB huge pages, to reduce TLB misses
+ * when going through the event data. If no huge pages are reserved on the
+ * system, transparent huge pages are requested for the regions instead.
+ */
+typedef struct caer_event_packet_arena *caerEventPacketArena;
+
+/**
+ * Create a new arena allocator, see 'caerEventPacketArena'.
+ * To use it for all event packets:
+ *   struct caer_event_packet_allocator allocator = caerEventPacketArenaAllocator(arena);
+ *   caerEventPacketAllocatorSet(&allocator);
+ *
+ * @param regionSize size of each region in bytes, rounded up to the page size
+ *                   (2 MiB with huge pages). Zero selects the default of 4 MiB.
+ *                   Packets bigger than half a region get their own region.
+ * @param hugePages back the regions with 2 MiB huge pages if possible.
+ *
+ * @return a new arena allocator, NULL on error.
+ */
+LIBRARY_PUBLIC_VISIBILITY caerEventPacketArena caerEventPacketArenaCreate(size_t regionSize, bool hugePages);
+
+/**
+ * Get the allocator functions of an arena, to be passed to caerEventPacketAllocatorSet().
+ *
+ * @param arena a valid arena allocator handle.
+ *
+ * @return the allocator functions of the arena.
+ */
+LIBRARY_PUBLIC_VISIBILITY struct caer_event_packet_allocator caerEventPacketArenaAllocator(caerEventPacketArena arena);
+
+/**
+ * Destroy an arena allocator. It must not be the current allocator anymore,
+ * see caerEventPacketAllocatorSet(). Event packets still allocated from it stay
+ * valid and must still be freed with caerEventPacketFree(), the memory of the
+ * arena is fully released once the last of them is freed.
+ *
+ * @param arena a valid arena allocator handle. NULL is ignored.
+ */
+LIBRARY_PUBLIC_VISIBILITY void caerEventPacketArenaDestroy(caerEventPacketArena arena);
+#else
+static inline void *caerEventPacketMemoryAllocate(size_t size, bool zero) {
+	return ((zero) ? (calloc(1, size)) : (malloc(size)));
+}
+
+static inline void *caerEventPacketMemoryReallocate(void *memory, size_t size) {
+	return (realloc(memory, size));
+}
+
+static inline void caerEventPacketMemoryFree(void *memory) {
+	free(memory);
+}
+#endif
+
 /**
  * Generic validity mark:
  * this bit is used to mark whether an event is still
@@ -70,28 +205,34 @@ static inline void caerLogEHO(enum caer_log_level logLevel, const char *subSyste
  * DO NOT USE THEM FOR YOUR OWN EVENT TYPES!
  */
 enum caer_default_event_types {
-	SPECIAL_EVENT   = 0,  //!< Special events.
-	POLARITY_EVENT  = 1,  //!< Polarity (change, DVS) events.
-	FRAME_EVENT     = 2,  //!< Frame (intensity, APS) events.
-	IMU6_EVENT      = 3,  //!< 6 axes IMU events.
-	IMU9_EVENT      = 4,  //!< 9 axes IMU events.
-	SAMPLE_EVENT    = 5,  //!< ADC sample events (deprecated).
-	EAR_EVENT       = 6,  //!< Ear (cochlea) events (deprecated).
-	CONFIG_EVENT    = 7,  //!< Device configuration events (deprecated).
-	POINT1D_EVENT   = 8,  //!< 1D measurement events (deprecated).
-	POINT2D_EVENT   = 9,  //!< 2D measurement events (deprecated).
-	POINT3D_EVENT   = 10, //!< 3D measurement events (deprecated).
-	POINT4D_EVENT   = 11, //!< 4D measurement events (deprecated).
-	SPIKE_EVENT     = 12, //!< Spike events.
-	MATRIX4x4_EVENT = 13, //!< 4D matrix events (deprecated).
+	SPECIAL_EVENT      = 0,  //!< Special events.
+	POLARITY_EVENT     = 1,  //!< Polarity (change, DVS) events.
+	FRAME_EVENT        = 2,  //!< Frame (intensity, APS) events.
+	IMU6_EVENT         = 3,  //!< 6 axes IMU events.
+	IMU9_EVENT         = 4,  //!< 9 axes IMU events.
+	SAMPLE_EVENT       = 5,  //!< ADC sample events (deprecated).
+	EAR_EVENT          = 6,  //!< Ear (cochlea) events (deprecated).
+	CONFIG_EVENT       = 7,  //!< Device configuration events (deprecated).
+	POINT1D_EVENT      = 8,  //!< 1D measurement events (deprecated).
+	POINT2D_EVENT      = 9,  //!< 2D measurement events (deprecated).
+	POINT3D_EVENT      = 10, //!< 3D measurement events (deprecated).
+	POINT4D_EVENT      = 11, //!< 4D measurement events (deprecated).
+	SPIKE_EVENT        = 12, //!< Spike events.
+	MATRIX4x4_EVENT    = 13, //!< 4D matrix events (deprecated).
+	POLARITY_SOA_EVENT = 14, //!< Polarity events, stored as structure-of-arrays.
+	RAW_DATA_EVENT     = 15, //!< Raw device data, as received (no timestamps).
 };
 
 /**
  * Number of default event types that are part of libcaer.
  * Corresponds to the count of definitions inside the
  * 'enum caer_default_event_types' enumeration.
+ * Raised from 14 to 15 with the addition of POLARITY_SOA_EVENT, and from 15
+ * to 16 with RAW_DATA_EVENT: these are ABI changes, code compiled against older
+ * headers treats the new types as unknown, and must be rebuilt if it sizes
+ * per-type tables with this value.
  */
-#define CAER_DEFAULT_EVENT_TYPES_COUNT 14
+#define CAER_DEFAULT_EVENT_TYPES_COUNT 16
 
 /**
  * Size of the EventPacket header.
@@ -394,6 +535,152 @@ static inline void caerEventPacketHeaderSetEventValid(caerEventPacketHeader head
 	header->eventValid = I32T(htole32(U32T(eventsValid)));
 }
 
+/**
+ * Check if all the events in this packet are valid (dense packet),
+ * which is the case when the number of valid events equals the
+ * number of events. Packets generated by devices are dense, until
+ * some processing invalidates events in them.
+ * This is always up-to-date with the event counters, so there is
+ * no separate flag to maintain. The valid iterators use it to
+ * skip checking the valid mark of every single event.
+ *
+ * @param header a valid EventPacket header pointer. Cannot be NULL.
+ *
+ * @return true if all events are valid, false otherwise.
+ */
+static inline bool caerEventPacketHeaderIsDense(caerEventPacketHeaderConst header) {
+	return (caerEventPacketHeaderGetEventValid(header) == caerEventPacketHeaderGetEventNumber(header));
+}
+
+/**
+ * Structure-of-arrays (SoA) event packets, such as POLARITY_SOA_EVENT ones,
+ * don't store their events one after the other. Each event field has its own
+ * array instead, sized to the packet's event capacity, and the arrays follow
+ * each other in memory. The event size is the sum of the field sizes, so the
+ * memory size of a packet is computed the same way as for all other types.
+ * SoA packets only hold valid events (eventValid is always equal to eventNumber),
+ * and their first array holds the 32 bit timestamps, with an eventTSOffset of 0:
+ * the generic event functions point into it, so that the timestamps can still
+ * be queried without knowing the event type. All generic packet functions,
+ * like caerEventPacketGrow() or caerEventPacketCopy(), support this layout.
+ *
+ * @param eventType the numerical event type (see 'enum caer_default_event_types').
+ * @param fieldSizes if not NULL, set to the size in bytes of each field, in memory order.
+ *
+ * @return the number of fields of a SoA event type, zero for all other event types.
+ */
+static inline size_t caerEventTypeGetSoAFields(int16_t eventType, const uint8_t **fieldSizes) {
+	// Timestamp, X address, Y address, polarity.
+	static const uint8_t polaritySoAFieldSizes[] = {4, 2, 2, 1};
+
+	if (eventType == POLARITY_SOA_EVENT) {
+		if (fieldSizes != NULL) {
+			*fieldSizes = polaritySoAFieldSizes;
+		}
+
+		return (sizeof(polaritySoAFieldSizes));
+	}
+
+	return (0);
+}
+
+/**
+ * Check if an EventPacket uses the structure-of-arrays layout.
+ * See caerEventTypeGetSoAFields() for more details.
+ *
+ * @param header a valid EventPacket header pointer. Cannot be NULL.
+ *
+ * @return true for structure-of-arrays packets, false otherwise.
+ */
+static inline bool caerEventPacketHeaderIsSoA(caerEventPacketHeaderConst header) {
+	return (caerEventTypeGetSoAFields(caerEventPacketHeaderGetEventType(header), NULL) != 0);
+}
+
+/**
+ * Copy events, field by field, between the memory of two structure-of-arrays packets:
+ * 'eventsNumber' events from the start of 'source', laid out for 'sourceCapacity' events,
+ * to 'destinationPosition' in 'destination', laid out for 'destinationCapacity' events.
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE GENERIC PACKET FUNCTIONS.
+ */
+static inline void caerEventPacketSoACopyEvents(int16_t eventType, uint8_t *destination, int32_t destinationCapacity,
+	int32_t destinationPosition, const uint8_t *source, int32_t sourceCapacity, int32_t eventsNumber) {
+	const uint8_t *fieldSizes = NULL;
+	size_t fieldsNumber       = caerEventTypeGetSoAFields(eventType, &fieldSizes);
+	size_t fieldOffset        = 0; // Sum of the sizes of the fields before the current one.
+
+	for (size_t i = 0; i < fieldsNumber; i++) {
+		memcpy(destination + (fieldOffset * (size_t) destinationCapacity)
+				   + ((size_t) destinationPosition * fieldSizes[i]),
+			source + (fieldOffset * (size_t) sourceCapacity), (size_t) eventsNumber * fieldSizes[i]);
+
+		fieldOffset += fieldSizes[i];
+	}
+}
+
+/**
+ * Zero out the events from 'startPosition' to 'endPosition' (excluded), in
+ * all the field arrays of structure-of-arrays packet memory, laid out for
+ * 'eventCapacity' events.
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE GENERIC PACKET FUNCTIONS.
+ */
+static inline void caerEventPacketSoAZeroEvents(
+	int16_t eventType, uint8_t *events, int32_t eventCapacity, int32_t startPosition, int32_t endPosition) {
+	const uint8_t *fieldSizes = NULL;
+	size_t fieldsNumber       = caerEventTypeGetSoAFields(eventType, &fieldSizes);
+	size_t fieldOffset        = 0;
+
+	for (size_t i = 0; i < fieldsNumber; i++) {
+		memset(events + (fieldOffset * (size_t) eventCapacity) + ((size_t) startPosition * fieldSizes[i]), 0,
+			(size_t) (endPosition - startPosition) * fieldSizes[i]);
+
+		fieldOffset += fieldSizes[i];
+	}
+}
+
+/**
+ * Free an event packet, of any type, and all its memory.
+ * This always works, while free() only does with the default allocator,
+ * see caerEventPacketAllocatorSet().
+ *
+ * @param packet the event packet to free. NULL is ignored.
+ */
+static inline void caerEventPacketFree(caerEventPacketHeader packet) {
+	caerEventPacketMemoryFree(packet);
+}
+
+/**
+ * Move a structure-of-arrays packet to new memory, laid out for 'newEventCapacity'
+ * events, keeping its first 'eventsKept' events and zeroing out all others.
+ * The arrays all change place, so this can't be done in place with realloc().
+ * The header is copied unchanged, the caller has to update it.
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE GENERIC PACKET FUNCTIONS.
+ *
+ * @return the new packet memory, NULL on error. On success, the old packet memory
+ *         has been freed. On failure, it is not touched in any way.
+ */
+static inline caerEventPacketHeader caerEventPacketSoAReallocate(
+	caerEventPacketHeader packet, int32_t newEventCapacity, int32_t eventsKept) {
+	int16_t eventType = caerEventPacketHeaderGetEventType(packet);
+
+	caerEventPacketHeader newPacket = (caerEventPacketHeader) caerEventPacketMemoryAllocate(
+		CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (newEventCapacity * caerEventPacketHeaderGetEventSize(packet)), false);
+	if (newPacket == NULL) {
+		return (NULL);
+	}
+
+	memcpy(newPacket, packet, CAER_EVENT_PACKET_HEADER_SIZE);
+
+	caerEventPacketSoACopyEvents(eventType, ((uint8_t *) newPacket) + CAER_EVENT_PACKET_HEADER_SIZE,
+		newEventCapacity, 0, ((const uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE,
+		caerEventPacketHeaderGetEventCapacity(packet), eventsKept);
+	caerEventPacketSoAZeroEvents(eventType, ((uint8_t *) newPacket) + CAER_EVENT_PACKET_HEADER_SIZE,
+		newEventCapacity, eventsKept, newEventCapacity);
+
+	caerEventPacketFree(packet);
+
+	return (newPacket);
+}
+
 /**
  * Get a generic pointer to an event, without having to know what event
  * type the packet is containing.
@@ -405,7 +692,8 @@ static inline void caerEventPacketHeaderSetEventValid(caerEventPacketHeader head
  *         This points to unmodifiable memory, as it should never be used for anything
  *         other than read operations, such as caerGenericEventGetTimestamp(). Don't
  *         modify the memory, you have no idea what it is! If you do know, just use the
- *         proper typed packet functions.
+ *         proper typed packet functions. For structure-of-arrays packets, this
+ *         points to the event's timestamp (see caerEventTypeGetSoAFields()).
  */
 static inline const void *caerGenericEventGetEvent(caerEventPacketHeaderConst headerPtr, int32_t n) {
 	// Check that we're not out of bounds.
@@ -421,9 +709,16 @@ static inline const void *caerGenericEventGetEvent(caerEventPacketHeaderConst he
 		return (NULL);
 	}
 
+	// Structure-of-arrays packets: point into the first array, the timestamps one.
+	const uint8_t *fieldSizes = NULL;
+	int32_t eventStride       = caerEventPacketHeaderGetEventSize(headerPtr);
+
+	if (caerEventTypeGetSoAFields(caerEventPacketHeaderGetEventType(headerPtr), &fieldSizes) != 0) {
+		eventStride = fieldSizes[0];
+	}
+
 	// Return a pointer to the specified event.
-	return (((const uint8_t *) headerPtr)
-			+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(headerPtr))));
+	return (((const uint8_t *) headerPtr) + (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * eventStride)));
 }
 
 /**
@@ -490,6 +785,11 @@ static inline bool caerGenericEventCopy(void *eventPtrDestination, const void *e
 		return (false);
 	}
 
+	// The fields of structure-of-arrays events are not reachable from a single pointer.
+	if (caerEventPacketHeaderIsSoA(headerPtrSource)) {
+		return (false);
+	}
+
 	memcpy(eventPtrDestination, eventPtrSource, (size_t) caerEventPacketHeaderGetEventSize(headerPtrDestination));
 	return (true);
 }
@@ -526,9 +826,9 @@ static inline bool caerGenericEventCopy(void *eventPtrDestination, const void *e
 	for (int32_t caerIteratorCounter = 0; caerIteratorCounter < caerEventPacketHeaderGetEventNumber(PACKET_HEADER); \
 		 caerIteratorCounter++) {                                                                                   \
 		EVENT_TYPE caerIteratorElement = (EVENT_TYPE) caerGenericEventGetEvent(PACKET_HEADER, caerIteratorCounter); \
-		if (!caerGenericEventIsValid(caerIteratorElement)) {                                                        \
+		if (!caerEventPacketHeaderIsDense(PACKET_HEADER) && !caerGenericEventIsValid(caerIteratorElement)) {       \
 			continue;                                                                                               \
-		} // Skip invalid events.
+		} // Skip invalid events. Structure-of-arrays packets are always dense.
 
 /**
  * Generic iterator close statement.
@@ -616,6 +916,28 @@ static inline bool caerEventPacketEquals(
 		return (false);
 	}
 
+	// Structure-of-arrays packets: compare each field's array up to eventNumber.
+	const uint8_t *fieldSizes = NULL;
+	size_t fieldsNumber = caerEventTypeGetSoAFields(caerEventPacketHeaderGetEventType(firstPacket), &fieldSizes);
+
+	if (fieldsNumber != 0) {
+		size_t eventCapacity = (size_t) caerEventPacketHeaderGetEventCapacity(firstPacket);
+		size_t eventNumber   = (size_t) caerEventPacketHeaderGetEventNumber(firstPacket);
+		size_t fieldOffset   = CAER_EVENT_PACKET_HEADER_SIZE;
+
+		for (size_t i = 0; i < fieldsNumber; i++) {
+			if (memcmp(((const uint8_t *) firstPacket) + fieldOffset, ((const uint8_t *) secondPacket) + fieldOffset,
+					eventNumber * fieldSizes[i])
+				!= 0) {
+				return (false);
+			}
+
+			fieldOffset += eventCapacity * fieldSizes[i];
+		}
+
+		return (true);
+	}
+
 	size_t memCmpSize
 		= (size_t) (caerEventPacketHeaderGetEventNumber(firstPacket) * caerEventPacketHeaderGetEventSize(firstPacket));
 	if (memcmp(((const uint8_t *) firstPacket) + CAER_EVENT_PACKET_HEADER_SIZE,
@@ -642,9 +964,16 @@ static inline void caerEventPacketClear(caerEventPacketHeader packet) {
 	// Set events up to eventNumber to zero. The remaining events up to
 	// eventCapacity are by definition all zeroed out, so nothing to do
 	// there. Also reset the eventValid and eventNumber header fields.
-	size_t memZeroSize
-		= (size_t) (caerEventPacketHeaderGetEventNumber(packet) * caerEventPacketHeaderGetEventSize(packet));
-	memset(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, 0, memZeroSize);
+	if (caerEventPacketHeaderIsSoA(packet)) {
+		caerEventPacketSoAZeroEvents(caerEventPacketHeaderGetEventType(packet),
+			((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, caerEventPacketHeaderGetEventCapacity(packet), 0,
+			caerEventPacketHeaderGetEventNumber(packet));
+	}
+	else {
+		size_t memZeroSize
+			= (size_t) (caerEventPacketHeaderGetEventNumber(packet) * caerEventPacketHeaderGetEventSize(packet));
+		memset(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, 0, memZeroSize);
+	}
 
 	caerEventPacketHeaderSetEventValid(packet, 0);
 	caerEventPacketHeaderSetEventNumber(packet, 0);
@@ -701,7 +1030,7 @@ caerEventPacketHeaderSetEventNumber(packet, eventValid);
  * - If the new capacity is bigger, the packet is enlarged and the new events
  *   are initialized to all zeros (invalid).
  * - If the new capacity is smaller, the packet is truncated at the given point.
- * Use free() to reclaim this memory afterwards.
+ * Use caerEventPacketFree() to reclaim this memory afterwards.
  *
  * @param packet the current event packet.
  * @param newEventCapacity the new maximum number of events this packet can hold.
@@ -729,9 +1058,19 @@ static inline caerEventPacketHeader caerEventPacketResize(caerEventPacketHeader
 
 	int32_t eventSize         = caerEventPacketHeaderGetEventSize(packet);
 	size_t newEventPacketSize = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (newEventCapacity * eventSize);
+	bool isSoA                = caerEventPacketHeaderIsSoA(packet);
 
 	// Reallocate memory used to hold events.
-	packet = (caerEventPacketHeader) realloc(packet, newEventPacketSize);
+	if (isSoA) {
+		int32_t eventNumber = caerEventPacketHeaderGetEventNumber(packet);
+
+		packet = caerEventPacketSoAReallocate(
+			packet, newEventCapacity, (eventNumber < newEventCapacity) ? (eventNumber) : (newEventCapacity));
+	}
+	else {
+		packet = (caerEventPacketHeader) caerEventPacketMemoryReallocate(packet, newEventPacketSize);
+	}
+
 	if (packet == NULL) {
 		caerLogEHO(CAER_LOG_CRITICAL, "Event Packet",
 			"Failed to reallocate %zu bytes of memory for resizing Event Packet of capacity %" PRIi32
@@ -742,10 +1081,13 @@ static inline caerEventPacketHeader caerEventPacketResize(caerEventPacketHeader
 
 	if (newEventCapacity > oldEventCapacity) {
 		// Capacity increased: we simply zero out the newly added events.
-		size_t oldEventPacketSize = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (oldEventCapacity * eventSize);
+		// Structure-of-arrays packets were already zeroed on reallocation.
+		if (!isSoA) {
+			size_t oldEventPacketSize = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (oldEventCapacity * eventSize);
 
-		memset(
-			((uint8_t *) packet) + oldEventPacketSize, 0, (size_t) ((newEventCapacity - oldEventCapacity) * eventSize));
+			memset(((uint8_t *) packet) + oldEventPacketSize, 0,
+				(size_t) ((newEventCapacity - oldEventCapacity) * eventSize));
+		}
 	}
 	else {
 		// Capacity decreased: the events were cleaned, so eventValid == eventNumber.
@@ -770,7 +1112,7 @@ static inline caerEventPacketHeader caerEventPacketResize(caerEventPacketHeader
  * Grows an event packet.
  * This only supports strictly increasing the size of a packet.
  * For a more flexible resize operation, see caerEventPacketResize().
- * Use free() to reclaim this memory afterwards.
+ * Use caerEventPacketFree() to reclaim this memory afterwards.
  *
  * @param packet the current event packet.
  * @param newEventCapacity the new maximum number of events this packet can hold.
@@ -799,8 +1141,16 @@ static inline caerEventPacketHeader caerEventPacketGrow(caerEventPacketHeader pa
 	int32_t eventSize         = caerEventPacketHeaderGetEventSize(packet);
 	size_t newEventPacketSize = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (newEventCapacity * eventSize);
 
+	bool isSoA = caerEventPacketHeaderIsSoA(packet);
+
 	// Grow memory used to hold events.
-	packet = (caerEventPacketHeader) realloc(packet, newEventPacketSize);
+	if (isSoA) {
+		packet = caerEventPacketSoAReallocate(packet, newEventCapacity, caerEventPacketHeaderGetEventNumber(packet));
+	}
+	else {
+		packet = (caerEventPacketHeader) caerEventPacketMemoryReallocate(packet, newEventPacketSize);
+	}
+
 	if (packet == NULL) {
 		caerLogEHO(CAER_LOG_CRITICAL, "Event Packet",
 			"Failed to reallocate %zu bytes of memory for growing Event Packet of capacity %" PRIi32
@@ -810,9 +1160,13 @@ static inline caerEventPacketHeader caerEventPacketGrow(caerEventPacketHeader pa
 	}
 
 	// Zero out new event memory (all events invalid).
-	size_t oldEventPacketSize = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (oldEventCapacity * eventSize);
+	// Structure-of-arrays packets were already zeroed on reallocation.
+	if (!isSoA) {
+		size_t oldEventPacketSize = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (oldEventCapacity * eventSize);
 
-	memset(((uint8_t *) packet) + oldEventPacketSize, 0, (size_t) ((newEventCapacity - oldEventCapacity) * eventSize));
+		memset(
+			((uint8_t *) packet) + oldEventPacketSize, 0, (size_t) ((newEventCapacity - oldEventCapacity) * eventSize));
+	}
 
 	// Update capacity header field.
 	caerEventPacketHeaderSetEventCapacity(packet, newEventCapacity);
@@ -824,7 +1178,7 @@ static inline caerEventPacketHeader caerEventPacketGrow(caerEventPacketHeader pa
  * Appends an event packet to another.
  * This is a simple append operation, no timestamp reordering is done.
  * Please ensure time is monotonically increasing over the two packets!
- * Use free() to reclaim this memory afterwards.
+ * Use caerEventPacketFree() to reclaim this memory afterwards.
  *
  * @param packet the main events packet.
  * @param appendPacket the events packet to append on the main one.
@@ -864,8 +1218,17 @@ static inline caerEventPacketHeader caerEventPacketAppend(
 	size_t newEventPacketSize
 		= CAER_EVENT_PACKET_HEADER_SIZE + (size_t) ((packetEventCapacity + appendPacketEventCapacity) * eventSize);
 
+	bool isSoA = caerEventPacketHeaderIsSoA(packet);
+
 	// Grow memory used to hold events.
-	packet = (caerEventPacketHeader) realloc(packet, newEventPacketSize);
+	if (isSoA) {
+		packet
+			= caerEventPacketSoAReallocate(packet, packetEventCapacity + appendPacketEventCapacity, packetEventNumber);
+	}
+	else {
+		packet = (caerEventPacketHeader) caerEventPacketMemoryReallocate(packet, newEventPacketSize);
+	}
+
 	if (packet == NULL) {
 		caerLogEHO(CAER_LOG_CRITICAL, "Event Packet",
 			"Failed to reallocate %zu bytes of memory for appending Event Packet of capacity %" PRIi32
@@ -874,16 +1237,26 @@ static inline caerEventPacketHeader caerEventPacketAppend(
 		return (NULL);
 	}
 
-	// Copy appendPacket event memory at start of free space in packet.
-	memcpy(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE + (packetEventNumber * eventSize),
-		((uint8_t *) appendPacket) + CAER_EVENT_PACKET_HEADER_SIZE, (size_t) (appendPacketEventNumber * eventSize));
-
-	// Zero out remaining event memory (all events invalid).
-	memset(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE
-			   + ((packetEventNumber + appendPacketEventNumber) * eventSize),
-		0,
-		(size_t) (((packetEventCapacity + appendPacketEventCapacity) - (packetEventNumber + appendPacketEventNumber))
-				  * eventSize));
+	if (isSoA) {
+		// Copy appendPacket arrays after the packet's events, the rest was already zeroed.
+		caerEventPacketSoACopyEvents(caerEventPacketHeaderGetEventType(packet),
+			((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, packetEventCapacity + appendPacketEventCapacity,
+			packetEventNumber, ((const uint8_t *) appendPacket) + CAER_EVENT_PACKET_HEADER_SIZE,
+			appendPacketEventCapacity, appendPacketEventNumber);
+	}
+	else {
+		// Copy appendPacket event memory at start of free space in packet.
+		memcpy(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE + (packetEventNumber * eventSize),
+			((uint8_t *) appendPacket) + CAER_EVENT_PACKET_HEADER_SIZE, (size_t) (appendPacketEventNumber * eventSize));
+
+		// Zero out remaining event memory (all events invalid).
+		memset(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE
+				   + ((packetEventNumber + appendPacketEventNumber) * eventSize),
+			0,
+			(size_t) (((packetEventCapacity + appendPacketEventCapacity)
+						  - (packetEventNumber + appendPacketEventNumber))
+					  * eventSize));
+	}
 
 	// Update header fields.
 	caerEventPacketHeaderSetEventValid(packet, (packetEventValid + appendPacketEventValid));
@@ -913,8 +1286,13 @@ static inline caerEventPacketHeader caerEventPacketCopy(caerEventPacketHeaderCon
 	size_t packetMem      = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (eventSize * eventCapacity);
 	size_t dataMem        = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (eventSize * eventNumber);
 
+	// Structure-of-arrays packets have data spread over all their memory.
+	if (caerEventPacketHeaderIsSoA(packet)) {
+		dataMem = packetMem;
+	}
+
 	// Allocate memory for new event packet.
-	caerEventPacketHeader packetCopy = (caerEventPacketHeader) malloc(packetMem);
+	caerEventPacketHeader packetCopy = (caerEventPacketHeader) caerEventPacketMemoryAllocate(packetMem, false);
 	if (packetCopy == NULL) {
 		// Failed to allocate memory.
 		return (NULL);
@@ -956,14 +1334,25 @@ static inline caerEventPacketHeader caerEventPacketCopyOnlyEvents(caerEventPacke
 	size_t packetMem = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (eventSize * eventNumber);
 
 	// Allocate memory for new event packet.
-	caerEventPacketHeader packetCopy = (caerEventPacketHeader) malloc(packetMem);
+	caerEventPacketHeader packetCopy = (caerEventPacketHeader) caerEventPacketMemoryAllocate(packetMem, false);
 	if (packetCopy == NULL) {
 		// Failed to allocate memory.
 		return (NULL);
 	}
 
 	// Copy the data over.
-	memcpy(packetCopy, packet, packetMem);
+	if (caerEventPacketHeaderIsSoA(packet)) {
+		// Structure-of-arrays packets: each array shrinks to the event number.
+		memcpy(packetCopy, packet, CAER_EVENT_PACKET_HEADER_SIZE);
+
+		caerEventPacketSoACopyEvents(caerEventPacketHeaderGetEventType(packet),
+			((uint8_t *) packetCopy) + CAER_EVENT_PACKET_HEADER_SIZE, eventNumber, 0,
+			((const uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, caerEventPacketHeaderGetEventCapacity(packet),
+			eventNumber);
+	}
+	else {
+		memcpy(packetCopy, packet, packetMem);
+	}
 
 	// Set the event capacity to the event number, since we only allocated
 	// memory for that many events.
@@ -986,6 +1375,11 @@ static inline caerEventPacketHeader caerEventPacketCopyOnlyValidEvents(caerEvent
 		return (NULL);
 	}
 
+	// Structure-of-arrays packets only ever contain valid events.
+	if (caerEventPacketHeaderIsSoA(packet)) {
+		return (caerEventPacketCopyOnlyEvents(packet));
+	}
+
 	// Calculate needed memory for new event packet.
 	int32_t eventSize  = caerEventPacketHeaderGetEventSize(packet);
 	int32_t eventValid = caerEventPacketHeaderGetEventValid(packet);
@@ -998,7 +1392,7 @@ static inline caerEventPacketHeader caerEventPacketCopyOnlyValidEvents(caerEvent
 	size_t packetMem = CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (eventSize * eventValid);
 
 	// Allocate memory for new event packet.
-	caerEventPacketHeader packetCopy = (caerEventPacketHeader) malloc(packetMem);
+	caerEventPacketHeader packetCopy = (caerEventPacketHeader) caerEventPacketMemoryAllocate(packetMem, false);
 	if (packetCopy == NULL) {
 		// Failed to allocate memory.
 		return (NULL);
@@ -1041,7 +1435,7 @@ static inline caerEventPacketHeader caerEventPacketAllocate(int32_t eventCapacit
 	size_t eventPacketSize = CAER_EVENT_PACKET_HEADER_SIZE + ((size_t) eventCapacity * (size_t) eventSize);
 
 	// Zero out event memory (all events invalid).
-	caerEventPacketHeader packet = (caerEventPacketHeader) calloc(1, eventPacketSize);
+	caerEventPacketHeader packet = (caerEventPacketHeader) caerEventPacketMemoryAllocate(eventPacketSize, true);
 	if (packet == NULL) {
 		caerLogEHO(CAER_LOG_CRITICAL, "Event Packet",
 			"Failed to allocate %zu bytes of memory for Event Packet of type %" PRIi16 ", capacity %" PRIi32
@@ -138,7 +138,7 @@ typedef const struct caer_frame_event_packet *caerFrameEventPacketConst;
 /**
  * Allocate a new frame events packet, passing the total number of maximum
  * pixels instead of the maximum X/Y dimensions expected.
- * Use free() to reclaim this memory.
+ * Use caerEventPacketFree() to reclaim this memory.
  * The frame events allocate memory for a maximum sized pixels array, depending
  * on the parameters passed to this function, so that every event occupies the
  * same amount of memory (constant size). The actual frames inside of it
@@ -170,7 +170,7 @@ static inline caerFrameEventPacket caerFrameEventPacketAllocateNumPixels(
 
 /**
  * Allocate a new frame events packet.
- * Use free() to reclaim this memory.
+ * Use caerEventPacketFree() to reclaim this memory.
  * The frame events allocate memory for a maximum sized pixels array, depending
  * on the parameters passed to this function, so that every event occupies the
  * same amount of memory (constant size). The actual frames inside of it
@@ -1134,7 +1134,8 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 		 caerFrameIteratorCounter++) {                                                                  \
 		caerFrameEvent caerFrameIteratorElement                                                         \
 			= caerFrameEventPacketGetEvent(FRAME_PACKET, caerFrameIteratorCounter);                     \
-		if (!caerFrameEventIsValid(caerFrameIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(FRAME_PACKET)->packetHeader)                                \
+			&& !caerFrameEventIsValid(caerFrameIteratorElement)) {                                      \
 			continue;                                                                                   \
 		} // Skip invalid frame events.
 
@@ -1152,7 +1153,8 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 		 caerFrameIteratorCounter++) {                                                                  \
 		caerFrameEventConst caerFrameIteratorElement                                                    \
 			= caerFrameEventPacketGetEventConst(FRAME_PACKET, caerFrameIteratorCounter);                \
-		if (!caerFrameEventIsValid(caerFrameIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(FRAME_PACKET)->packetHeader)                                \
+			&& !caerFrameEventIsValid(caerFrameIteratorElement)) {                                      \
 			continue;                                                                                   \
 		} // Skip invalid frame events.
 
@@ -1205,7 +1207,8 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 		 caerFrameIteratorCounter >= 0; caerFrameIteratorCounter--) {                                               \
 		caerFrameEvent caerFrameIteratorElement                                                                     \
 			= caerFrameEventPacketGetEvent(FRAME_PACKET, caerFrameIteratorCounter);                                 \
-		if (!caerFrameEventIsValid(caerFrameIteratorElement)) {                                                     \
+		if (!caerEventPacketHeaderIsDense(&(FRAME_PACKET)->packetHeader)                                            \
+			&& !caerFrameEventIsValid(caerFrameIteratorElement)) {                                                  \
 			continue;                                                                                               \
 		} // Skip invalid frame events.
 
@@ -1222,7 +1225,8 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 		 caerFrameIteratorCounter >= 0; caerFrameIteratorCounter--) {                                               \
 		caerFrameEventConst caerFrameIteratorElement                                                                \
 			= caerFrameEventPacketGetEventConst(FRAME_PACKET, caerFrameIteratorCounter);                            \
-		if (!caerFrameEventIsValid(caerFrameIteratorElement)) {                                                     \
+		if (!caerEventPacketHeaderIsDense(&(FRAME_PACKET)->packetHeader)                                            \
+			&& !caerFrameEventIsValid(caerFrameIteratorElement)) {                                                  \
 			continue;                                                                                               \
 		} // Skip invalid frame events.
 
@@ -77,7 +77,7 @@ typedef const struct caer_imu6_event_packet *caerIMU6EventPacketConst;
 
 /**
  * Allocate a new IMU 6-axes events packet.
- * Use free() to reclaim this memory.
+ * Use caerEventPacketFree() to reclaim this memory.
  *
  * @param eventCapacity the maximum number of events this packet will hold.
  * @param eventSource the unique ID representing the source/generator of this packet.
@@ -483,7 +483,8 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 		 caerIMU6IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader);              \
 		 caerIMU6IteratorCounter++) {                                                                              \
 		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEvent(IMU6_PACKET, caerIMU6IteratorCounter); \
-		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                                      \
+		if (!caerEventPacketHeaderIsDense(&(IMU6_PACKET)->packetHeader)                                            \
+			&& !caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                                   \
 			continue;                                                                                              \
 		} // Skip invalid IMU6 events.
 
@@ -501,7 +502,8 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 		 caerIMU6IteratorCounter++) {                                                                 \
 		caerIMU6EventConst caerIMU6IteratorElement                                                    \
 			= caerIMU6EventPacketGetEventConst(IMU6_PACKET, caerIMU6IteratorCounter);                 \
-		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(IMU6_PACKET)->packetHeader)                               \
+			&& !caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                      \
 			continue;                                                                                 \
 		} // Skip invalid IMU6 events.
 
@@ -553,7 +555,8 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader) - 1;  \
 		 caerIMU6IteratorCounter >= 0; caerIMU6IteratorCounter--) {                                                \
 		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEvent(IMU6_PACKET, caerIMU6IteratorCounter); \
-		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                                      \
+		if (!caerEventPacketHeaderIsDense(&(IMU6_PACKET)->packetHeader)                                            \
+			&& !caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                                   \
 			continue;                                                                                              \
 		} // Skip invalid IMU6 events.
 
@@ -570,7 +573,8 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 		 caerIMU6IteratorCounter >= 0; caerIMU6IteratorCounter--) {                                               \
 		caerIMU6EventConst caerIMU6IteratorElement                                                                \
 			= caerIMU6EventPacketGetEventConst(IMU6_PACKET, caerIMU6IteratorCounter);                             \
-		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                                     \
+		if (!caerEventPacketHeaderIsDense(&(IMU6_PACKET)->packetHeader)                                           \
+			&& !caerIMU6EventIsValid(caerIMU6IteratorElement)) {                                                  \
 			continue;                                                                                             \
 		} // Skip invalid IMU6 events.
 
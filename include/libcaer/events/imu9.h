@@ -85,7 +85,7 @@ typedef const struct caer_imu9_event_packet *caerIMU9EventPacketConst;
 
 /**
  * Allocate a new IMU 9-axes events packet.
- * Use free() to reclaim this memory.
+ * Use caerEventPacketFree() to reclaim this memory.
  *
  * @param eventCapacity the maximum number of events this packet will hold.
  * @param eventSource the unique ID representing the source/generator of this packet.
@@ -560,7 +560,8 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 		 caerIMU9IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader);              \
 		 caerIMU9IteratorCounter++) {                                                                              \
 		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEvent(IMU9_PACKET, caerIMU9IteratorCounter); \
-		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                                      \
+		if (!caerEventPacketHeaderIsDense(&(IMU9_PACKET)->packetHeader)                                            \
+			&& !caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                                   \
 			continue;                                                                                              \
 		} // Skip invalid IMU9 events.
 
@@ -578,7 +579,8 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 		 caerIMU9IteratorCounter++) {                                                                 \
 		caerIMU9EventConst caerIMU9IteratorElement                                                    \
 			= caerIMU9EventPacketGetEventConst(IMU9_PACKET, caerIMU9IteratorCounter);                 \
-		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(IMU9_PACKET)->packetHeader)                               \
+			&& !caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                      \
 			continue;                                                                                 \
 		} // Skip invalid IMU9 events.
 
@@ -630,7 +632,8 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader) - 1;  \
 		 caerIMU9IteratorCounter >= 0; caerIMU9IteratorCounter--) {                                                \
 		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEvent(IMU9_PACKET, caerIMU9IteratorCounter); \
-		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                                      \
+		if (!caerEventPacketHeaderIsDense(&(IMU9_PACKET)->packetHeader)                                            \
+			&& !caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                                   \
 			continue;                                                                                              \
 		} // Skip invalid IMU9 events.
 
@@ -647,7 +650,8 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 		 caerIMU9IteratorCounter >= 0; caerIMU9IteratorCounter--) {                                               \
 		caerIMU9EventConst caerIMU9IteratorElement                                                                \
 			= caerIMU9EventPacketGetEventConst(IMU9_PACKET, caerIMU9IteratorCounter);                             \
-		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                                     \
+		if (!caerEventPacketHeaderIsDense(&(IMU9_PACKET)->packetHeader)                                           \
+			&& !caerIMU9EventIsValid(caerIMU9IteratorElement)) {                                                  \
 			continue;                                                                                             \
 		} // Skip invalid IMU9 events.
 
@@ -274,7 +274,7 @@ static inline void caerEventPacketContainerFree(caerEventPacketContainer contain
 		caerEventPacketHeader packetHeader = caerEventPacketContainerGetEventPacket(container, i);
 
 		if (packetHeader != NULL) {
-			free(packetHeader);
+			caerEventPacketFree(packetHeader);
 		}
 	}
 
@@ -418,6 +418,14 @@ static inline void caerEventPacketContainerUpdateStatistics(caerEventPacketConta
 		continue;
 	}
 
+	eventsNumber += caerEventPacketHeaderGetEventNumber(caerEventPacketContainerIteratorElement);
+	eventsValid += caerEventPacketHeaderGetEventValid(caerEventPacketContainerIteratorElement);
+
+	// Raw data packets carry no timestamps.
+	if (caerEventPacketHeaderGetEventType(caerEventPacketContainerIteratorElement) == RAW_DATA_EVENT) {
+		continue;
+	}
+
 	// Get timestamps to update lowest/highest tracking.
 	const void *firstEvent = caerGenericEventGetEvent(caerEventPacketContainerIteratorElement, 0);
 	int64_t currLowestEventTimestamp
@@ -436,9 +444,6 @@ static inline void caerEventPacketContainerUpdateStatistics(caerEventPacketConta
 	if ((highestTimestamp == -1) || (highestTimestamp < currHighestEventTimestamp)) {
 		highestTimestamp = currHighestEventTimestamp;
 	}
-
-	eventsNumber += caerEventPacketHeaderGetEventNumber(caerEventPacketContainerIteratorElement);
-	eventsValid += caerEventPacketHeaderGetEventValid(caerEventPacketContainerIteratorElement);
 	CAER_EVENT_PACKET_CONTAINER_ITERATOR_END
 
 	container->lowestEventTimestamp  = lowestTimestamp;
@@ -76,7 +76,7 @@ typedef const struct caer_polarity_event_packet *caerPolarityEventPacketConst;
 
 /**
  * Allocate a new polarity events packet.
- * Use free() to reclaim this memory.
+ * Use caerEventPacketFree() to reclaim this memory.
  *
  * @param eventCapacity the maximum number of events this packet will hold.
  * @param eventSource the unique ID representing the source/generator of this packet.
@@ -397,7 +397,8 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 		 caerPolarityIteratorCounter++) {                                                                     \
 		caerPolarityEvent caerPolarityIteratorElement                                                         \
 			= caerPolarityEventPacketGetEvent(POLARITY_PACKET, caerPolarityIteratorCounter);                  \
-		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(POLARITY_PACKET)->packetHeader)                                   \
+			&& !caerPolarityEventIsValid(caerPolarityIteratorElement)) {                                      \
 			continue;                                                                                         \
 		} // Skip invalid polarity events.
 
@@ -415,7 +416,8 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 		 caerPolarityIteratorCounter++) {                                                                     \
 		caerPolarityEventConst caerPolarityIteratorElement                                                    \
 			= caerPolarityEventPacketGetEventConst(POLARITY_PACKET, caerPolarityIteratorCounter);             \
-		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(POLARITY_PACKET)->packetHeader)                                   \
+			&& !caerPolarityEventIsValid(caerPolarityIteratorElement)) {                                      \
 			continue;                                                                                         \
 		} // Skip invalid polarity events.
 
@@ -473,7 +475,8 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 		 caerPolarityIteratorCounter >= 0; caerPolarityIteratorCounter--) {                  \
 		caerPolarityEvent caerPolarityIteratorElement                                        \
 			= caerPolarityEventPacketGetEvent(POLARITY_PACKET, caerPolarityIteratorCounter); \
-		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) {                        \
+		if (!caerEventPacketHeaderIsDense(&(POLARITY_PACKET)->packetHeader)                  \
+			&& !caerPolarityEventIsValid(caerPolarityIteratorElement)) {                     \
 			continue;                                                                        \
 		} // Skip invalid polarity events.
 
@@ -491,7 +494,8 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 		 caerPolarityIteratorCounter >= 0; caerPolarityIteratorCounter--) {                       \
 		caerPolarityEventConst caerPolarityIteratorElement                                        \
 			= caerPolarityEventPacketGetEventConst(POLARITY_PACKET, caerPolarityIteratorCounter); \
-		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) {                             \
+		if (!caerEventPacketHeaderIsDense(&(POLARITY_PACKET)->packetHeader)                       \
+			&& !caerPolarityEventIsValid(caerPolarityIteratorElement)) {                          \
 			continue;                                                                             \
 		} // Skip invalid polarity events.
 
@@ -500,6 +504,356 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
  */
 #define CAER_POLARITY_REVERSE_ITERATOR_VALID_END }
 
+/**
+ * Polarity structure-of-arrays (SoA) event packet data structure definition.
+ * The events are stored right after the header as four arrays, each sized to
+ * 'eventCapacity' and following each other in memory: the 32 bit timestamps (int32_t), the X
+ * addresses (uint16_t), the Y addresses (uint16_t) and the polarities
+ * (uint8_t, ON=1, OFF=0). All values are little-endian, like in all other
+ * event types. Only valid events are stored, there is no valid mark.
+ * This layout lets algorithms process one field over many events at once,
+ * for example with SIMD instructions. See caerEventTypeGetSoAFields().
+ */
+PACKED_STRUCT(struct caer_polarity_soa_event_packet {
+	/// The common event packet header.
+	struct caer_event_packet_header packetHeader;
+	// The field arrays follow, see above. There is no member for them, as a flexible
+	// array member is not valid C++. Use the accessor functions below.
+});
+
+/**
+ * Type for pointer to polarity SoA event packet data structure.
+ */
+typedef struct caer_polarity_soa_event_packet *caerPolaritySoAEventPacket;
+typedef const struct caer_polarity_soa_event_packet *caerPolaritySoAEventPacketConst;
+
+/**
+ * Allocate a new polarity SoA events packet.
+ * Use caerEventPacketFree() to reclaim this memory.
+ *
+ * @param eventCapacity the maximum number of events this packet will hold.
+ * @param eventSource the unique ID representing the source/generator of this packet.
+ * @param tsOverflow the current timestamp overflow counter value for this packet.
+ *
+ * @return a valid PolaritySoAEventPacket handle or NULL on error.
+ */
+static inline caerPolaritySoAEventPacket caerPolaritySoAEventPacketAllocate(
+	int32_t eventCapacity, int16_t eventSource, int32_t tsOverflow) {
+	return ((caerPolaritySoAEventPacket) caerEventPacketAllocate(eventCapacity, eventSource, tsOverflow,
+		POLARITY_SOA_EVENT, sizeof(int32_t) + (2 * sizeof(uint16_t)) + sizeof(uint8_t), 0));
+}
+
+/**
+ * Transform a generic event packet header into a Polarity SoA event packet.
+ * This takes care of proper casting and checks that the packet type really matches
+ * the intended conversion type.
+ *
+ * @param header a valid event packet header pointer. Cannot be NULL.
+ * @return a properly converted, typed event packet pointer.
+ */
+static inline caerPolaritySoAEventPacket caerPolaritySoAEventPacketFromPacketHeader(caerEventPacketHeader header) {
+	if (caerEventPacketHeaderGetEventType(header) != POLARITY_SOA_EVENT) {
+		return (NULL);
+	}
+
+	return ((caerPolaritySoAEventPacket) header);
+}
+
+/**
+ * Transform a generic read-only event packet header into a read-only Polarity SoA event packet.
+ * This takes care of proper casting and checks that the packet type really matches
+ * the intended conversion type.
+ *
+ * @param header a valid read-only event packet header pointer. Cannot be NULL.
+ * @return a properly converted, read-only typed event packet pointer.
+ */
+static inline caerPolaritySoAEventPacketConst caerPolaritySoAEventPacketFromPacketHeaderConst(
+	caerEventPacketHeaderConst header) {
+	if (caerEventPacketHeaderGetEventType(header) != POLARITY_SOA_EVENT) {
+		return (NULL);
+	}
+
+	return ((caerPolaritySoAEventPacketConst) header);
+}
+
+/**
+ * Get the start of the field arrays, right after the packet header.
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE ARRAY ACCESSORS BELOW.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ * @param offset the byte offset into the field arrays.
+ *
+ * @return pointer into the field arrays.
+ */
+static inline uint8_t *caerPolaritySoAEventPacketGetFields(caerPolaritySoAEventPacket packet, size_t offset) {
+	return (((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE + offset);
+}
+
+/**
+ * Get the start of the read-only field arrays, right after the packet header.
+ * THIS FUNCTION IS INTENDED FOR INTERNAL USE ONLY BY THE ARRAY ACCESSORS BELOW.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ * @param offset the byte offset into the field arrays.
+ *
+ * @return read-only pointer into the field arrays.
+ */
+static inline const uint8_t *caerPolaritySoAEventPacketGetFieldsConst(
+	caerPolaritySoAEventPacketConst packet, size_t offset) {
+	return (((const uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE + offset);
+}
+
+/**
+ * Get the array of 32 bit event timestamps (little-endian), in microseconds.
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the timestamps array.
+ */
+static inline int32_t *caerPolaritySoAEventPacketGetTimestamps(caerPolaritySoAEventPacket packet) {
+	return ((int32_t *) caerPolaritySoAEventPacketGetFields(packet, 0));
+}
+
+/**
+ * Get the read-only array of 32 bit event timestamps (little-endian), in microseconds.
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the read-only timestamps array.
+ */
+static inline const int32_t *caerPolaritySoAEventPacketGetTimestampsConst(caerPolaritySoAEventPacketConst packet) {
+	return ((const int32_t *) caerPolaritySoAEventPacketGetFieldsConst(packet, 0));
+}
+
+/**
+ * Get the array of event X addresses (little-endian).
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the X addresses array.
+ */
+static inline uint16_t *caerPolaritySoAEventPacketGetXAddresses(caerPolaritySoAEventPacket packet) {
+	size_t capacity = (size_t) caerEventPacketHeaderGetEventCapacity(&packet->packetHeader);
+	return ((uint16_t *) caerPolaritySoAEventPacketGetFields(packet, sizeof(int32_t) * capacity));
+}
+
+/**
+ * Get the read-only array of event X addresses (little-endian).
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the read-only X addresses array.
+ */
+static inline const uint16_t *caerPolaritySoAEventPacketGetXAddressesConst(caerPolaritySoAEventPacketConst packet) {
+	size_t capacity = (size_t) caerEventPacketHeaderGetEventCapacity(&packet->packetHeader);
+	return ((const uint16_t *) caerPolaritySoAEventPacketGetFieldsConst(packet, sizeof(int32_t) * capacity));
+}
+
+/**
+ * Get the array of event Y addresses (little-endian).
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the Y addresses array.
+ */
+static inline uint16_t *caerPolaritySoAEventPacketGetYAddresses(caerPolaritySoAEventPacket packet) {
+	size_t capacity = (size_t) caerEventPacketHeaderGetEventCapacity(&packet->packetHeader);
+	return ((uint16_t *) caerPolaritySoAEventPacketGetFields(packet, (sizeof(int32_t) + sizeof(uint16_t)) * capacity));
+}
+
+/**
+ * Get the read-only array of event Y addresses (little-endian).
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the read-only Y addresses array.
+ */
+static inline const uint16_t *caerPolaritySoAEventPacketGetYAddressesConst(caerPolaritySoAEventPacketConst packet) {
+	size_t capacity = (size_t) caerEventPacketHeaderGetEventCapacity(&packet->packetHeader);
+	return ((const uint16_t *) caerPolaritySoAEventPacketGetFieldsConst(
+		packet, (sizeof(int32_t) + sizeof(uint16_t)) * capacity));
+}
+
+/**
+ * Get the array of event polarities (ON=1, OFF=0).
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the polarities array.
+ */
+static inline uint8_t *caerPolaritySoAEventPacketGetPolarities(caerPolaritySoAEventPacket packet) {
+	size_t capacity = (size_t) caerEventPacketHeaderGetEventCapacity(&packet->packetHeader);
+	return (caerPolaritySoAEventPacketGetFields(packet, (sizeof(int32_t) + (2 * sizeof(uint16_t))) * capacity));
+}
+
+/**
+ * Get the read-only array of event polarities (ON=1, OFF=0).
+ * Valid indexes are within [0,eventNumber[ bounds.
+ *
+ * @param packet a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return the read-only polarities array.
+ */
+static inline const uint8_t *caerPolaritySoAEventPacketGetPolaritiesConst(caerPolaritySoAEventPacketConst packet) {
+	size_t capacity = (size_t) caerEventPacketHeaderGetEventCapacity(&packet->packetHeader);
+	return (caerPolaritySoAEventPacketGetFieldsConst(packet, (sizeof(int32_t) + (2 * sizeof(uint16_t))) * capacity));
+}
+
+/**
+ * Convert the valid events of a polarity packet into an existing polarity SoA packet,
+ * whose previous content is discarded. No memory is allocated, so packets can be
+ * reused for continuous conversion. The event source and timestamp overflow counter
+ * are copied over too.
+ *
+ * @param packet a valid PolarityEventPacket pointer. Cannot be NULL.
+ * @param soaPacket a valid PolaritySoAEventPacket pointer, with a capacity
+ *                  of at least the number of valid events in 'packet'. Cannot be NULL.
+ *
+ * @return true on success, false if 'soaPacket' is too small.
+ */
+static inline bool caerPolarityEventPacketToSoA(
+	caerPolarityEventPacketConst packet, caerPolaritySoAEventPacket soaPacket) {
+	if (caerEventPacketHeaderGetEventValid(&packet->packetHeader)
+		> caerEventPacketHeaderGetEventCapacity(&soaPacket->packetHeader)) {
+		return (false);
+	}
+
+	caerEventPacketClear(&soaPacket->packetHeader);
+
+	caerEventPacketHeaderSetEventSource(
+		&soaPacket->packetHeader, caerEventPacketHeaderGetEventSource(&packet->packetHeader));
+	caerEventPacketHeaderSetEventTSOverflow(
+		&soaPacket->packetHeader, caerEventPacketHeaderGetEventTSOverflow(&packet->packetHeader));
+
+	int32_t *timestamps  = caerPolaritySoAEventPacketGetTimestamps(soaPacket);
+	uint16_t *xAddresses = caerPolaritySoAEventPacketGetXAddresses(soaPacket);
+	uint16_t *yAddresses = caerPolaritySoAEventPacketGetYAddresses(soaPacket);
+	uint8_t *polarities  = caerPolaritySoAEventPacketGetPolarities(soaPacket);
+
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&packet->packetHeader);
+	int32_t position    = 0;
+
+	for (int32_t i = 0; i < eventNumber; i++) {
+		caerPolarityEventConst event = &packet->events[i];
+
+		if (!caerPolarityEventIsValid(event)) {
+			continue;
+		}
+
+		// Timestamps are little-endian in both layouts, no conversion needed.
+		timestamps[position] = event->timestamp;
+		xAddresses[position] = htole16(caerPolarityEventGetX(event));
+		yAddresses[position] = htole16(caerPolarityEventGetY(event));
+		polarities[position] = caerPolarityEventGetPolarity(event);
+		position++;
+	}
+
+	caerEventPacketHeaderSetEventNumber(&soaPacket->packetHeader, position);
+	caerEventPacketHeaderSetEventValid(&soaPacket->packetHeader, position);
+
+	return (true);
+}
+
+/**
+ * Convert the events of a polarity SoA packet into an existing polarity packet,
+ * whose previous content is discarded. No memory is allocated, so packets can be
+ * reused for continuous conversion. The event source and timestamp overflow counter
+ * are copied over too.
+ *
+ * @param soaPacket a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ * @param packet a valid PolarityEventPacket pointer, with a capacity of at
+ *               least the number of events in 'soaPacket'. Cannot be NULL.
+ *
+ * @return true on success, false if 'packet' is too small.
+ */
+static inline bool caerPolaritySoAEventPacketToAoS(
+	caerPolaritySoAEventPacketConst soaPacket, caerPolarityEventPacket packet) {
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&soaPacket->packetHeader);
+
+	if (eventNumber > caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+		return (false);
+	}
+
+	caerEventPacketClear(&packet->packetHeader);
+
+	caerEventPacketHeaderSetEventSource(
+		&packet->packetHeader, caerEventPacketHeaderGetEventSource(&soaPacket->packetHeader));
+	caerEventPacketHeaderSetEventTSOverflow(
+		&packet->packetHeader, caerEventPacketHeaderGetEventTSOverflow(&soaPacket->packetHeader));
+
+	const int32_t *timestamps  = caerPolaritySoAEventPacketGetTimestampsConst(soaPacket);
+	const uint16_t *xAddresses = caerPolaritySoAEventPacketGetXAddressesConst(soaPacket);
+	const uint16_t *yAddresses = caerPolaritySoAEventPacketGetYAddressesConst(soaPacket);
+	const uint8_t *polarities  = caerPolaritySoAEventPacketGetPolaritiesConst(soaPacket);
+
+	for (int32_t i = 0; i < eventNumber; i++) {
+		packet->events[i].data
+			= htole32((U32T(le16toh(xAddresses[i]) & POLARITY_X_ADDR_MASK) << POLARITY_X_ADDR_SHIFT)
+					  | (U32T(le16toh(yAddresses[i]) & POLARITY_Y_ADDR_MASK) << POLARITY_Y_ADDR_SHIFT)
+					  | (U32T(polarities[i] & POLARITY_MASK) << POLARITY_SHIFT) | (U32T(1) << VALID_MARK_SHIFT));
+		packet->events[i].timestamp = timestamps[i];
+	}
+
+	caerEventPacketHeaderSetEventNumber(&packet->packetHeader, eventNumber);
+	caerEventPacketHeaderSetEventValid(&packet->packetHeader, eventNumber);
+
+	return (true);
+}
+
+/**
+ * Make a polarity SoA copy of a polarity packet, with the same capacity
+ * and containing its valid events. See caerPolarityEventPacketToSoA().
+ * Use caerEventPacketFree() to reclaim this memory.
+ *
+ * @param packet a valid PolarityEventPacket pointer. Cannot be NULL.
+ *
+ * @return a valid PolaritySoAEventPacket handle or NULL on error.
+ */
+static inline caerPolaritySoAEventPacket caerPolaritySoAEventPacketFromPolarityPacket(
+	caerPolarityEventPacketConst packet) {
+	caerPolaritySoAEventPacket soaPacket = caerPolaritySoAEventPacketAllocate(
+		caerEventPacketHeaderGetEventCapacity(&packet->packetHeader),
+		caerEventPacketHeaderGetEventSource(&packet->packetHeader),
+		caerEventPacketHeaderGetEventTSOverflow(&packet->packetHeader));
+	if (soaPacket == NULL) {
+		return (NULL);
+	}
+
+	caerPolarityEventPacketToSoA(packet, soaPacket);
+
+	return (soaPacket);
+}
+
+/**
+ * Make a polarity copy of a polarity SoA packet, with the same capacity
+ * and containing its events. See caerPolaritySoAEventPacketToAoS().
+ * Use caerEventPacketFree() to reclaim this memory.
+ *
+ * @param soaPacket a valid PolaritySoAEventPacket pointer. Cannot be NULL.
+ *
+ * @return a valid PolarityEventPacket handle or NULL on error.
+ */
+static inline caerPolarityEventPacket caerPolarityEventPacketFromSoAPacket(caerPolaritySoAEventPacketConst soaPacket) {
+	caerPolarityEventPacket packet = caerPolarityEventPacketAllocate(
+		caerEventPacketHeaderGetEventCapacity(&soaPacket->packetHeader),
+		caerEventPacketHeaderGetEventSource(&soaPacket->packetHeader),
+		caerEventPacketHeaderGetEventTSOverflow(&soaPacket->packetHeader));
+	if (packet == NULL) {
+		return (NULL);
+	}
+
+	caerPolaritySoAEventPacketToAoS(soaPacket, packet);
+
+	return (packet);
+}
+
 #ifdef __cplusplus
 }
 #endif
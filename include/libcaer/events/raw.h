@@ -0,0 +1,131 @@
+/**
+ * @file raw.h
+ *
+ * Raw Data Events format definition and handling functions.
+ * This contains the data exactly as it was received from a device,
+ * before any translation into the other event types.
+ */
+
+#ifndef LIBCAER_EVENTS_RAW_H_
+#define LIBCAER_EVENTS_RAW_H_
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Raw data event packet data structure definition.
+ * Each event is a single byte of device data, in the device's own
+ * format, so the event size is 1 and the event number is the amount
+ * of data in bytes. Raw data packets have no valid mark and no
+ * timestamps: all their events are always valid (eventValid is always
+ * equal to eventNumber), and the generic timestamp functions, like
+ * caerGenericEventGetTimestamp(), must not be used on them.
+ * EventPackets are always made up of the common packet header,
+ * followed by 'eventCapacity' events. Everything has to
+ * be in one contiguous memory block.
+ */
+PACKED_STRUCT(struct caer_raw_data_event_packet {
+	/// The common event packet header.
+	struct caer_event_packet_header packetHeader;
+	/// The raw data array.
+	uint8_t data[];
+});
+
+/**
+ * Type for pointer to raw data event packet data structure.
+ */
+typedef struct caer_raw_data_event_packet *caerRawDataEventPacket;
+typedef const struct caer_raw_data_event_packet *caerRawDataEventPacketConst;
+
+/**
+ * Allocate a new raw data events packet.
+ * Use caerEventPacketFree() to reclaim this memory.
+ *
+ * @param eventCapacity the maximum number of bytes this packet will hold.
+ * @param eventSource the unique ID representing the source/generator of this packet.
+ * @param tsOverflow the current timestamp overflow counter value for this packet.
+ *
+ * @return a valid RawDataEventPacket handle or NULL on error.
+ */
+static inline caerRawDataEventPacket caerRawDataEventPacketAllocate(
+	int32_t eventCapacity, int16_t eventSource, int32_t tsOverflow) {
+	return ((caerRawDataEventPacket) caerEventPacketAllocate(
+		eventCapacity, eventSource, tsOverflow, RAW_DATA_EVENT, sizeof(uint8_t), 0));
+}
+
+/**
+ * Transform a generic event packet header into a raw data event packet.
+ * This takes care of proper casting and checks that the packet type really matches
+ * the intended conversion type.
+ *
+ * @param header a valid event packet header pointer. Cannot be NULL.
+ * @return a properly converted, typed event packet pointer.
+ */
+static inline caerRawDataEventPacket caerRawDataEventPacketFromPacketHeader(caerEventPacketHeader header) {
+	if (caerEventPacketHeaderGetEventType(header) != RAW_DATA_EVENT) {
+		return (NULL);
+	}
+
+	return ((caerRawDataEventPacket) header);
+}
+
+/**
+ * Transform a generic read-only event packet header into a read-only raw data event packet.
+ * This takes care of proper casting and checks that the packet type really matches
+ * the intended conversion type.
+ *
+ * @param header a valid read-only event packet header pointer. Cannot be NULL.
+ * @return a properly converted, read-only typed event packet pointer.
+ */
+static inline caerRawDataEventPacketConst caerRawDataEventPacketFromPacketHeaderConst(
+	caerEventPacketHeaderConst header) {
+	if (caerEventPacketHeaderGetEventType(header) != RAW_DATA_EVENT) {
+		return (NULL);
+	}
+
+	return ((caerRawDataEventPacketConst) header);
+}
+
+/**
+ * Get the raw data held by the event packet.
+ * Its size in bytes is the packet's event number.
+ *
+ * @param packet a valid RawDataEventPacket pointer. Cannot be NULL.
+ *
+ * @return a pointer to the raw data.
+ */
+static inline uint8_t *caerRawDataEventPacketGetData(caerRawDataEventPacket packet) {
+	return (packet->data);
+}
+
+/**
+ * Get the raw data held by the event packet, read-only.
+ * Its size in bytes is the packet's event number.
+ *
+ * @param packet a valid RawDataEventPacket pointer. Cannot be NULL.
+ *
+ * @return a read-only pointer to the raw data.
+ */
+static inline const uint8_t *caerRawDataEventPacketGetDataConst(caerRawDataEventPacketConst packet) {
+	return (packet->data);
+}
+
+/**
+ * Get the size in bytes of the raw data held by the event packet.
+ *
+ * @param packet a valid RawDataEventPacket pointer. Cannot be NULL.
+ *
+ * @return the raw data size in bytes.
+ */
+static inline size_t caerRawDataEventPacketGetDataSize(caerRawDataEventPacketConst packet) {
+	return ((size_t) caerEventPacketHeaderGetEventNumber(&packet->packetHeader));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_EVENTS_RAW_H_ */
@@ -95,7 +95,7 @@ typedef const struct caer_special_event_packet *caerSpecialEventPacketConst;
 
 /**
  * Allocate a new special events packet.
- * Use free() to reclaim this memory.
+ * Use caerEventPacketFree() to reclaim this memory.
  *
  * @param eventCapacity the maximum number of events this packet will hold.
  * @param eventSource the unique ID representing the source/generator of this packet.
@@ -391,7 +391,8 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 		 caerSpecialIteratorCounter++) {                                                                    \
 		caerSpecialEvent caerSpecialIteratorElement                                                         \
 			= caerSpecialEventPacketGetEvent(SPECIAL_PACKET, caerSpecialIteratorCounter);                   \
-		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(SPECIAL_PACKET)->packetHeader)                                  \
+			&& !caerSpecialEventIsValid(caerSpecialIteratorElement)) {                                      \
 			continue;                                                                                       \
 		} // Skip invalid special events.
 
@@ -409,7 +410,8 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 		 caerSpecialIteratorCounter++) {                                                                    \
 		caerSpecialEventConst caerSpecialIteratorElement                                                    \
 			= caerSpecialEventPacketGetEventConst(SPECIAL_PACKET, caerSpecialIteratorCounter);              \
-		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(SPECIAL_PACKET)->packetHeader)                                  \
+			&& !caerSpecialEventIsValid(caerSpecialIteratorElement)) {                                      \
 			continue;                                                                                       \
 		} // Skip invalid special events.
 
@@ -466,7 +468,8 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 		 caerSpecialIteratorCounter >= 0; caerSpecialIteratorCounter--) {                 \
 		caerSpecialEvent caerSpecialIteratorElement                                       \
 			= caerSpecialEventPacketGetEvent(SPECIAL_PACKET, caerSpecialIteratorCounter); \
-		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) {                       \
+		if (!caerEventPacketHeaderIsDense(&(SPECIAL_PACKET)->packetHeader)                \
+			&& !caerSpecialEventIsValid(caerSpecialIteratorElement)) {                    \
 			continue;                                                                     \
 		} // Skip invalid special events.
 
@@ -484,7 +487,8 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 		 caerSpecialIteratorCounter >= 0; caerSpecialIteratorCounter--) {                      \
 		caerSpecialEventConst caerSpecialIteratorElement                                       \
 			= caerSpecialEventPacketGetEventConst(SPECIAL_PACKET, caerSpecialIteratorCounter); \
-		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) {                            \
+		if (!caerEventPacketHeaderIsDense(&(SPECIAL_PACKET)->packetHeader)                     \
+			&& !caerSpecialEventIsValid(caerSpecialIteratorElement)) {                         \
 			continue;                                                                          \
 		} // Skip invalid special events.
 
@@ -72,7 +72,7 @@ typedef const struct caer_spike_event_packet *caerSpikeEventPacketConst;
 
 /**
  * Allocate a new Spike events packet.
- * Use free() to reclaim this memory.
+ * Use caerEventPacketFree() to reclaim this memory.
  *
  * @param eventCapacity the maximum number of events this packet will hold.
  * @param eventSource the unique ID representing the source/generator of this packet.
@@ -384,7 +384,8 @@ static inline void caerSpikeEventSetNeuronID(caerSpikeEvent event, uint32_t neur
 		 caerSpikeIteratorCounter++) {                                                                  \
 		caerSpikeEvent caerSpikeIteratorElement                                                         \
 			= caerSpikeEventPacketGetEvent(SPIKE_PACKET, caerSpikeIteratorCounter);                     \
-		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(SPIKE_PACKET)->packetHeader)                                \
+			&& !caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                      \
 			continue;                                                                                   \
 		} // Skip invalid Spike events.
 
@@ -402,7 +403,8 @@ static inline void caerSpikeEventSetNeuronID(caerSpikeEvent event, uint32_t neur
 		 caerSpikeIteratorCounter++) {                                                                  \
 		caerSpikeEventConst caerSpikeIteratorElement                                                    \
 			= caerSpikeEventPacketGetEventConst(SPIKE_PACKET, caerSpikeIteratorCounter);                \
-		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                         \
+		if (!caerEventPacketHeaderIsDense(&(SPIKE_PACKET)->packetHeader)                                \
+			&& !caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                      \
 			continue;                                                                                   \
 		} // Skip invalid Spike events.
 
@@ -455,7 +457,8 @@ static inline void caerSpikeEventSetNeuronID(caerSpikeEvent event, uint32_t neur
 		 caerSpikeIteratorCounter >= 0; caerSpikeIteratorCounter--) {                                               \
 		caerSpikeEvent caerSpikeIteratorElement                                                                     \
 			= caerSpikeEventPacketGetEvent(SPIKE_PACKET, caerSpikeIteratorCounter);                                 \
-		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                                     \
+		if (!caerEventPacketHeaderIsDense(&(SPIKE_PACKET)->packetHeader)                                            \
+			&& !caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                                  \
 			continue;                                                                                               \
 		} // Skip invalid spike events.
 
@@ -472,7 +475,8 @@ static inline void caerSpikeEventSetNeuronID(caerSpikeEvent event, uint32_t neur
 		 caerSpikeIteratorCounter >= 0; caerSpikeIteratorCounter--) {                                               \
 		caerSpikeEventConst caerSpikeIteratorElement                                                                \
 			= caerSpikeEventPacketGetEventConst(SPIKE_PACKET, caerSpikeIteratorCounter);                            \
-		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                                     \
+		if (!caerEventPacketHeaderIsDense(&(SPIKE_PACKET)->packetHeader)                                            \
+			&& !caerSpikeEventIsValid(caerSpikeIteratorElement)) {                                                  \
 			continue;                                                                                               \
 		} // Skip invalid spike events.
 
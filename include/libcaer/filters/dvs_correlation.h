@@ -0,0 +1,198 @@
+/**
+ * @file dvs_correlation.h
+ *
+ * The DVS correlation filter removes uncorrelated events, like the
+ * Background-Activity filter of the DVS noise filter, using much less
+ * memory: an event passes if another event happened close to it, in
+ * space and time. Different kernels trade accuracy for memory:
+ * - row/column: the last event of each sensor row and column, O(sizeX + sizeY).
+ * - nearest-time: the last events of the whole sensor, a fixed-size window.
+ * - lattice: the last event of each cell of a sub-sampled pixel grid.
+ * Each event is checked in constant time, independent of the event rate.
+ * When timestamps jump back by more than about 9 minutes, for example
+ * after a timestamp reset, the events kept by the nearest-time and lattice
+ * kernels expire: they don't support the new events.
+ * Please note that the filter is not thread-safe, all function calls
+ * should happen on the same thread, unless you take care that they
+ * never overlap.
+ */
+
+#ifndef LIBCAER_FILTERS_DVS_CORRELATION_H_
+#define LIBCAER_FILTERS_DVS_CORRELATION_H_
+
+#include "../events/polarity.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pointer to DVS correlation filter structure (private).
+ */
+typedef struct caer_filter_dvs_correlation *caerFilterDVSCorrelation;
+
+/**
+ * Allocate memory and initialize the DVS correlation filter.
+ * It starts with the row/column kernel, which needs the least memory.
+ * You must specify the maximum resolution at initialization,
+ * as it is used to size the kernels' memory.
+ *
+ * @param sizeX maximum X axis resolution.
+ * @param sizeY maximum Y axis resolution.
+ *
+ * @return DVS correlation filter instance, NULL on error.
+ */
+LIBRARY_PUBLIC_VISIBILITY caerFilterDVSCorrelation caerFilterDVSCorrelationInitialize(uint16_t sizeX, uint16_t sizeY);
+
+/**
+ * Destroy a DVS correlation filter instance and free its memory.
+ *
+ * @param correlationFilter a valid DVS correlation filter instance.
+ */
+LIBRARY_PUBLIC_VISIBILITY void caerFilterDVSCorrelationDestroy(caerFilterDVSCorrelation correlationFilter);
+
+/**
+ * Apply the DVS correlation filter to the given polarity events packet.
+ * This will filter out events by marking them as invalid, depending
+ * on the given filter configuration.
+ *
+ * @param correlationFilter a valid DVS correlation filter instance.
+ * @param polarity a valid polarity event packet. If NULL, no operation
+ *                 is performed.
+ */
+LIBRARY_PUBLIC_VISIBILITY void caerFilterDVSCorrelationApply(
+	caerFilterDVSCorrelation correlationFilter, caerPolarityEventPacket polarity);
+
+/**
+ * Apply the DVS correlation filter to the given polarity events packet.
+ * This will only gather statistics on the filters, without actually
+ * filtering out any events. The memory of the kernels is still
+ * updated as with caerFilterDVSCorrelationApply().
+ *
+ * @param correlationFilter a valid DVS correlation filter instance.
+ * @param polarity a valid polarity event packet. If NULL, no operation
+ *                 is performed.
+ */
+LIBRARY_PUBLIC_VISIBILITY void caerFilterDVSCorrelationStatsApply(
+	caerFilterDVSCorrelation correlationFilter, caerPolarityEventPacketConst polarity);
+
+/**
+ * Set DVS correlation filter configuration parameters.
+ *
+ * @param correlationFilter a valid DVS correlation filter instance.
+ * @param paramAddr a configuration parameter address, see defines CAER_FILTER_DVS_CORRELATION_*.
+ * @param param a configuration parameter value integer.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+LIBRARY_PUBLIC_VISIBILITY bool caerFilterDVSCorrelationConfigSet(
+	caerFilterDVSCorrelation correlationFilter, uint8_t paramAddr, uint64_t param);
+
+/**
+ * Get DVS correlation filter configuration parameters.
+ *
+ * @param correlationFilter a valid DVS correlation filter instance.
+ * @param paramAddr a configuration parameter address, see defines CAER_FILTER_DVS_CORRELATION_*.
+ * @param param a pointer to a configuration parameter value integer,
+ *              in which to store the current value.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+LIBRARY_PUBLIC_VISIBILITY bool caerFilterDVSCorrelationConfigGet(
+	caerFilterDVSCorrelation correlationFilter, uint8_t paramAddr, uint64_t *param);
+
+/**
+ * DVS Correlation Filter kernel:
+ * keep the last event of each sensor row and of each column. An event
+ * is supported by the last event of its own or a neighboring column, if
+ * that was in a neighboring row, and likewise by the last event of its
+ * own or a neighboring row. Memory is O(sizeX + sizeY).
+ */
+#define CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN 0
+/**
+ * DVS Correlation Filter kernel:
+ * keep the last CAER_FILTER_DVS_CORRELATION_WINDOW_SIZE events of the
+ * whole sensor. An event is supported by any of them at a neighboring
+ * pixel. Memory is independent of the sensor size, but the window must
+ * be large enough to hold the events of the correlation time.
+ */
+#define CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME 1
+/**
+ * DVS Correlation Filter kernel:
+ * keep the last event of each cell of a lattice over the sensor, each
+ * cell grouping 2^CAER_FILTER_DVS_CORRELATION_SUBSAMPLE pixels per axis.
+ * An event is supported by the last event of any of the eight cells
+ * neighboring its own. Memory is O(sizeX * sizeY / 4^subsample). Without
+ * sub-sampling, this is the same as the Background-Activity filter of
+ * the DVS noise filter, with default support settings: like its map, the
+ * lattice starts with all cells at timestamp zero.
+ */
+#define CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE 2
+
+/**
+ * DVS Correlation Filter:
+ * kernel used to look for supporting events, one of the defines
+ * CAER_FILTER_DVS_CORRELATION_KERNEL_*. Changing it clears the
+ * kernel's memory. Default is CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN.
+ */
+#define CAER_FILTER_DVS_CORRELATION_KERNEL 0
+/**
+ * DVS Correlation Filter:
+ * specify the time difference constant for the correlation filter in
+ * microseconds. Events that do correlate within this time-frame are
+ * let through, while others are filtered out. Default is 2000.
+ * At most 536870912 (about 9 minutes), larger values are clamped.
+ */
+#define CAER_FILTER_DVS_CORRELATION_TIME 1
+/**
+ * DVS Correlation Filter:
+ * only events of the same polarity can support each other.
+ * Default is false.
+ */
+#define CAER_FILTER_DVS_CORRELATION_CHECK_POLARITY 2
+/**
+ * DVS Correlation Filter:
+ * number of last events kept by the nearest-time kernel, from 1 to 4096.
+ * Changing it clears the kernel's memory. Default is 64.
+ */
+#define CAER_FILTER_DVS_CORRELATION_WINDOW_SIZE 3
+/**
+ * DVS Correlation Filter:
+ * sub-sampling of the lattice kernel, as a power of two, from 0 to 4:
+ * its cells are 2^subsample by 2^subsample pixels. Changing it clears
+ * the kernel's memory. Default is 1, 2 by 2 pixel cells.
+ */
+#define CAER_FILTER_DVS_CORRELATION_SUBSAMPLE 4
+/**
+ * DVS Correlation Filter:
+ * Number of events filtered out by the correlation filter.
+ */
+#define CAER_FILTER_DVS_CORRELATION_STATISTICS 5
+/**
+ * DVS Correlation Filter:
+ * Number of ON events filtered out by the correlation filter.
+ */
+#define CAER_FILTER_DVS_CORRELATION_STATISTICS_ON 6
+/**
+ * DVS Correlation Filter:
+ * Number of OFF events filtered out by the correlation filter.
+ */
+#define CAER_FILTER_DVS_CORRELATION_STATISTICS_OFF 7
+/**
+ * DVS Correlation Filter:
+ * set a custom log-level for an instance of the DVS Correlation filter.
+ */
+#define CAER_FILTER_DVS_CORRELATION_LOG_LEVEL 8
+/**
+ * DVS Correlation Filter:
+ * reset this instance of the filter to its initial state, clearing
+ * the kernel's memory and the statistics. This does not change or
+ * reset the configuration.
+ */
+#define CAER_FILTER_DVS_CORRELATION_RESET 9
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_FILTERS_DVS_CORRELATION_H_ */
@@ -9,6 +9,9 @@
  * the event rate and is efficient to implement together with the
  * Background-Activity filter, requiring only one pixel memory
  * map for both.
+ * When timestamps jump back by more than about 9 minutes, for example
+ * after a timestamp reset, the timestamps already in the map expire:
+ * they neither support nor inhibit the new events.
  * Please note that the filter is not thread-safe, all function calls
  * should happen on the same thread, unless you take care that they
  * never overlap.
@@ -65,6 +68,41 @@ typedef struct caer_filter_dvs_noise *caerFilterDVSNoise;
  */
 LIBRARY_PUBLIC_VISIBILITY caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY);
 
+/**
+ * Timestamp map layout for caerFilterDVSNoiseInitializeLayout():
+ * one row of pixels after the other, as on the sensor.
+ * This is the layout used by caerFilterDVSNoiseInitialize().
+ */
+#define CAER_FILTER_DVS_MAP_LAYOUT_ROWS 0
+/**
+ * Timestamp map layout for caerFilterDVSNoiseInitializeLayout():
+ * tiles of 4x4 pixels, each one 64 byte cache line. The neighborhood
+ * of a pixel, looked at by the Background-Activity filter, then spans
+ * one or two cache lines for most pixels, instead of three rows that
+ * are far apart in memory on wide sensors. While the timestamp map fits
+ * in the CPU caches, this is slower than CAER_FILTER_DVS_MAP_LAYOUT_ROWS,
+ * due to the more complex addressing. It can only pay off when it does
+ * not, for example with many filters running at once, and then depends
+ * on the sensor size and the CPU, so it should be measured first.
+ */
+#define CAER_FILTER_DVS_MAP_LAYOUT_TILES 1
+
+/**
+ * Allocate memory and initialize the DVS noise filter, like
+ * caerFilterDVSNoiseInitialize(), with the given memory layout
+ * for its timestamp map. The layout only affects performance,
+ * the filtering results are exactly the same.
+ *
+ * @param sizeX maximum X axis resolution.
+ * @param sizeY maximum Y axis resolution.
+ * @param mapLayout timestamp map layout, one of CAER_FILTER_DVS_MAP_LAYOUT_ROWS
+ *                  or CAER_FILTER_DVS_MAP_LAYOUT_TILES.
+ *
+ * @return DVS noise filter instance, NULL on error.
+ */
+LIBRARY_PUBLIC_VISIBILITY caerFilterDVSNoise caerFilterDVSNoiseInitializeLayout(
+	uint16_t sizeX, uint16_t sizeY, uint8_t mapLayout);
+
 /**
  * Destroy a DVS noise filter instance and free its memory.
  *
@@ -123,7 +161,9 @@ LIBRARY_PUBLIC_VISIBILITY bool caerFilterDVSNoiseConfigGet(
 
 /**
  * Get an array of currently learned hot pixels, in order of activity
- * (most active first, least active last).
+ * (most active first, least active last). While learning incrementally,
+ * the pixels already learned in the current learning, and not in the
+ * previous one, follow in order of address.
  * Useful for working with hardware-based pixel filtering (FPGA/CPLD).
  *
  * @param noiseFilter a valid DVS noise filter instance.
@@ -178,6 +218,15 @@ LIBRARY_PUBLIC_VISIBILITY ssize_t caerFilterDVSNoiseGetHotPixels(
  * Number of OFF events filtered out by the hot pixel filter.
  */
 #define CAER_FILTER_DVS_HOTPIXEL_STATISTICS_OFF 18
+/**
+ * DVS HotPixel Filter:
+ * Learn incrementally: pixels are filtered out as soon as they reach
+ * the hot pixel count, starting with the event with which they do, instead
+ * of only once the whole learning time is over. Hot pixels from the
+ * previous learning also stay filtered out until then. Once learning
+ * completes, the hot pixels are exactly the same as without this.
+ */
+#define CAER_FILTER_DVS_HOTPIXEL_LEARN_INCREMENTAL 25
 
 /**
  * DVS Background-Activity Filter:
@@ -190,6 +239,7 @@ LIBRARY_PUBLIC_VISIBILITY ssize_t caerFilterDVSNoiseGetHotPixels(
  * specify the time difference constant for the background-activity
  * filter in microseconds. Events that do correlated within this
  * time-frame are let through, while others are filtered out.
+ * At most 536870912 (about 9 minutes), larger values are clamped.
  */
 #define CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TIME 6
 /**
@@ -219,6 +269,7 @@ LIBRARY_PUBLIC_VISIBILITY ssize_t caerFilterDVSNoiseGetHotPixels(
  * specify the time constant for the refractory period filter.
  * Pixels will be inhibited from generating new events during this
  * time after the last even has fired.
+ * At most 536870912 (about 9 minutes), larger values are clamped.
  */
 #define CAER_FILTER_DVS_REFRACTORY_PERIOD_TIME 9
 /**
@@ -256,6 +307,8 @@ LIBRARY_PUBLIC_VISIBILITY ssize_t caerFilterDVSNoiseGetHotPixels(
  * repeat the background-activity check, that at least one neighbor pixel
  * supports this pixel, on each pixel that supported the current pixel in
  * turn, basically repeating the check for a second level of pixels.
+ * This costs one more neighborhood check per supporting pixel, until one
+ * of them is supported in turn.
  */
 #define CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TWO_LEVELS 13
 
@@ -280,6 +333,27 @@ LIBRARY_PUBLIC_VISIBILITY ssize_t caerFilterDVSNoiseGetHotPixels(
  */
 #define CAER_FILTER_DVS_BACKGROUND_ACTIVITY_CHECK_POLARITY 16
 
+/**
+ * DVS Noise Filter:
+ * number of threads filtering each packet, from 1 to 64. The sensor is split
+ * into horizontal bands of rows, one per thread, each with its own part of the
+ * timestamp map plus copies of the two rows bordering it on each side, which
+ * are kept up to date with the events falling into them. The results are exactly
+ * the same as with one thread. The thread calling caerFilterDVSNoiseApply() or
+ * caerFilterDVSNoiseStatsApply() filters the first band, the others are filtered
+ * by worker threads started by this setting. Each band has at least 16 rows, so
+ * small sensors may use fewer threads than requested.
+ * Default is 1, all filtering happens in the calling thread.
+ */
+#define CAER_FILTER_DVS_THREADS 23
+
+/**
+ * DVS Noise Filter:
+ * read-only, timestamp map layout chosen at initialization, see
+ * caerFilterDVSNoiseInitializeLayout().
+ */
+#define CAER_FILTER_DVS_MAP_LAYOUT 24
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,7 @@ void caerRingBufferFree(caerRingBuffer rBuf);
 bool caerRingBufferPut(caerRingBuffer rBuf, void *elem);
 bool caerRingBufferFull(caerRingBuffer rBuf);
 void *caerRingBufferGet(caerRingBuffer rBuf);
+size_t caerRingBufferGetMany(caerRingBuffer rBuf, void **elems, size_t maxElems);
 void *caerRingBufferLook(caerRingBuffer rBuf);
 bool caerRingBufferEmpty(caerRingBuffer rBuf);
 
@@ -33,6 +33,10 @@ public:
 		usb(deviceID, CAER_DEVICE_DAVIS, busNumberRestrict, devAddressRestrict, serialNumberRestrict) {
 	}
 
+	davis(uint16_t deviceID, const std::string &replayFilePath, bool replayMaxSpeed) :
+		usb(deviceID, CAER_DEVICE_DAVIS, replayFilePath, replayMaxSpeed) {
+	}
+
 	struct caer_davis_info infoGet() const noexcept {
 		return (caerDavisInfoGet(handle.get()));
 	}
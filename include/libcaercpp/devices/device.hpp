@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace libcaer {
 namespace devices {
@@ -107,6 +108,25 @@ public:
 
 		return (cppContainer);
 	}
+
+	std::vector<std::unique_ptr<libcaer::events::EventPacketContainer>> dataGet(size_t maxContainers) const {
+		std::vector<caerEventPacketContainer> cContainers(maxContainers);
+
+		size_t containersNumber = caerDeviceDataGetMany(handle.get(), cContainers.data(), maxContainers);
+
+		std::vector<std::unique_ptr<libcaer::events::EventPacketContainer>> cppContainers;
+		cppContainers.reserve(containersNumber);
+
+		for (size_t i = 0; i < containersNumber; i++) {
+			cppContainers.emplace_back(new libcaer::events::EventPacketContainer(cContainers[i]));
+
+			// Free original C container. The event packet memory is now managed by
+			// the EventPacket classes inside the new C++ EventPacketContainer.
+			free(cContainers[i]);
+		}
+
+		return (cppContainers);
+	}
 };
 } // namespace devices
 } // namespace libcaer
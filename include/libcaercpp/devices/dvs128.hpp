@@ -21,6 +21,10 @@ public:
 		usb(deviceID, CAER_DEVICE_DVS128, busNumberRestrict, devAddressRestrict, serialNumberRestrict) {
 	}
 
+	dvs128(uint16_t deviceID, const std::string &replayFilePath, bool replayMaxSpeed) :
+		usb(deviceID, CAER_DEVICE_DVS128, replayFilePath, replayMaxSpeed) {
+	}
+
 	struct caer_dvs128_info infoGet() const noexcept {
 		return (caerDVS128InfoGet(handle.get()));
 	}
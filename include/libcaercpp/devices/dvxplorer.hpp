@@ -22,6 +22,10 @@ public:
 		usb(deviceID, CAER_DEVICE_DVXPLORER, busNumberRestrict, devAddressRestrict, serialNumberRestrict) {
 	}
 
+	dvXplorer(uint16_t deviceID, const std::string &replayFilePath, bool replayMaxSpeed) :
+		usb(deviceID, CAER_DEVICE_DVXPLORER, replayFilePath, replayMaxSpeed) {
+	}
+
 	struct caer_dvx_info infoGet() const noexcept {
 		return (caerDVXplorerInfoGet(handle.get()));
 	}
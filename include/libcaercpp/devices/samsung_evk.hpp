@@ -21,6 +21,10 @@ public:
 		usb(deviceID, CAER_DEVICE_SAMSUNG_EVK, busNumberRestrict, devAddressRestrict, serialNumberRestrict) {
 	}
 
+	samsungEVK(uint16_t deviceID, const std::string &replayFilePath, bool replayMaxSpeed) :
+		usb(deviceID, CAER_DEVICE_SAMSUNG_EVK, replayFilePath, replayMaxSpeed) {
+	}
+
 	struct caer_samsung_evk_info infoGet() const noexcept {
 		return (caerSamsungEVKInfoGet(handle.get()));
 	}
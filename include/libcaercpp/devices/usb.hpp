@@ -36,6 +36,35 @@ protected:
 
 		handle = std::shared_ptr<struct caer_device_handle>(h, deleteDeviceHandle);
 	}
+
+	usb(uint16_t deviceID, uint16_t deviceType, const std::string &replayFilePath, bool replayMaxSpeed) {
+		caerDeviceHandle h = caerDeviceRawReplayOpen(deviceID, deviceType, replayFilePath.c_str(), replayMaxSpeed);
+
+		// Handle constructor failure.
+		if (h == nullptr) {
+			std::string exc = "Failed to open USB device replay, id=" + std::to_string(deviceID)
+							  + ", type=" + std::to_string(deviceType) + ", file=" + replayFilePath + ".";
+			throw std::runtime_error(exc);
+		}
+
+		// Use stateless lambda for shared_ptr custom deleter.
+		auto deleteDeviceHandle = [](caerDeviceHandle cdh) {
+			// Run destructor, free all memory.
+			// Never fails in current implementation.
+			caerDeviceClose(&cdh);
+		};
+
+		handle = std::shared_ptr<caer_device_handle>(h, deleteDeviceHandle);
+	}
+
+public:
+	void rawRecordStart(const std::string &filePath) const {
+		bool success = caerDeviceRawRecordStart(handle.get(), filePath.c_str());
+		if (!success) {
+			std::string exc = toString() + ": failed to start raw recording to '" + filePath + "'.";
+			throw std::runtime_error(exc);
+		}
+	}
 };
 } // namespace devices
 } // namespace libcaer
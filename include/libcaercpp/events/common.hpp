@@ -170,9 +170,9 @@ public:
 	virtual ~EventPacket() {
 		// Support not freeing memory, when this packet doesn't own the memory.
 		if (isMemoryOwner) {
-			// All EventPackets must have been allocated somewhere on the heap,
-			// and can thus always be passed to free(). free(nullptr) does nothing.
-			free(header);
+			// All EventPackets must have been allocated with the event packet
+			// allocator, see caerEventPacketAllocatorSet(). nullptr is ignored.
+			caerEventPacketFree(header);
 		}
 	}
 
@@ -198,7 +198,7 @@ public:
 
 			// Destroy current data, only if actually owned.
 			if (isMemoryOwner) {
-				free(header);
+				caerEventPacketFree(header);
 			}
 
 			header        = copy;
@@ -237,7 +237,7 @@ public:
 
 		// Destroy current data, only if actually owned.
 		if (isMemoryOwner) {
-			free(header);
+			caerEventPacketFree(header);
 		}
 
 		// Move data here.
@@ -370,7 +370,8 @@ public:
 		}
 
 		bool isValid() const noexcept {
-			return (caerGenericEventIsValid(event));
+			// Dense packets, like all structure-of-arrays ones, only hold valid events.
+			return (caerEventPacketHeaderIsDense(header) || caerGenericEventIsValid(event));
 		}
 
 		// C variant.
@@ -385,6 +386,9 @@ public:
 				!= caerEventPacketHeaderGetEventTSOverflow(header)) {
 				throw std::invalid_argument("Event TS overflow must be the same.");
 			}
+			if (caerEventPacketHeaderIsSoA(header)) {
+				throw std::invalid_argument("Structure-of-arrays events can't be copied individually.");
+			}
 
 			caerGenericEventCopy(eventPtrDestination, event, headerPtrDestination, header);
 		}
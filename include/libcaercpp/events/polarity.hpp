@@ -114,6 +114,321 @@ protected:
 		return (*evt);
 	}
 };
+
+struct PolaritySoAEvent {
+	int32_t timestamp;
+	uint16_t x;
+	uint16_t y;
+	bool polarity;
+};
+
+class PolaritySoAEventPacketIterator {
+private:
+	caerPolaritySoAEventPacketConst packet;
+	int32_t index;
+
+public:
+	// Member access goes through a temporary holding the assembled event.
+	struct EventPointer {
+		PolaritySoAEvent event;
+
+		const PolaritySoAEvent *operator->() const noexcept {
+			return (&event);
+		}
+	};
+
+	// Iterator traits. Events are assembled from the field arrays on access,
+	// so this is a read-only iterator, returning them by value.
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type        = PolaritySoAEvent;
+	using pointer           = EventPointer;
+	using reference         = PolaritySoAEvent;
+	using difference_type   = ptrdiff_t;
+	using size_type         = int32_t;
+
+	// Constructors.
+	PolaritySoAEventPacketIterator() : packet(nullptr), index(0) {
+	}
+
+	PolaritySoAEventPacketIterator(caerPolaritySoAEventPacketConst _packet, size_type _index) :
+		packet(_packet),
+		index(_index) {
+	}
+
+	// Data access operators.
+	reference operator*() const noexcept {
+		int32_t timestamp = caerPolaritySoAEventPacketGetTimestampsConst(packet)[index];
+		uint16_t xAddress = caerPolaritySoAEventPacketGetXAddressesConst(packet)[index];
+		uint16_t yAddress = caerPolaritySoAEventPacketGetYAddressesConst(packet)[index];
+		bool polarity     = (caerPolaritySoAEventPacketGetPolaritiesConst(packet)[index] != 0);
+
+		return (PolaritySoAEvent{static_cast<int32_t>(le32toh(static_cast<uint32_t>(timestamp))), le16toh(xAddress),
+			le16toh(yAddress), polarity});
+	}
+
+	pointer operator->() const noexcept {
+		return (EventPointer{**this});
+	}
+
+	reference operator[](size_type offset) const noexcept {
+		return (*(*this + offset));
+	}
+
+	// Comparison operators.
+	bool operator==(const PolaritySoAEventPacketIterator &rhs) const noexcept {
+		return ((packet == rhs.packet) && (index == rhs.index));
+	}
+
+	bool operator!=(const PolaritySoAEventPacketIterator &rhs) const noexcept {
+		return (!(*this == rhs));
+	}
+
+	bool operator<(const PolaritySoAEventPacketIterator &rhs) const noexcept {
+		return (index < rhs.index);
+	}
+
+	bool operator>(const PolaritySoAEventPacketIterator &rhs) const noexcept {
+		return (index > rhs.index);
+	}
+
+	bool operator<=(const PolaritySoAEventPacketIterator &rhs) const noexcept {
+		return (index <= rhs.index);
+	}
+
+	bool operator>=(const PolaritySoAEventPacketIterator &rhs) const noexcept {
+		return (index >= rhs.index);
+	}
+
+	// Prefix increment.
+	PolaritySoAEventPacketIterator &operator++() noexcept {
+		index++;
+		return (*this);
+	}
+
+	// Postfix increment.
+	PolaritySoAEventPacketIterator operator++(int) noexcept {
+		return (PolaritySoAEventPacketIterator(packet, index++));
+	}
+
+	// Prefix decrement.
+	PolaritySoAEventPacketIterator &operator--() noexcept {
+		index--;
+		return (*this);
+	}
+
+	// Postfix decrement.
+	PolaritySoAEventPacketIterator operator--(int) noexcept {
+		return (PolaritySoAEventPacketIterator(packet, index--));
+	}
+
+	// Iter += N.
+	PolaritySoAEventPacketIterator &operator+=(size_type add) noexcept {
+		index += add;
+		return (*this);
+	}
+
+	// Iter + N.
+	PolaritySoAEventPacketIterator operator+(size_type add) const noexcept {
+		return (PolaritySoAEventPacketIterator(packet, index + add));
+	}
+
+	// N + Iter. Must be friend as Iter is right-hand-side.
+	friend PolaritySoAEventPacketIterator operator+(
+		size_type lhs, const PolaritySoAEventPacketIterator &rhs) noexcept {
+		return (PolaritySoAEventPacketIterator(rhs.packet, rhs.index + lhs));
+	}
+
+	// Iter -= N.
+	PolaritySoAEventPacketIterator &operator-=(size_type sub) noexcept {
+		index -= sub;
+		return (*this);
+	}
+
+	// Iter - N. (N - Iter doesn't make sense!)
+	PolaritySoAEventPacketIterator operator-(size_type sub) const noexcept {
+		return (PolaritySoAEventPacketIterator(packet, index - sub));
+	}
+
+	// Iter - Iter. (Iter + Iter doesn't make sense!)
+	difference_type operator-(const PolaritySoAEventPacketIterator &rhs) const noexcept {
+		return (index - rhs.index);
+	}
+
+	// Swap two iterators.
+	void swap(PolaritySoAEventPacketIterator &rhs) noexcept {
+		std::swap(packet, rhs.packet);
+		std::swap(index, rhs.index);
+	}
+};
+
+class PolaritySoAEventPacket : public EventPacket {
+public:
+	// Container traits.
+	using value_type       = PolaritySoAEvent;
+	using const_value_type = const PolaritySoAEvent;
+	using size_type        = int32_t;
+	using difference_type  = ptrdiff_t;
+
+	// Constructors.
+	PolaritySoAEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		caerPolaritySoAEventPacket packet = caerPolaritySoAEventPacketAllocate(eventCapacity, eventSource, tsOverflow);
+		constructorCheckNullptr(packet);
+
+		header        = &packet->packetHeader;
+		isMemoryOwner = true; // Always owner on new allocation!
+	}
+
+	PolaritySoAEventPacket(caerPolaritySoAEventPacket packet, bool takeMemoryOwnership = true) {
+		constructorCheckNullptr(packet);
+
+		constructorCheckEventType(&packet->packetHeader, POLARITY_SOA_EVENT);
+
+		header        = &packet->packetHeader;
+		isMemoryOwner = takeMemoryOwnership;
+	}
+
+	PolaritySoAEventPacket(caerEventPacketHeader packetHeader, bool takeMemoryOwnership = true) {
+		constructorCheckNullptr(packetHeader);
+
+		constructorCheckEventType(packetHeader, POLARITY_SOA_EVENT);
+
+		header        = packetHeader;
+		isMemoryOwner = takeMemoryOwnership;
+	}
+
+	// Conversion from the standard polarity packet layout.
+	explicit PolaritySoAEventPacket(const PolarityEventPacket &packet) {
+		caerPolaritySoAEventPacket soaPacket = caerPolaritySoAEventPacketFromPolarityPacket(
+			reinterpret_cast<caerPolarityEventPacketConst>(packet.getHeaderPointer()));
+		if (soaPacket == nullptr) {
+			throw std::bad_alloc();
+		}
+
+		header        = &soaPacket->packetHeader;
+		isMemoryOwner = true; // Always owner on new allocation!
+	}
+
+	// Field arrays access methods, values are little-endian.
+	int32_t *getTimestamps() noexcept {
+		return (caerPolaritySoAEventPacketGetTimestamps(reinterpret_cast<caerPolaritySoAEventPacket>(header)));
+	}
+
+	const int32_t *getTimestamps() const noexcept {
+		return (
+			caerPolaritySoAEventPacketGetTimestampsConst(reinterpret_cast<caerPolaritySoAEventPacketConst>(header)));
+	}
+
+	uint16_t *getXAddresses() noexcept {
+		return (caerPolaritySoAEventPacketGetXAddresses(reinterpret_cast<caerPolaritySoAEventPacket>(header)));
+	}
+
+	const uint16_t *getXAddresses() const noexcept {
+		return (
+			caerPolaritySoAEventPacketGetXAddressesConst(reinterpret_cast<caerPolaritySoAEventPacketConst>(header)));
+	}
+
+	uint16_t *getYAddresses() noexcept {
+		return (caerPolaritySoAEventPacketGetYAddresses(reinterpret_cast<caerPolaritySoAEventPacket>(header)));
+	}
+
+	const uint16_t *getYAddresses() const noexcept {
+		return (
+			caerPolaritySoAEventPacketGetYAddressesConst(reinterpret_cast<caerPolaritySoAEventPacketConst>(header)));
+	}
+
+	uint8_t *getPolarities() noexcept {
+		return (caerPolaritySoAEventPacketGetPolarities(reinterpret_cast<caerPolaritySoAEventPacket>(header)));
+	}
+
+	const uint8_t *getPolarities() const noexcept {
+		return (
+			caerPolaritySoAEventPacketGetPolaritiesConst(reinterpret_cast<caerPolaritySoAEventPacketConst>(header)));
+	}
+
+	// Event access methods, events are assembled from the field arrays.
+	value_type getEvent(size_type index) const {
+		return (*(cbegin() + getEventIndex(index, false)));
+	}
+
+	value_type operator[](size_type index) const {
+		return (getEvent(index));
+	}
+
+	// Conversion from/to the standard polarity packet layout, into existing packets.
+	void fromPolarityEventPacket(const PolarityEventPacket &packet) {
+		if (!caerPolarityEventPacketToSoA(reinterpret_cast<caerPolarityEventPacketConst>(packet.getHeaderPointer()),
+				reinterpret_cast<caerPolaritySoAEventPacket>(header))) {
+			throw std::length_error("Event capacity too small for conversion.");
+		}
+	}
+
+	void toPolarityEventPacket(PolarityEventPacket &packet) const {
+		if (!caerPolaritySoAEventPacketToAoS(reinterpret_cast<caerPolaritySoAEventPacketConst>(header),
+				reinterpret_cast<caerPolarityEventPacket>(packet.getHeaderPointer()))) {
+			throw std::length_error("Event capacity too small for conversion.");
+		}
+	}
+
+	std::unique_ptr<PolarityEventPacket> toPolarityEventPacket() const {
+		caerPolarityEventPacket packet
+			= caerPolarityEventPacketFromSoAPacket(reinterpret_cast<caerPolaritySoAEventPacketConst>(header));
+		if (packet == nullptr) {
+			throw std::bad_alloc();
+		}
+
+		return (std::unique_ptr<PolarityEventPacket>(new PolarityEventPacket(packet)));
+	}
+
+	std::unique_ptr<PolaritySoAEventPacket> copy(copyTypes ct) const {
+		return (std::unique_ptr<PolaritySoAEventPacket>(
+			static_cast<PolaritySoAEventPacket *>(virtualCopy(ct).release())));
+	}
+
+	// Iterator support.
+	using iterator               = PolaritySoAEventPacketIterator;
+	using const_iterator         = PolaritySoAEventPacketIterator;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	const_iterator begin() const noexcept {
+		return (cbegin());
+	}
+
+	const_iterator end() const noexcept {
+		return (cend());
+	}
+
+	const_iterator cbegin() const noexcept {
+		return (const_iterator(reinterpret_cast<caerPolaritySoAEventPacketConst>(header), 0));
+	}
+
+	const_iterator cend() const noexcept {
+		return (const_iterator(reinterpret_cast<caerPolaritySoAEventPacketConst>(header), size()));
+	}
+
+	const_reverse_iterator rbegin() const noexcept {
+		return (crbegin());
+	}
+
+	const_reverse_iterator rend() const noexcept {
+		return (crend());
+	}
+
+	const_reverse_iterator crbegin() const noexcept {
+		return (const_reverse_iterator(cend()));
+	}
+
+	const_reverse_iterator crend() const noexcept {
+		return (const_reverse_iterator(cbegin()));
+	}
+
+protected:
+	std::unique_ptr<EventPacket> virtualCopy(copyTypes ct) const override {
+		return (std::unique_ptr<PolaritySoAEventPacket>(new PolaritySoAEventPacket(internalCopy(header, ct))));
+	}
+};
 } // namespace events
 } // namespace libcaer
 
@@ -33,6 +33,11 @@ inline std::unique_ptr<EventPacket> makeUniqueFromCStruct(
 			return (std::unique_ptr<PolarityEventPacket>(new PolarityEventPacket(packet, takeMemoryOwnership)));
 			break;
 
+		case POLARITY_SOA_EVENT:
+			return (
+				std::unique_ptr<PolaritySoAEventPacket>(new PolaritySoAEventPacket(packet, takeMemoryOwnership)));
+			break;
+
 		case FRAME_EVENT:
 			return (std::unique_ptr<FrameEventPacket>(new FrameEventPacket(packet, takeMemoryOwnership)));
 			break;
@@ -66,6 +71,10 @@ inline std::shared_ptr<EventPacket> makeSharedFromCStruct(
 			return (std::make_shared<PolarityEventPacket>(packet, takeMemoryOwnership));
 			break;
 
+		case POLARITY_SOA_EVENT:
+			return (std::make_shared<PolaritySoAEventPacket>(packet, takeMemoryOwnership));
+			break;
+
 		case FRAME_EVENT:
 			return (std::make_shared<FrameEventPacket>(packet, takeMemoryOwnership));
 			break;
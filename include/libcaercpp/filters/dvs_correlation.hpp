@@ -0,0 +1,101 @@
+#ifndef LIBCAER_FILTERS_DVS_CORRELATION_HPP_
+#define LIBCAER_FILTERS_DVS_CORRELATION_HPP_
+
+#include "../events/polarity.hpp"
+
+#include "../../libcaer/filters/dvs_correlation.h"
+
+#include <memory>
+#include <string>
+
+namespace libcaer {
+namespace filters {
+
+class DVSCorrelation {
+private:
+	std::shared_ptr<struct caer_filter_dvs_correlation> handle;
+
+public:
+	DVSCorrelation(uint16_t sizeX, uint16_t sizeY) {
+		caerFilterDVSCorrelation h = caerFilterDVSCorrelationInitialize(sizeX, sizeY);
+
+		// Handle constructor failure.
+		if (h == nullptr) {
+			std::string exc = "Failed to initialize DVS Correlation filter, sizeX=" + std::to_string(sizeX)
+							  + ", sizeY=" + std::to_string(sizeY) + ".";
+			throw std::runtime_error(exc);
+		}
+
+		// Use stateless lambda for shared_ptr custom deleter.
+		auto deleteDeviceHandle = [](caerFilterDVSCorrelation fh) {
+			// Run destructor, free all memory.
+			// Never fails in current implementation.
+			caerFilterDVSCorrelationDestroy(fh);
+		};
+
+		handle = std::shared_ptr<struct caer_filter_dvs_correlation>(h, deleteDeviceHandle);
+	}
+
+	~DVSCorrelation() = default;
+
+	std::string toString() const noexcept {
+		return ("DVS Correlation filter");
+	}
+
+	void configSet(uint8_t paramAddr, uint64_t param) const {
+		bool success = caerFilterDVSCorrelationConfigSet(handle.get(), paramAddr, param);
+		if (!success) {
+			std::string exc = toString() + ": failed to set configuration parameter, paramAddr="
+							  + std::to_string(paramAddr) + ", param=" + std::to_string(param) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	void configGet(uint8_t paramAddr, uint64_t *param) const {
+		bool success = caerFilterDVSCorrelationConfigGet(handle.get(), paramAddr, param);
+		if (!success) {
+			std::string exc
+				= toString() + ": failed to get configuration parameter, paramAddr=" + std::to_string(paramAddr) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	uint64_t configGet(uint8_t paramAddr) const {
+		uint64_t param = 0;
+		configGet(paramAddr, &param);
+		return (param);
+	}
+
+	void apply(caerPolarityEventPacket polarity) const noexcept {
+		caerFilterDVSCorrelationApply(handle.get(), polarity);
+	}
+
+	void apply(libcaer::events::PolarityEventPacket &polarity) const noexcept {
+		caerFilterDVSCorrelationApply(handle.get(), (caerPolarityEventPacket) polarity.getHeaderPointer());
+	}
+
+	void apply(libcaer::events::PolarityEventPacket *polarity) const noexcept {
+		if (polarity != nullptr) {
+			caerFilterDVSCorrelationApply(handle.get(), (caerPolarityEventPacket) polarity->getHeaderPointer());
+		}
+	}
+
+	void apply(caerPolarityEventPacketConst polarity) const noexcept {
+		caerFilterDVSCorrelationStatsApply(handle.get(), polarity);
+	}
+
+	void apply(const libcaer::events::PolarityEventPacket &polarity) const noexcept {
+		caerFilterDVSCorrelationStatsApply(handle.get(), (caerPolarityEventPacketConst) polarity.getHeaderPointer());
+	}
+
+	void apply(const libcaer::events::PolarityEventPacket *polarity) const noexcept {
+		if (polarity != nullptr) {
+			caerFilterDVSCorrelationStatsApply(
+				handle.get(), (caerPolarityEventPacketConst) polarity->getHeaderPointer());
+		}
+	}
+};
+} // namespace filters
+} // namespace libcaer
+
+#endif /* LIBCAER_FILTERS_DVS_CORRELATION_HPP_ */
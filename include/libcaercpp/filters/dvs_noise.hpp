@@ -17,13 +17,16 @@ private:
 	std::shared_ptr<struct caer_filter_dvs_noise> handle;
 
 public:
-	DVSNoise(uint16_t sizeX, uint16_t sizeY) {
-		caerFilterDVSNoise h = caerFilterDVSNoiseInitialize(sizeX, sizeY);
+	DVSNoise(uint16_t sizeX, uint16_t sizeY) : DVSNoise(sizeX, sizeY, CAER_FILTER_DVS_MAP_LAYOUT_ROWS) {
+	}
+
+	DVSNoise(uint16_t sizeX, uint16_t sizeY, uint8_t mapLayout) {
+		caerFilterDVSNoise h = caerFilterDVSNoiseInitializeLayout(sizeX, sizeY, mapLayout);
 
 		// Handle constructor failure.
 		if (h == nullptr) {
 			std::string exc = "Failed to initialize DVS Noise filter, sizeX=" + std::to_string(sizeX)
-							  + ", sizeY=" + std::to_string(sizeY) + ".";
+							  + ", sizeY=" + std::to_string(sizeY) + ", mapLayout=" + std::to_string(mapLayout) + ".";
 			throw std::runtime_error(exc);
 		}
 
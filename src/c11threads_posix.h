@@ -15,6 +15,7 @@
 
 typedef void *thrd_t;
 typedef HANDLE mtx_t;
+typedef HANDLE cnd_t;
 
 #else
 #	define _DARWIN_C_SOURCE 1
@@ -27,10 +28,12 @@ typedef HANDLE mtx_t;
 
 typedef pthread_t thrd_t;
 typedef pthread_mutex_t mtx_t;
+typedef pthread_cond_t cnd_t;
 #endif
 
 #if !defined(__WINDOWS__) && !defined(__APPLE__)
 #	include <sys/prctl.h>
+#	include <sys/syscall.h>
 #	include <unistd.h>
 #endif
 
@@ -186,6 +189,31 @@ static inline int mtx_lock(mtx_t *mutex) {
 	return (thrd_success);
 }
 
+static inline int mtx_trylock(mtx_t *mutex) {
+#if defined(__WINDOWS__)
+	DWORD ret = WaitForSingleObject(*mutex, 0);
+
+	if (ret == WAIT_TIMEOUT) {
+		return (thrd_busy);
+	}
+
+	if (ret != WAIT_OBJECT_0) {
+		return (thrd_error);
+	}
+#else
+	int ret = pthread_mutex_trylock(mutex);
+
+	if (ret == EBUSY) {
+		return (thrd_busy);
+	}
+
+	if (ret != 0) {
+		return (thrd_error);
+	}
+#endif
+	return (thrd_success);
+}
+
 static inline int mtx_unlock(mtx_t *mutex) {
 #if defined(__WINDOWS__)
 	if (!ReleaseMutex(*mutex)) {
@@ -199,6 +227,159 @@ static inline int mtx_unlock(mtx_t *mutex) {
 	return (thrd_success);
 }
 
+static inline int cnd_init(cnd_t *cond) {
+#if defined(__WINDOWS__)
+	// Auto-reset event: mtx_t is a kernel mutex on Windows, which cannot be
+	// used with native condition variables. A pending signal stays set until
+	// a waiter consumes it, so wake-ups are never lost.
+	*cond = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+	if (*cond == NULL) {
+		return (thrd_error);
+	}
+#elif defined(__APPLE__)
+	// Timed waits are relative on macOS, see cnd_timedwait().
+	if (pthread_cond_init(cond, NULL) != 0) {
+		return (thrd_error);
+	}
+#else
+	// Timed waits are measured on the monotonic clock, see cnd_timedwait().
+	pthread_condattr_t attr;
+	if (pthread_condattr_init(&attr) != 0) {
+		return (thrd_error);
+	}
+
+	if (pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0) {
+		pthread_condattr_destroy(&attr);
+		return (thrd_error);
+	}
+
+	if (pthread_cond_init(cond, &attr) != 0) {
+		pthread_condattr_destroy(&attr);
+		return (thrd_error);
+	}
+
+	pthread_condattr_destroy(&attr);
+#endif
+	return (thrd_success);
+}
+
+static inline void cnd_destroy(cnd_t *cond) {
+#if defined(__WINDOWS__)
+	CloseHandle(*cond);
+#else
+	pthread_cond_destroy(cond);
+#endif
+}
+
+static inline int cnd_signal(cnd_t *cond) {
+#if defined(__WINDOWS__)
+	if (!SetEvent(*cond)) {
+		return (thrd_error);
+	}
+#else
+	if (pthread_cond_signal(cond) != 0) {
+		return (thrd_error);
+	}
+#endif
+	return (thrd_success);
+}
+
+static inline int cnd_broadcast(cnd_t *cond) {
+#if defined(__WINDOWS__)
+	// Only meaningful for a single waiter on Windows.
+	if (!SetEvent(*cond)) {
+		return (thrd_error);
+	}
+#else
+	if (pthread_cond_broadcast(cond) != 0) {
+		return (thrd_error);
+	}
+#endif
+	return (thrd_success);
+}
+
+static inline int cnd_wait(cnd_t *cond, mtx_t *mutex) {
+#if defined(__WINDOWS__)
+	if (!ReleaseMutex(*mutex)) {
+		return (thrd_error);
+	}
+
+	DWORD ret = WaitForSingleObject(*cond, INFINITE);
+
+	if (WaitForSingleObject(*mutex, INFINITE) == WAIT_ABANDONED) {
+		return (thrd_error);
+	}
+
+	if (ret != WAIT_OBJECT_0) {
+		return (thrd_error);
+	}
+#else
+	if (pthread_cond_wait(cond, mutex) != 0) {
+		return (thrd_error);
+	}
+#endif
+	return (thrd_success);
+}
+
+// NON STANDARD! Wait until signaled or until usec microseconds have passed.
+// The timeout is relative and measured on a monotonic clock, so changes to the
+// wall-clock time can neither stretch nor cut it short.
+static inline int cnd_timedwait(cnd_t *cond, mtx_t *mutex, const int64_t usec) {
+#if defined(__WINDOWS__)
+	// Windows wait timeouts are relative and do not follow the system time.
+	DWORD waitMs = (usec > 0) ? (DWORD) (usec / 1000) : 0;
+
+	if (!ReleaseMutex(*mutex)) {
+		return (thrd_error);
+	}
+
+	DWORD ret = WaitForSingleObject(*cond, waitMs);
+
+	if (WaitForSingleObject(*mutex, INFINITE) == WAIT_ABANDONED) {
+		return (thrd_error);
+	}
+
+	if (ret == WAIT_TIMEOUT) {
+		return (thrd_timedout);
+	}
+
+	if (ret != WAIT_OBJECT_0) {
+		return (thrd_error);
+	}
+#else
+#	if defined(__APPLE__)
+	struct timespec time_span = {.tv_sec = usec / 1000000LL, .tv_nsec = (usec % 1000000LL) * 1000LL};
+
+	int ret = pthread_cond_timedwait_relative_np(cond, mutex, &time_span);
+#	else
+	struct timespec time_point;
+	if (clock_gettime(CLOCK_MONOTONIC, &time_point) != 0) {
+		return (thrd_error);
+	}
+
+	time_point.tv_sec += (time_t) (usec / 1000000LL);
+	time_point.tv_nsec += (long) ((usec % 1000000LL) * 1000LL);
+
+	if (time_point.tv_nsec >= 1000000000L) {
+		time_point.tv_sec++;
+		time_point.tv_nsec -= 1000000000L;
+	}
+
+	int ret = pthread_cond_timedwait(cond, mutex, &time_point);
+#	endif
+
+	if (ret == ETIMEDOUT) {
+		return (thrd_timedout);
+	}
+
+	if (ret != 0) {
+		return (thrd_error);
+	}
+#endif
+	return (thrd_success);
+}
+
 // NON STANDARD!
 static inline int thrd_set_name(const char *name) {
 #if defined(__linux__)
@@ -244,4 +425,80 @@ static inline int thrd_get_name(char *name, size_t maxNameLength) {
 #endif
 }
 
+// NON STANDARD! Restrict the calling thread to the CPUs set in 'cpuMask'
+// (bit 0 is CPU 0), or allow it to run on all CPUs again if zero.
+static inline int thrd_set_affinity(uint32_t cpuMask) {
+#if defined(__linux__)
+	// No dependency on _GNU_SOURCE for cpu_set_t: the kernel takes plain bitmasks,
+	// and ignores bits of non-existing CPUs, so all-ones means all CPUs.
+	unsigned long mask[1024 / (8 * sizeof(unsigned long))];
+
+	for (size_t i = 0; i < (sizeof(mask) / sizeof(unsigned long)); i++) {
+		mask[i] = (cpuMask == 0) ? (~0UL) : ((i == 0) ? (cpuMask) : (0));
+	}
+
+	if (syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask) != 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+#elif defined(__WINDOWS__)
+	// The thread mask must be a subset of the process one, so all CPUs means
+	// all the CPUs the process may run on.
+	DWORD_PTR processMask, systemMask;
+
+	if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask) == 0) {
+		return (thrd_error);
+	}
+
+	DWORD_PTR mask = (cpuMask == 0) ? (processMask) : ((DWORD_PTR) cpuMask & processMask);
+
+	if (mask == 0) {
+		return (thrd_error);
+	}
+
+	if (SetThreadAffinityMask(GetCurrentThread(), mask) == 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+#else
+	(void) (cpuMask); // UNUSED.
+
+	return (thrd_error);
+#endif
+}
+
+// NON STANDARD! Switch the calling thread to real-time FIFO scheduling with
+// the given priority (1-99, clamped to what the system supports), or back to
+// default scheduling if zero. Usually needs elevated privileges.
+static inline int thrd_set_realtime_priority(int priority) {
+#if defined(__WINDOWS__)
+	if (SetThreadPriority(GetCurrentThread(), (priority == 0) ? (THREAD_PRIORITY_NORMAL)
+															  : (THREAD_PRIORITY_TIME_CRITICAL))
+		== 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+#else
+	int policy               = (priority == 0) ? (SCHED_OTHER) : (SCHED_FIFO);
+	struct sched_param param = {.sched_priority = 0};
+
+	if (priority != 0) {
+		int minPriority = sched_get_priority_min(SCHED_FIFO);
+		int maxPriority = sched_get_priority_max(SCHED_FIFO);
+
+		param.sched_priority
+			= (priority < minPriority) ? (minPriority) : ((priority > maxPriority) ? (maxPriority) : (priority));
+	}
+
+	if (pthread_setschedparam(pthread_self(), policy, &param) != 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+#endif
+}
+
 #endif /* C11THREADS_POSIX_H_ */
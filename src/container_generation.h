@@ -3,16 +3,66 @@
 
 #include "libcaer/libcaer.h"
 
+#include "libcaer/devices/device.h"
+#include "libcaer/events/common.h"
+#include "libcaer/events/polarity.h"
+#include "libcaer/events/raw.h"
 #include "libcaer/events/special.h"
+#include "libcaer/ringbuffer.h"
 
 #include "data_exchange.h"
+#include "data_statistics.h"
 #include "timestamps.h"
 
+#include <assert.h>
+
+#define CONTAINER_GENERATION_MAX_PACKETS 8
+
+// Exponentially weighted moving average of the event count per container,
+// with a weight of 1/2^CONTAINER_GENERATION_SIZE_EWMA_SHIFT for new samples.
+#define CONTAINER_GENERATION_SIZE_EWMA_SHIFT 3
+
+// Per-event-type commit triggers, one for each default event type. Their parameter
+// addresses must not run into the next range, nor past the 8 bit address space.
+#define CONTAINER_GENERATION_TYPE_COMMIT_TYPES CAER_DEFAULT_EVENT_TYPES_COUNT
+
+static_assert((CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE + CONTAINER_GENERATION_TYPE_COMMIT_TYPES)
+				  <= CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL,
+	"Per-type commit size addresses overlap the interval ones.");
+static_assert((CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL + CONTAINER_GENERATION_TYPE_COMMIT_TYPES) <= 256,
+	"Per-type commit interval addresses exceed the parameter address range.");
+
+struct type_commit_trigger {
+	atomic_uint_fast32_t size;
+	atomic_uint_fast32_t interval;
+	int64_t firstTimestamp; // Of the first event of this type in the current container, -1 if none yet.
+};
+
+struct packet_size_prediction {
+	int32_t defaultSize;
+	int64_t averageSizeScaled; // Scaled by 2^CONTAINER_GENERATION_SIZE_EWMA_SHIFT.
+	atomic_uint_fast32_t predictedSize;
+	atomic_uint_fast32_t actualSize;
+};
+
 struct container_generation {
 	caerEventPacketContainer currentPacketContainer;
 	atomic_uint_fast32_t maxPacketContainerPacketSize;
 	atomic_uint_fast32_t maxPacketContainerInterval;
 	int64_t currentPacketContainerCommitTimestamp;
+	atomic_uint_fast32_t maxPacketContainerLatency;
+	int64_t commitLatencyDeadline; // Host monotonic clock, in µs. Zero if not armed.
+	struct type_commit_trigger typeCommit[CONTAINER_GENERATION_TYPE_COMMIT_TYPES];
+	atomic_bool typeCommitEnabled; // Any per-event-type trigger set.
+	atomic_uint_fast32_t recyclePoolSize; // Only takes effect on DataStart() calls!
+	caerRingBuffer recyclePool;           // Consumer to producer, containers given back by the user.
+	caerEventPacketHeader recycledPackets[CONTAINER_GENERATION_MAX_PACKETS];
+	atomic_uint_fast32_t recyclePoolHits;
+	atomic_uint_fast32_t recyclePoolMisses;
+	struct packet_size_prediction polaritySize;
+	atomic_bool polaritySoA;
+	caerEventPacketHeader polaritySoASpare; // Recycled polarity SoA packet, to convert into.
+	struct data_statistics statistics;
 };
 
 typedef struct container_generation *containerGeneration;
@@ -22,6 +72,68 @@ static inline void containerGenerationSettingsInit(containerGeneration state) {
 	// By default governed by time only, set at 10 milliseconds.
 	atomic_store(&state->maxPacketContainerPacketSize, 0);
 	atomic_store(&state->maxPacketContainerInterval, 10000);
+
+	// No host-clock latency bound by default.
+	atomic_store(&state->maxPacketContainerLatency, 0);
+
+	// No per-event-type commit triggers by default.
+	for (size_t i = 0; i < CONTAINER_GENERATION_TYPE_COMMIT_TYPES; i++) {
+		atomic_store(&state->typeCommit[i].size, 0);
+		atomic_store(&state->typeCommit[i].interval, 0);
+		state->typeCommit[i].firstTimestamp = -1;
+	}
+
+	atomic_store(&state->typeCommitEnabled, false);
+
+	// Container recycling is opt-in, disabled by default.
+	atomic_store(&state->recyclePoolSize, 0);
+
+	// Polarity events in their standard packet layout by default.
+	atomic_store(&state->polaritySoA, false);
+}
+
+static inline bool containerGenerationPoolInit(containerGeneration state) {
+	atomic_store(&state->recyclePoolHits, 0);
+	atomic_store(&state->recyclePoolMisses, 0);
+
+	uint32_t poolSize = U32T(atomic_load(&state->recyclePoolSize));
+	if (poolSize == 0) {
+		state->recyclePool = NULL;
+		return (true);
+	}
+
+	// Ring-buffer needs a power of two size, round up.
+	uint32_t ringSize = 1;
+	while ((ringSize < poolSize) && (ringSize < (UINT32_C(1) << 31))) {
+		ringSize <<= 1;
+	}
+
+	state->recyclePool = caerRingBufferInit(ringSize);
+	if (state->recyclePool == NULL) {
+		return (false);
+	}
+
+	return (true);
+}
+
+static inline void containerGenerationPoolDestroy(containerGeneration state) {
+	if (state->recyclePool != NULL) {
+		caerEventPacketContainer container;
+		while ((container = caerRingBufferGet(state->recyclePool)) != NULL) {
+			caerEventPacketContainerFree(container);
+		}
+
+		caerRingBufferFree(state->recyclePool);
+		state->recyclePool = NULL;
+	}
+
+	for (size_t i = 0; i < CONTAINER_GENERATION_MAX_PACKETS; i++) {
+		caerEventPacketFree(state->recycledPackets[i]);
+		state->recycledPackets[i] = NULL;
+	}
+
+	caerEventPacketFree(state->polaritySoASpare);
+	state->polaritySoASpare = NULL;
 }
 
 static inline void containerGenerationDestroy(containerGeneration state) {
@@ -29,6 +141,79 @@ static inline void containerGenerationDestroy(containerGeneration state) {
 		caerEventPacketContainerFree(state->currentPacketContainer);
 		state->currentPacketContainer = NULL;
 	}
+
+	containerGenerationPoolDestroy(state);
+}
+
+/**
+ * Give a container back to the producer for reuse. Called from the consumer
+ * side only. If recycling is disabled or the pool is full, the container
+ * is simply freed.
+ */
+static inline void containerGenerationRecycle(containerGeneration state, caerEventPacketContainer container) {
+	if (container == NULL) {
+		return;
+	}
+
+	if ((state->recyclePool == NULL) || !caerRingBufferPut(state->recyclePool, container)) {
+		caerEventPacketContainerFree(container);
+	}
+}
+
+/**
+ * Take a packet out of the last recycled container, if it has the right type,
+ * and reset it so that it looks freshly allocated. If it is smaller than the
+ * wanted capacity, it is grown in place, so that a changing capacity (like the
+ * polarity size prediction) doesn't throw recycled packets away. Returns NULL
+ * if no such packet is available, in which case the caller has to allocate
+ * a new one.
+ */
+static inline caerEventPacketHeader containerGenerationPacketReuse(
+	containerGeneration state, int32_t pos, int16_t eventType, int32_t eventCapacity, int32_t tsOverflow) {
+	if ((state->recyclePool == NULL) || (pos < 0) || (pos >= CONTAINER_GENERATION_MAX_PACKETS)) {
+		return (NULL);
+	}
+
+	caerEventPacketHeader packet = state->recycledPackets[pos];
+	state->recycledPackets[pos]  = NULL;
+
+	if ((packet == NULL) || (caerEventPacketHeaderGetEventType(packet) != eventType)) {
+		caerEventPacketFree(packet);
+
+		atomic_fetch_add_explicit(&state->recyclePoolMisses, 1, memory_order_relaxed);
+		return (NULL);
+	}
+
+	// Only events up to eventNumber (plus a possibly partially written one)
+	// can have been touched, everything after is still zero.
+	int32_t eventCapacityOld = caerEventPacketHeaderGetEventCapacity(packet);
+	int32_t eventsUsed       = caerEventPacketHeaderGetEventNumber(packet) + 1;
+	if (eventsUsed > eventCapacityOld) {
+		eventsUsed = eventCapacityOld;
+	}
+
+	memset(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, 0,
+		(size_t) eventsUsed * (size_t) caerEventPacketHeaderGetEventSize(packet));
+
+	caerEventPacketHeaderSetEventNumber(packet, 0);
+	caerEventPacketHeaderSetEventValid(packet, 0);
+	caerEventPacketHeaderSetEventTSOverflow(packet, tsOverflow);
+
+	// Growing zeroes the new events, the old ones were just cleared.
+	if (eventCapacityOld < eventCapacity) {
+		caerEventPacketHeader grownPacket = caerEventPacketGrow(packet, eventCapacity);
+		if (grownPacket == NULL) {
+			caerEventPacketFree(packet);
+
+			atomic_fetch_add_explicit(&state->recyclePoolMisses, 1, memory_order_relaxed);
+			return (NULL);
+		}
+
+		packet = grownPacket;
+	}
+
+	atomic_fetch_add_explicit(&state->recyclePoolHits, 1, memory_order_relaxed);
+	return (packet);
 }
 
 static inline void containerGenerationSetPacket(containerGeneration state, int32_t pos, caerEventPacketHeader packet) {
@@ -38,6 +223,42 @@ static inline void containerGenerationSetPacket(containerGeneration state, int32
 }
 
 static inline bool containerGenerationAllocate(containerGeneration state, int32_t eventPacketNumber) {
+	if ((state->currentPacketContainer == NULL) && (state->recyclePool != NULL)) {
+		caerEventPacketContainer container = caerRingBufferGet(state->recyclePool);
+
+		if ((container != NULL) && (caerEventPacketContainerGetEventPacketsNumber(container) == eventPacketNumber)
+			&& (eventPacketNumber <= CONTAINER_GENERATION_MAX_PACKETS)) {
+			// Keep its packets around for reuse by the translator, by position.
+			// Polarity SoA packets are never filled by the translator directly,
+			// but only at commit time, see containerGenerationPolarityToSoA().
+			for (int32_t i = 0; i < eventPacketNumber; i++) {
+				if ((container->eventPackets[i] != NULL)
+					&& (caerEventPacketHeaderGetEventType(container->eventPackets[i]) == POLARITY_SOA_EVENT)) {
+					caerEventPacketFree(state->polaritySoASpare);
+					state->polaritySoASpare    = container->eventPackets[i];
+					container->eventPackets[i] = NULL;
+				}
+				else if (container->eventPackets[i] != NULL) {
+					caerEventPacketFree(state->recycledPackets[i]);
+					state->recycledPackets[i] = container->eventPackets[i];
+					container->eventPackets[i] = NULL;
+				}
+			}
+
+			caerEventPacketContainerUpdateStatistics(container);
+
+			state->currentPacketContainer = container;
+
+			atomic_fetch_add_explicit(&state->recyclePoolHits, 1, memory_order_relaxed);
+			return (true);
+		}
+
+		// Unusable (like the single packet timestamp reset ones) or no container available.
+		caerEventPacketContainerFree(container);
+
+		atomic_fetch_add_explicit(&state->recyclePoolMisses, 1, memory_order_relaxed);
+	}
+
 	if (state->currentPacketContainer == NULL) {
 		// Allocate packets.
 		state->currentPacketContainer = caerEventPacketContainerAllocate(eventPacketNumber);
@@ -53,6 +274,63 @@ static inline int32_t containerGenerationGetMaxPacketSize(containerGeneration st
 	return (I32T(atomic_load_explicit(&state->maxPacketContainerPacketSize, memory_order_relaxed)));
 }
 
+static inline void containerGenerationPolaritySizeInit(containerGeneration state, int32_t defaultSize) {
+	state->polaritySize.defaultSize       = defaultSize;
+	state->polaritySize.averageSizeScaled = 0;
+
+	atomic_store(&state->polaritySize.predictedSize, U32T(defaultSize));
+	atomic_store(&state->polaritySize.actualSize, 0);
+}
+
+/**
+ * Update the polarity packet size prediction with the number of events
+ * that went into the container being committed. New packets are then
+ * allocated with enough headroom to hold that average, so that they
+ * rarely have to grow while being filled.
+ * The prediction is rounded up to a power of two, so that it only changes
+ * when the average moves by a lot. Commits forced early by the per-type
+ * or latency triggers move the average down and up again all the time,
+ * and recycled packets would otherwise have to grow on most commits.
+ */
+static inline void containerGenerationPolaritySizeUpdate(containerGeneration state, int32_t actualSize) {
+	struct packet_size_prediction *prediction = &state->polaritySize;
+
+	prediction->averageSizeScaled
+		+= actualSize - (prediction->averageSizeScaled >> CONTAINER_GENERATION_SIZE_EWMA_SHIFT);
+
+	int64_t averageSize   = prediction->averageSizeScaled >> CONTAINER_GENERATION_SIZE_EWMA_SHIFT;
+	int64_t predictedSize = averageSize + (averageSize / 4); // 25% headroom.
+
+	if (predictedSize < prediction->defaultSize) {
+		predictedSize = prediction->defaultSize;
+	}
+
+	// Capacity classes: powers of two.
+	int64_t sizeClass = 1;
+	while (sizeClass < predictedSize) {
+		sizeClass <<= 1;
+	}
+
+	predictedSize = sizeClass;
+
+	// Never needed bigger than the size commit trigger, if enabled.
+	int32_t maxPacketSize = containerGenerationGetMaxPacketSize(state);
+	if ((maxPacketSize > 0) && (predictedSize > maxPacketSize)) {
+		predictedSize = (maxPacketSize > prediction->defaultSize) ? (maxPacketSize) : (prediction->defaultSize);
+	}
+
+	if (predictedSize > INT32_MAX) {
+		predictedSize = INT32_MAX;
+	}
+
+	atomic_store_explicit(&prediction->predictedSize, U32T(predictedSize), memory_order_relaxed);
+	atomic_store_explicit(&prediction->actualSize, U32T(actualSize), memory_order_relaxed);
+}
+
+static inline int32_t containerGenerationPolaritySizePredict(containerGeneration state) {
+	return (I32T(atomic_load_explicit(&state->polaritySize.predictedSize, memory_order_relaxed)));
+}
+
 static inline int32_t containerGenerationGetMaxInterval(containerGeneration state) {
 	return (I32T(atomic_load_explicit(&state->maxPacketContainerInterval, memory_order_relaxed)));
 }
@@ -66,6 +344,88 @@ static inline void containerGenerationCommitTimestampReset(containerGeneration s
 	// Set wanted time interval to uninitialized. Getting the first TS or TS_RESET
 	// will then set this correctly.
 	state->currentPacketContainerCommitTimestamp = -1;
+
+	// Latency deadline is armed again on its next check.
+	state->commitLatencyDeadline = 0;
+
+	for (size_t i = 0; i < CONTAINER_GENERATION_TYPE_COMMIT_TYPES; i++) {
+		state->typeCommit[i].firstTimestamp = -1;
+	}
+}
+
+static inline bool containerGenerationIsTypeCommitEnabled(containerGeneration state) {
+	return (atomic_load_explicit(&state->typeCommitEnabled, memory_order_relaxed));
+}
+
+/**
+ * Check the per-event-type commit triggers of 'eventType', whose packet holds
+ * 'position' events (see CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE). Only call
+ * this if containerGenerationIsTypeCommitEnabled(), after every event, like for
+ * the container-wide triggers, so that the time of the first event of a type
+ * in the container, which the interval trigger counts from, is known.
+ */
+static inline bool containerGenerationIsTypeCommitDue(
+	containerGeneration state, int16_t eventType, int32_t position, int64_t timestamp) {
+	if (position == 0) {
+		return (false);
+	}
+
+	struct type_commit_trigger *trigger = &state->typeCommit[eventType];
+
+	uint32_t size = U32T(atomic_load_explicit(&trigger->size, memory_order_relaxed));
+	if ((size != 0) && (U32T(position) >= size)) {
+		return (true);
+	}
+
+	uint32_t interval = U32T(atomic_load_explicit(&trigger->interval, memory_order_relaxed));
+	if (interval == 0) {
+		return (false);
+	}
+
+	if (trigger->firstTimestamp == -1) {
+		trigger->firstTimestamp = timestamp;
+	}
+
+	return ((timestamp - trigger->firstTimestamp) >= interval);
+}
+
+static inline int64_t containerGenerationHostTime(void) {
+	struct timespec currentTime;
+	portable_clock_gettime_monotonic(&currentTime);
+
+	return ((I64T(currentTime.tv_sec) * 1000000LL) + I64T(currentTime.tv_nsec / 1000));
+}
+
+/**
+ * Restart the host-clock latency bound, on every commit. The clock is only
+ * read if the bound is enabled.
+ */
+static inline void containerGenerationCommitLatencyRestart(containerGeneration state) {
+	uint32_t maxLatency = U32T(atomic_load_explicit(&state->maxPacketContainerLatency, memory_order_relaxed));
+
+	state->commitLatencyDeadline = (maxLatency == 0) ? (0) : (containerGenerationHostTime() + maxLatency);
+}
+
+/**
+ * Check the host-clock latency bound (CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY).
+ * Translators call this once at the end of each buffer, and commit whatever is
+ * pending if it returns true. If the bound was just enabled, or on start, the
+ * first check only arms it.
+ */
+static inline bool containerGenerationIsCommitLatencyElapsed(containerGeneration state) {
+	uint32_t maxLatency = U32T(atomic_load_explicit(&state->maxPacketContainerLatency, memory_order_relaxed));
+	if (maxLatency == 0) {
+		return (false);
+	}
+
+	int64_t currentTime = containerGenerationHostTime();
+
+	if (state->commitLatencyDeadline == 0) {
+		state->commitLatencyDeadline = currentTime + maxLatency;
+		return (false);
+	}
+
+	return (currentTime >= state->commitLatencyDeadline);
 }
 
 static inline void containerGenerationCommitTimestampInit(containerGeneration state, int32_t currentTimestamp) {
@@ -74,11 +434,78 @@ static inline void containerGenerationCommitTimestampInit(containerGeneration st
 	}
 }
 
+/**
+ * Replace the polarity packets of the container about to be committed by
+ * polarity SoA packets holding the same events, at the same position.
+ * The recycled SoA packet is converted into when big enough, and the polarity
+ * packet is kept for the translator to reuse, so with recycling enabled this
+ * doesn't allocate memory in the steady state.
+ */
+static inline void containerGenerationPolarityToSoA(
+	containerGeneration state, const char *deviceString, uint8_t deviceLogLevel) {
+	caerEventPacketContainer container = state->currentPacketContainer;
+
+	for (int32_t i = 0; i < caerEventPacketContainerGetEventPacketsNumber(container); i++) {
+		caerEventPacketHeader packet = caerEventPacketContainerGetEventPacket(container, i);
+		if ((packet == NULL) || (caerEventPacketHeaderGetEventType(packet) != POLARITY_EVENT)) {
+			continue;
+		}
+
+		caerPolaritySoAEventPacket soaPacket = (caerPolaritySoAEventPacket) state->polaritySoASpare;
+		state->polaritySoASpare              = NULL;
+
+		// Grow a too small recycled SoA packet, instead of dropping it. Its events are
+		// all overwritten by the conversion, so only the capacity matters.
+		if ((soaPacket != NULL)
+			&& (caerEventPacketHeaderGetEventCapacity(&soaPacket->packetHeader)
+				< caerEventPacketHeaderGetEventValid(packet))) {
+			caerPolaritySoAEventPacket grownPacket = (caerPolaritySoAEventPacket) caerEventPacketGrow(
+				(caerEventPacketHeader) soaPacket, caerEventPacketHeaderGetEventCapacity(packet));
+			if (grownPacket == NULL) {
+				caerEventPacketFree((caerEventPacketHeader) soaPacket);
+			}
+
+			soaPacket = grownPacket;
+		}
+
+		if (soaPacket == NULL) {
+			soaPacket = caerPolaritySoAEventPacketAllocate(caerEventPacketHeaderGetEventCapacity(packet),
+				caerEventPacketHeaderGetEventSource(packet), caerEventPacketHeaderGetEventTSOverflow(packet));
+			if (soaPacket == NULL) {
+				// Deliver the events in the standard layout then, better than losing them.
+				commonLog(CAER_LOG_CRITICAL, deviceString, deviceLogLevel,
+					"Failed to allocate polarity SoA event packet.");
+				continue;
+			}
+		}
+
+		caerPolarityEventPacketToSoA((caerPolarityEventPacketConst) packet, soaPacket);
+
+		caerEventPacketContainerSetEventPacket(container, i, (caerEventPacketHeader) soaPacket);
+
+		// Its events are cleared when it's reused, see containerGenerationPacketReuse().
+		if ((state->recyclePool != NULL) && (i < CONTAINER_GENERATION_MAX_PACKETS)) {
+			caerEventPacketFree(state->recycledPackets[i]);
+			state->recycledPackets[i] = packet;
+		}
+		else {
+			caerEventPacketFree(packet);
+		}
+	}
+}
+
 static inline void containerGenerationExecute(containerGeneration state, bool emptyContainerCommit, bool tsReset,
 	int32_t tsWrapOverflow, int32_t tsCurrent, dataExchange dataState, atomic_uint_fast32_t *transfersRunning,
 	int16_t deviceId, const char *deviceString, atomic_uint_fast8_t *deviceLogLevelAtomic) {
 	uint8_t deviceLogLevel = atomic_load_explicit(deviceLogLevelAtomic, memory_order_relaxed);
 
+	containerGenerationCommitLatencyRestart(state);
+
+	// Per-event-type interval triggers count from the first event of the next container.
+	for (size_t i = 0; i < CONTAINER_GENERATION_TYPE_COMMIT_TYPES; i++) {
+		state->typeCommit[i].firstTimestamp = -1;
+	}
+
 	// If the commit was triggered by a packet container limit being reached, we always
 	// update the time related limit. The size related one is updated implicitly by size
 	// being reset to zero after commit (new packets are empty).
@@ -90,19 +517,32 @@ static inline void containerGenerationExecute(containerGeneration state, bool em
 
 	// Filter out completely empty commits. This can happen when data is turned off,
 	// but the timestamps are still going forward.
-	if (emptyContainerCommit) {
-		caerEventPacketContainerFree(state->currentPacketContainer);
-		state->currentPacketContainer = NULL;
-	}
-	else {
-		if (!dataExchangePut(dataState, state->currentPacketContainer)) {
+	// Such a container holds no packets, so it can directly be kept for the next commit.
+	if (!emptyContainerCommit) {
+		if (atomic_load_explicit(&state->polaritySoA, memory_order_relaxed)) {
+			containerGenerationPolarityToSoA(state, deviceString, deviceLogLevel);
+		}
+
+		int putResult = dataExchangePutPolicy(dataState, transfersRunning, state->currentPacketContainer);
+
+		if (putResult == PUT_DROPPED_NEWEST) {
 			// Failed to forward packet container, just drop it, it doesn't contain
-			// any critical information anyway.
+			// any critical information anyway. The drop-oldest policy handles a
+			// full ring-buffer itself, see CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY.
 			commonLog(CAER_LOG_NOTICE, deviceString, deviceLogLevel,
 				"Dropped EventPacket Container because ring-buffer full! This means your processing loop is not "
 				"keeping up with new data ready to be read from caerDeviceDataGet().");
 
 			caerEventPacketContainerFree(state->currentPacketContainer);
+
+			dataStatisticsIncrease(&state->statistics.containersDropped, 1);
+		}
+		else {
+			dataStatisticsIncrease(&state->statistics.containersCommitted, 1);
+
+			if (putResult == PUT_DROPPED_OLDEST) {
+				dataStatisticsIncrease(&state->statistics.containersDropped, 1);
+			}
 		}
 
 		state->currentPacketContainer = NULL;
@@ -144,10 +584,161 @@ static inline void containerGenerationExecute(containerGeneration state, bool em
 		// outputs get confused if they have no notification of timestamps
 		// jumping back go zero.
 		dataExchangePutForce(dataState, transfersRunning, tsResetContainer);
+
+		dataStatisticsIncrease(&state->statistics.containersCommitted, 1);
+	}
+}
+
+/**
+ * Fill the recycle pool with containers holding one empty raw data packet
+ * of 'capacity' bytes each, the buffers raw data pass-through swaps in for
+ * the USB transfers, so that even the first ones don't allocate memory.
+ * Only call this on DataStart(), before any container is handed out, as the
+ * user side of the pool is not ours to use afterwards.
+ */
+static inline void containerGenerationRawDataPoolFill(containerGeneration state, int32_t capacity, int16_t deviceId) {
+	if (state->recyclePool == NULL) {
+		return;
+	}
+
+	uint32_t poolSize = U32T(atomic_load(&state->recyclePoolSize));
+
+	for (uint32_t i = 0; i < poolSize; i++) {
+		caerEventPacketContainer container = caerEventPacketContainerAllocate(1);
+		caerRawDataEventPacket packet      = caerRawDataEventPacketAllocate(capacity, deviceId, 0);
+
+		if ((container == NULL) || (packet == NULL)) {
+			caerEventPacketContainerFree(container);
+			caerEventPacketFree((caerEventPacketHeader) packet);
+			return;
+		}
+
+		caerEventPacketContainerSetEventPacket(container, 0, (caerEventPacketHeader) packet);
+
+		if (!caerRingBufferPut(state->recyclePool, container)) {
+			caerEventPacketContainerFree(container);
+			return;
+		}
 	}
 }
 
+/**
+ * Raw data pass-through: commit a filled raw data packet, alone in its own
+ * container, and return an empty one of at least 'capacity' bytes for the
+ * next transfer to receive into, taken from the next recycled container when
+ * possible. The empty packet still has the event number of its previous use,
+ * so that the caller knows how much data to zero past what it receives.
+ * 'packet' can be NULL, to only get an empty packet. If one is given, one is
+ * always returned: if no memory is available, its data is dropped instead.
+ */
+static inline caerEventPacketHeader containerGenerationRawDataExchange(containerGeneration state,
+	caerEventPacketHeader packet, int32_t capacity, dataExchange dataState, atomic_uint_fast32_t *transfersRunning,
+	int16_t deviceId, const char *deviceString, atomic_uint_fast8_t *deviceLogLevelAtomic) {
+	uint8_t deviceLogLevel = atomic_load_explicit(deviceLogLevelAtomic, memory_order_relaxed);
+
+	caerEventPacketContainer container = NULL;
+	caerEventPacketHeader emptyPacket  = NULL;
+
+	if (state->recyclePool != NULL) {
+		container = caerRingBufferGet(state->recyclePool);
+
+		if ((container != NULL) && (caerEventPacketContainerGetEventPacketsNumber(container) == 1)
+			&& (container->eventPackets[0] != NULL)
+			&& (caerEventPacketHeaderGetEventType(container->eventPackets[0]) == RAW_DATA_EVENT)
+			&& (caerEventPacketHeaderGetEventCapacity(container->eventPackets[0]) >= capacity)) {
+			emptyPacket                = container->eventPackets[0];
+			container->eventPackets[0] = NULL;
+
+			atomic_fetch_add_explicit(&state->recyclePoolHits, 1, memory_order_relaxed);
+		}
+		else {
+			// Unusable (translated data or different buffer size) or no container available.
+			caerEventPacketContainerFree(container);
+			container = NULL;
+
+			atomic_fetch_add_explicit(&state->recyclePoolMisses, 1, memory_order_relaxed);
+		}
+	}
+
+	if (emptyPacket == NULL) {
+		emptyPacket = (caerEventPacketHeader) caerRawDataEventPacketAllocate(capacity, deviceId, 0);
+	}
+
+	if (packet == NULL) {
+		caerEventPacketContainerFree(container);
+
+		return (emptyPacket);
+	}
+
+	if (container == NULL) {
+		container = caerEventPacketContainerAllocate(1);
+	}
+
+	if ((emptyPacket == NULL) || (container == NULL)) {
+		commonLog(CAER_LOG_CRITICAL, deviceString, deviceLogLevel,
+			"Failed to allocate raw data event packet or container, dropping raw data.");
+
+		caerEventPacketContainerFree(container);
+		caerEventPacketFree(emptyPacket);
+
+		dataStatisticsIncrease(&state->statistics.containersDropped, 1);
+
+		return (packet);
+	}
+
+	caerEventPacketContainerSetEventPacket(container, 0, packet);
+
+	int putResult = dataExchangePutPolicy(dataState, transfersRunning, container);
+
+	if (putResult == PUT_DROPPED_NEWEST) {
+		commonLog(CAER_LOG_NOTICE, deviceString, deviceLogLevel,
+			"Dropped EventPacket Container because ring-buffer full! This means your processing loop is not "
+			"keeping up with new data ready to be read from caerDeviceDataGet().");
+
+		caerEventPacketContainerFree(container);
+
+		dataStatisticsIncrease(&state->statistics.containersDropped, 1);
+	}
+	else {
+		dataStatisticsIncrease(&state->statistics.containersCommitted, 1);
+
+		if (putResult == PUT_DROPPED_OLDEST) {
+			dataStatisticsIncrease(&state->statistics.containersDropped, 1);
+		}
+	}
+
+	return (emptyPacket);
+}
+
+// Keep track of whether any per-event-type trigger is set, so that translators
+// can skip checking them all after every event otherwise.
+static inline void containerGenerationTypeCommitUpdate(containerGeneration state) {
+	bool typeCommitEnabled = false;
+
+	for (size_t i = 0; i < CONTAINER_GENERATION_TYPE_COMMIT_TYPES; i++) {
+		if ((atomic_load(&state->typeCommit[i].size) != 0) || (atomic_load(&state->typeCommit[i].interval) != 0)) {
+			typeCommitEnabled = true;
+		}
+	}
+
+	atomic_store(&state->typeCommitEnabled, typeCommitEnabled);
+}
+
 static inline bool containerGenerationConfigSet(containerGeneration state, uint8_t paramAddr, uint32_t param) {
+	if ((paramAddr >= CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE)
+		&& (paramAddr < (CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE + CONTAINER_GENERATION_TYPE_COMMIT_TYPES))) {
+		atomic_store(&state->typeCommit[paramAddr - CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE].size, param);
+		containerGenerationTypeCommitUpdate(state);
+		return (true);
+	}
+
+	if ((paramAddr >= CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL)
+		&& (paramAddr < (CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL + CONTAINER_GENERATION_TYPE_COMMIT_TYPES))) {
+		atomic_store(&state->typeCommit[paramAddr - CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL].interval, param);
+		containerGenerationTypeCommitUpdate(state);
+		return (true);
+	}
+
 	switch (paramAddr) {
 		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
 			atomic_store(&state->maxPacketContainerPacketSize, param);
@@ -157,6 +748,18 @@ static inline bool containerGenerationConfigSet(containerGeneration state, uint8
 			atomic_store(&state->maxPacketContainerInterval, param);
 			break;
 
+		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY:
+			atomic_store(&state->maxPacketContainerLatency, param);
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_SIZE:
+			atomic_store(&state->recyclePoolSize, param);
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_POLARITY_SOA:
+			atomic_store(&state->polaritySoA, param);
+			break;
+
 		default:
 			return (false);
 			break;
@@ -166,6 +769,19 @@ static inline bool containerGenerationConfigSet(containerGeneration state, uint8
 }
 
 static inline bool containerGenerationConfigGet(containerGeneration state, uint8_t paramAddr, uint32_t *param) {
+	if ((paramAddr >= CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE)
+		&& (paramAddr < (CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE + CONTAINER_GENERATION_TYPE_COMMIT_TYPES))) {
+		*param = U32T(atomic_load(&state->typeCommit[paramAddr - CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_SIZE].size));
+		return (true);
+	}
+
+	if ((paramAddr >= CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL)
+		&& (paramAddr < (CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL + CONTAINER_GENERATION_TYPE_COMMIT_TYPES))) {
+		*param
+			= U32T(atomic_load(&state->typeCommit[paramAddr - CAER_HOST_CONFIG_PACKETS_TYPE_COMMIT_INTERVAL].interval));
+		return (true);
+	}
+
 	switch (paramAddr) {
 		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
 			*param = U32T(atomic_load(&state->maxPacketContainerPacketSize));
@@ -175,6 +791,34 @@ static inline bool containerGenerationConfigGet(containerGeneration state, uint8
 			*param = U32T(atomic_load(&state->maxPacketContainerInterval));
 			break;
 
+		case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY:
+			*param = U32T(atomic_load(&state->maxPacketContainerLatency));
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_SIZE:
+			*param = U32T(atomic_load(&state->recyclePoolSize));
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_POLARITY_SOA:
+			*param = atomic_load(&state->polaritySoA);
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_HITS:
+			*param = U32T(atomic_load_explicit(&state->recyclePoolHits, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_RECYCLE_POOL_MISSES:
+			*param = U32T(atomic_load_explicit(&state->recyclePoolMisses, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_POLARITY_SIZE_PREDICTED:
+			*param = U32T(atomic_load_explicit(&state->polaritySize.predictedSize, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_PACKETS_POLARITY_SIZE_ACTUAL:
+			*param = U32T(atomic_load_explicit(&state->polaritySize.actualSize, memory_order_relaxed));
+			break;
+
 		default:
 			return (false);
 			break;
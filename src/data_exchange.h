@@ -12,15 +12,32 @@
 
 enum { THR_IDLE = 0, THR_RUNNING = 1, THR_EXITED = 2 };
 
+enum { PUT_COMMITTED = 0, PUT_DROPPED_NEWEST = 1, PUT_DROPPED_OLDEST = 2 };
+
 struct data_exchange {
 	caerRingBuffer buffer;
 	atomic_uint_fast32_t bufferSize; // Only takes effect on DataStart() calls!
 	atomic_bool blocking;
+	atomic_bool blockingNotify;
+	atomic_uint_fast32_t dropPolicy; // Only takes effect on DataStart() calls!
+	uint32_t dropPolicyActive;
+	mtx_t bufferGetLock;
+	atomic_uint_fast32_t droppedNewest;
+	atomic_uint_fast32_t droppedOldest;
+	atomic_uint_fast32_t producerBlocked;
+	atomic_uint_fast32_t occupancy;
+	atomic_uint_fast32_t occupancyMax;
 	atomic_bool startProducers;
 	atomic_bool stopProducers;
 	void (*notifyDataIncrease)(void *ptr);
 	void (*notifyDataDecrease)(void *ptr);
 	void *notifyDataUserPtr;
+	mtx_t consumerWaitLock;
+	cnd_t consumerWaitCond;
+	atomic_bool consumerWaiting;
+	mtx_t producerWaitLock;
+	cnd_t producerWaitCond;
+	atomic_bool producerWaiting;
 };
 
 typedef struct data_exchange *dataExchange;
@@ -28,6 +45,8 @@ typedef struct data_exchange *dataExchange;
 static inline void dataExchangeSettingsInit(dataExchange state) {
 	atomic_store(&state->bufferSize, 64);
 	atomic_store(&state->blocking, false);
+	atomic_store(&state->blockingNotify, true);
+	atomic_store(&state->dropPolicy, CAER_HOST_CONFIG_DATAEXCHANGE_DROP_NEWEST);
 	atomic_store(&state->startProducers, true);
 	atomic_store(&state->stopProducers, true);
 }
@@ -39,26 +58,269 @@ static inline bool dataExchangeBufferInit(dataExchange state) {
 		return (false);
 	}
 
+	// Initialize consumer wake-up support for blocking mode.
+	if (mtx_init(&state->consumerWaitLock, mtx_plain) != thrd_success) {
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+	if (cnd_init(&state->consumerWaitCond) != thrd_success) {
+		mtx_destroy(&state->consumerWaitLock);
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+	atomic_store(&state->consumerWaiting, false);
+
+	// Initialize producer wake-up support for the block-producer policy.
+	if (mtx_init(&state->producerWaitLock, mtx_plain) != thrd_success) {
+		cnd_destroy(&state->consumerWaitCond);
+		mtx_destroy(&state->consumerWaitLock);
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+	if (cnd_init(&state->producerWaitCond) != thrd_success) {
+		mtx_destroy(&state->producerWaitLock);
+		cnd_destroy(&state->consumerWaitCond);
+		mtx_destroy(&state->consumerWaitLock);
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+	atomic_store(&state->producerWaiting, false);
+
+	// With the drop-oldest policy, the producer also takes containers out of the
+	// ring-buffer, so all getters have to be serialized with a lock.
+	if (mtx_init(&state->bufferGetLock, mtx_plain) != thrd_success) {
+		cnd_destroy(&state->producerWaitCond);
+		mtx_destroy(&state->producerWaitLock);
+		cnd_destroy(&state->consumerWaitCond);
+		mtx_destroy(&state->consumerWaitLock);
+		caerRingBufferFree(state->buffer);
+		state->buffer = NULL;
+		return (false);
+	}
+
+	state->dropPolicyActive = U32T(atomic_load(&state->dropPolicy));
+
+	atomic_store(&state->occupancy, 0);
+	atomic_store(&state->occupancyMax, 0);
+
+	atomic_store(&state->droppedNewest, 0);
+	atomic_store(&state->droppedOldest, 0);
+	atomic_store(&state->producerBlocked, 0);
+
 	return (true);
 }
 
 static inline void dataExchangeDestroy(dataExchange state) {
 	if (state->buffer != NULL) {
+		mtx_destroy(&state->bufferGetLock);
+		cnd_destroy(&state->producerWaitCond);
+		mtx_destroy(&state->producerWaitLock);
+		cnd_destroy(&state->consumerWaitCond);
+		mtx_destroy(&state->consumerWaitLock);
+
 		caerRingBufferFree(state->buffer);
 		state->buffer = NULL;
 	}
 }
 
+/**
+ * Track how many containers are in the ring-buffer. Only the producer
+ * increases the count, so it can also keep track of the maximum. The maximum
+ * is only raised by compare-exchange, as dataStatisticsReset() may lower it
+ * concurrently, and that must not be overwritten by a stale larger value.
+ */
+static inline void dataExchangeOccupancyIncrease(dataExchange state) {
+	uint_fast32_t occupancy = atomic_fetch_add_explicit(&state->occupancy, 1, memory_order_relaxed) + 1;
+
+	uint_fast32_t occupancyMax = atomic_load_explicit(&state->occupancyMax, memory_order_relaxed);
+
+	while ((occupancy > occupancyMax)
+		   && !atomic_compare_exchange_weak_explicit(
+			   &state->occupancyMax, &occupancyMax, occupancy, memory_order_relaxed, memory_order_relaxed)) {
+		;
+	}
+}
+
+static inline void dataExchangeOccupancyDecrease(dataExchange state, size_t containersNumber) {
+	atomic_fetch_sub_explicit(&state->occupancy, containersNumber, memory_order_relaxed);
+}
+
+/**
+ * Whether the producer waits for space when the ring-buffer is full, instead of
+ * dropping data. Only valid after dataExchangeBufferInit().
+ */
+static inline bool dataExchangeBlocksProducer(dataExchange state) {
+	return (state->dropPolicyActive == CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER);
+}
+
+/**
+ * Wake up a producer blocked in dataExchangeWaitForSpace(), if there is one.
+ * Called by the consumer after taking containers out. Only the block-producer
+ * policy ever waits, so the others never even look at the waiting flag.
+ */
+static inline void dataExchangeWakeProducer(dataExchange state) {
+	if (state->dropPolicyActive != CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER) {
+		return;
+	}
+
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (atomic_load_explicit(&state->producerWaiting, memory_order_relaxed)) {
+		mtx_lock(&state->producerWaitLock);
+		cnd_signal(&state->producerWaitCond);
+		mtx_unlock(&state->producerWaitLock);
+	}
+}
+
+/**
+ * Wait for the consumer to make space in the ring-buffer, or until waitTimeUs
+ * have elapsed. Same protocol as dataExchangeWaitForData(), with the roles
+ * swapped, so a container taken out concurrently can never be missed.
+ */
+static inline void dataExchangeWaitForSpace(dataExchange state, int64_t waitTimeUs) {
+	mtx_lock(&state->producerWaitLock);
+
+	atomic_store(&state->producerWaiting, true);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (caerRingBufferFull(state->buffer)) {
+		cnd_timedwait(&state->producerWaitCond, &state->producerWaitLock, waitTimeUs);
+	}
+
+	atomic_store(&state->producerWaiting, false);
+
+	mtx_unlock(&state->producerWaitLock);
+}
+
+/**
+ * Consumer-side ring-buffer access. The ring-buffer is single-producer,
+ * single-consumer, so when the producer may also remove containers
+ * (drop-oldest policy), the accesses have to be serialized.
+ */
+static inline caerEventPacketContainer dataExchangeBufferGet(dataExchange state) {
+	if (state->dropPolicyActive != CAER_HOST_CONFIG_DATAEXCHANGE_DROP_OLDEST) {
+		return (caerRingBufferGet(state->buffer));
+	}
+
+	mtx_lock(&state->bufferGetLock);
+	caerEventPacketContainer container = caerRingBufferGet(state->buffer);
+	mtx_unlock(&state->bufferGetLock);
+
+	return (container);
+}
+
+static inline bool dataExchangeBufferIsEmpty(dataExchange state) {
+	if (state->dropPolicyActive != CAER_HOST_CONFIG_DATAEXCHANGE_DROP_OLDEST) {
+		return (caerRingBufferEmpty(state->buffer));
+	}
+
+	mtx_lock(&state->bufferGetLock);
+	bool isEmpty = caerRingBufferEmpty(state->buffer);
+	mtx_unlock(&state->bufferGetLock);
+
+	return (isEmpty);
+}
+
+static inline size_t dataExchangeBufferGetMany(
+	dataExchange state, caerEventPacketContainer *containers, size_t maxContainers) {
+	if (state->dropPolicyActive != CAER_HOST_CONFIG_DATAEXCHANGE_DROP_OLDEST) {
+		return (caerRingBufferGetMany(state->buffer, (void **) containers, maxContainers));
+	}
+
+	mtx_lock(&state->bufferGetLock);
+	size_t containersNumber = caerRingBufferGetMany(state->buffer, (void **) containers, maxContainers);
+	mtx_unlock(&state->bufferGetLock);
+
+	return (containersNumber);
+}
+
+/**
+ * Wait for the producer to commit new data, or until waitTimeUs have elapsed.
+ * The consumer announces itself as waiting and re-checks the buffer under the
+ * lock, so a container committed concurrently can never be missed.
+ */
+static inline void dataExchangeWaitForData(dataExchange state, int64_t waitTimeUs) {
+	mtx_lock(&state->consumerWaitLock);
+
+	atomic_store(&state->consumerWaiting, true);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (dataExchangeBufferIsEmpty(state)) {
+		cnd_timedwait(&state->consumerWaitCond, &state->consumerWaitLock, waitTimeUs);
+	}
+
+	atomic_store(&state->consumerWaiting, false);
+
+	mtx_unlock(&state->consumerWaitLock);
+}
+
+/**
+ * Wake up a consumer blocked in dataExchangeWaitForData(), if there is one.
+ * The lock is only taken when somebody is actually waiting, so the producer
+ * hot-path stays lock-free.
+ */
+static inline void dataExchangeWakeConsumer(dataExchange state) {
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (atomic_load_explicit(&state->consumerWaiting, memory_order_relaxed)) {
+		mtx_lock(&state->consumerWaitLock);
+		cnd_signal(&state->consumerWaitCond);
+		mtx_unlock(&state->consumerWaitLock);
+	}
+}
+
+/**
+ * Wait for new data in blocking mode. Returns true if the caller should retry
+ * getting data, false if it should give up and return nothing.
+ */
+static inline bool dataExchangeBlockingWait(
+	dataExchange state, atomic_uint_fast32_t *transfersRunning, uint32_t *sleepCounter) {
+	// Didn't find any event container, either report this or retry, depending
+	// on blocking setting. Every 1000 sleeps (so ~1s) we return, to avoid possible
+	// dead-lock on this function.
+	if (atomic_load_explicit(&state->blocking, memory_order_relaxed) && (atomic_load(transfersRunning) == THR_RUNNING)
+		&& (*sleepCounter < 1000)) {
+		if (atomic_load_explicit(&state->blockingNotify, memory_order_relaxed)) {
+			// Wait to be woken up by the producer as soon as a new container is
+			// committed. Wait in 100ms slices, so that a shutdown of the data
+			// transfers is detected even if no more data arrives.
+			dataExchangeWaitForData(state, 100000);
+			*sleepCounter += 100;
+			return (true);
+		}
+
+		// Don't retry right away in a tight loop, back off and wait a little.
+		// If no data is available, sleep for a millisecond to avoid wasting resources.
+		if (thrd_sleep(1000) == 0) {
+			*sleepCounter += 1;
+			return (true);
+		}
+	}
+
+	return (false);
+}
+
 static inline caerEventPacketContainer dataExchangeGet(dataExchange state, atomic_uint_fast32_t *transfersRunning) {
 	caerEventPacketContainer container = NULL;
 	uint32_t sleepCounter              = 0;
 
 retry:
-	container = caerRingBufferGet(state->buffer);
+	container = dataExchangeBufferGet(state);
 
 	if (container != NULL) {
 		// Found an event container, return it and signal this piece of data
 		// is no longer available for later acquisition.
+		dataExchangeOccupancyDecrease(state, 1);
+		dataExchangeWakeProducer(state);
+
 		if (state->notifyDataDecrease != NULL) {
 			state->notifyDataDecrease(state->notifyDataUserPtr);
 		}
@@ -66,31 +328,75 @@ retry:
 		return (container);
 	}
 
-	// Didn't find any event container, either report this or retry, depending
-	// on blocking setting. Every 1000 sleeps (so ~1s) we return, to avoid possible
-	// dead-lock on this function.
-	if (atomic_load_explicit(&state->blocking, memory_order_relaxed) && (atomic_load(transfersRunning) == THR_RUNNING)
-		&& (sleepCounter < 1000)) {
-		// Don't retry right away in a tight loop, back off and wait a little.
-		// If no data is available, sleep for a millisecond to avoid wasting resources.
-		if (thrd_sleep(1000) == 0) {
-			sleepCounter++;
-			goto retry;
-		}
+	if (dataExchangeBlockingWait(state, transfersRunning, &sleepCounter)) {
+		goto retry;
 	}
 
 	// Nothing.
 	return (NULL);
 }
 
+static inline size_t dataExchangeGetMany(dataExchange state, atomic_uint_fast32_t *transfersRunning,
+	caerEventPacketContainer *containers, size_t maxContainers) {
+	size_t containersNumber = 0;
+	uint32_t sleepCounter   = 0;
+
+	if (maxContainers == 0) {
+		return (0);
+	}
+
+retry:
+	containersNumber = dataExchangeBufferGetMany(state, containers, maxContainers);
+
+	if (containersNumber > 0) {
+		// Found event containers, return them and signal this data is no longer
+		// available for later acquisition, once for the whole batch.
+		dataExchangeOccupancyDecrease(state, containersNumber);
+		dataExchangeWakeProducer(state);
+
+		if (state->notifyDataDecrease != NULL) {
+			state->notifyDataDecrease(state->notifyDataUserPtr);
+		}
+
+		return (containersNumber);
+	}
+
+	if (dataExchangeBlockingWait(state, transfersRunning, &sleepCounter)) {
+		goto retry;
+	}
+
+	// Nothing.
+	return (0);
+}
+
+/**
+ * Commit a container to the ring-buffer and signal it. Only the producer
+ * puts containers, so once it has seen free space, the put cannot fail.
+ * The occupancy is increased first, so that it never goes negative when
+ * the consumer is quick to take the container out again.
+ */
+static inline void dataExchangeCommitNoNotify(dataExchange state, caerEventPacketContainer container) {
+	dataExchangeOccupancyIncrease(state);
+
+	caerRingBufferPut(state->buffer, container);
+
+	dataExchangeWakeConsumer(state);
+}
+
+static inline void dataExchangeCommit(dataExchange state, caerEventPacketContainer container) {
+	dataExchangeCommitNoNotify(state, container);
+
+	if (state->notifyDataIncrease != NULL) {
+		state->notifyDataIncrease(state->notifyDataUserPtr);
+	}
+}
+
 static inline bool dataExchangePut(dataExchange state, caerEventPacketContainer container) {
-	if (!caerRingBufferPut(state->buffer, container)) {
+	if (caerRingBufferFull(state->buffer)) {
 		return (false);
 	}
 	else {
-		if (state->notifyDataIncrease != NULL) {
-			state->notifyDataIncrease(state->notifyDataUserPtr);
-		}
+		dataExchangeCommit(state, container);
 
 		return (true);
 	}
@@ -98,7 +404,7 @@ static inline bool dataExchangePut(dataExchange state, caerEventPacketContainer
 
 static inline void dataExchangePutForce(
 	dataExchange state, atomic_uint_fast32_t *transfersRunning, caerEventPacketContainer container) {
-	while (!caerRingBufferPut(state->buffer, container)) {
+	while (caerRingBufferFull(state->buffer)) {
 		// Prevent dead-lock if shutdown is requested and nothing is consuming
 		// data anymore, but the ring-buffer is full (and would thus never empty),
 		// thus blocking the USB handling thread in this loop.
@@ -108,16 +414,88 @@ static inline void dataExchangePutForce(
 	}
 
 	// Signal new container as usual.
-	if (state->notifyDataIncrease != NULL) {
-		state->notifyDataIncrease(state->notifyDataUserPtr);
+	dataExchangeCommit(state, container);
+}
+
+/**
+ * Put a new container into the ring-buffer, following the configured drop
+ * policy when it is full. Returns PUT_DROPPED_NEWEST if the new container
+ * was dropped, in which case the caller still owns it and has to free it.
+ * PUT_DROPPED_OLDEST means the new container was committed, but an older
+ * one had to be dropped to make space for it.
+ */
+static inline int dataExchangePutPolicy(
+	dataExchange state, atomic_uint_fast32_t *transfersRunning, caerEventPacketContainer container) {
+	if (dataExchangePut(state, container)) {
+		return (PUT_COMMITTED);
+	}
+
+	switch (state->dropPolicyActive) {
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROP_OLDEST: {
+			// Make space by removing the oldest container. The consumer cannot
+			// take it concurrently, as it has to hold the same lock.
+			mtx_lock(&state->bufferGetLock);
+			caerEventPacketContainer oldest = caerRingBufferGet(state->buffer);
+			mtx_unlock(&state->bufferGetLock);
+
+			if (oldest == NULL) {
+				// The consumer made space in the meantime, commit as usual.
+				dataExchangeCommit(state, container);
+
+				return (PUT_COMMITTED);
+			}
+
+			dataExchangeOccupancyDecrease(state, 1);
+
+			caerEventPacketContainerFree(oldest);
+
+			atomic_fetch_add_explicit(&state->droppedOldest, 1, memory_order_relaxed);
+
+			// The new container replaces the dropped one, the amount of data available
+			// doesn't change. Neither data notification is called, so dataNotifyDecrease()
+			// keeps being called only by the consumer, from inside caerDeviceDataGet().
+			dataExchangeCommitNoNotify(state, container);
+
+			return (PUT_DROPPED_OLDEST);
+			break;
+		}
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER:
+			atomic_fetch_add_explicit(&state->producerBlocked, 1, memory_order_relaxed);
+
+			while (caerRingBufferFull(state->buffer)) {
+				// Stop waiting on shutdown, when nothing is consuming data anymore.
+				if (atomic_load(transfersRunning) != THR_RUNNING) {
+					return (PUT_DROPPED_NEWEST);
+				}
+
+				// Wait to be woken up by the consumer as soon as it takes a container
+				// out. Wait in 10ms slices, so that a shutdown is detected quickly.
+				dataExchangeWaitForSpace(state, 10000);
+			}
+
+			dataExchangeCommit(state, container);
+
+			return (PUT_COMMITTED);
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROP_NEWEST:
+		default:
+			atomic_fetch_add_explicit(&state->droppedNewest, 1, memory_order_relaxed);
+
+			return (PUT_DROPPED_NEWEST);
+			break;
 	}
 }
 
 static inline void dataExchangeBufferEmpty(dataExchange state) {
 	// Empty ringbuffer.
 	caerEventPacketContainer container;
-	while ((container = caerRingBufferGet(state->buffer)) != NULL) {
+	while ((container = dataExchangeBufferGet(state)) != NULL) {
 		// Notify data-not-available call-back.
+		dataExchangeOccupancyDecrease(state, 1);
+		dataExchangeWakeProducer(state);
+
 		if (state->notifyDataDecrease != NULL) {
 			state->notifyDataDecrease(state->notifyDataUserPtr);
 		}
@@ -160,6 +538,18 @@ static inline bool dataExchangeConfigSet(dataExchange state, uint8_t paramAddr,
 			atomic_store(&state->stopProducers, param);
 			break;
 
+		case CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_NOTIFY:
+			atomic_store(&state->blockingNotify, param);
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY:
+			if (param > CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER) {
+				return (false);
+			}
+
+			atomic_store(&state->dropPolicy, param);
+			break;
+
 		default:
 			return (false);
 			break;
@@ -186,6 +576,26 @@ static inline bool dataExchangeConfigGet(dataExchange state, uint8_t paramAddr,
 			*param = atomic_load(&state->stopProducers);
 			break;
 
+		case CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING_NOTIFY:
+			*param = atomic_load(&state->blockingNotify);
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROP_POLICY:
+			*param = U32T(atomic_load(&state->dropPolicy));
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_NEWEST:
+			*param = U32T(atomic_load_explicit(&state->droppedNewest, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_DROPPED_OLDEST:
+			*param = U32T(atomic_load_explicit(&state->droppedOldest, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_DATAEXCHANGE_PRODUCER_BLOCKED:
+			*param = U32T(atomic_load_explicit(&state->producerBlocked, memory_order_relaxed));
+			break;
+
 		default:
 			return (false);
 			break;
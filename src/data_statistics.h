@@ -0,0 +1,126 @@
+#ifndef LIBCAER_SRC_DATA_STATISTICS_H_
+#define LIBCAER_SRC_DATA_STATISTICS_H_
+
+#include "libcaer/libcaer.h"
+
+#include "libcaer/devices/device.h"
+
+#include "data_exchange.h"
+
+#include <stdatomic.h>
+
+/**
+ * Data-path counters, common to all devices. They are only ever updated
+ * by the data acquisition thread, with relaxed atomics, and read from
+ * any other thread via CAER_HOST_CONFIG_STATISTICS.
+ */
+struct data_statistics {
+	atomic_uint_fast64_t transferBytes;
+	atomic_uint_fast64_t transfersCompleted;
+	atomic_uint_fast64_t containersCommitted;
+	atomic_uint_fast64_t containersDropped;
+	atomic_uint_fast64_t packetsGrown;
+};
+
+typedef struct data_statistics *dataStatistics;
+
+static inline void dataStatisticsIncrease(atomic_uint_fast64_t *counter, uint64_t value) {
+	atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+}
+
+static inline void dataStatisticsTransfer(dataStatistics state, size_t transferBytes) {
+	dataStatisticsIncrease(&state->transferBytes, transferBytes);
+	dataStatisticsIncrease(&state->transfersCompleted, 1);
+}
+
+static inline void dataStatisticsReset(dataStatistics state, dataExchange dataState) {
+	atomic_store(&state->transferBytes, 0);
+	atomic_store(&state->transfersCompleted, 0);
+	atomic_store(&state->containersCommitted, 0);
+	atomic_store(&state->containersDropped, 0);
+	atomic_store(&state->packetsGrown, 0);
+
+	atomic_store(&dataState->occupancyMax, atomic_load(&dataState->occupancy));
+}
+
+/**
+ * 64bit counters are split over two addresses, the given one for the upper
+ * 32 bits and the next one for the lower 32 bits, see caerDeviceConfigGet64().
+ */
+static inline uint32_t dataStatisticsSplit64(atomic_uint_fast64_t *counter, bool upperBits) {
+	uint64_t value = atomic_load_explicit(counter, memory_order_relaxed);
+
+	return (U32T((upperBits) ? (value >> 32) : (value & 0xFFFFFFFF)));
+}
+
+static inline bool dataStatisticsConfigSet(
+	dataStatistics state, dataExchange dataState, uint8_t paramAddr, uint32_t param) {
+	switch (paramAddr) {
+		case CAER_HOST_CONFIG_STATISTICS_RESET:
+			if (param) {
+				dataStatisticsReset(state, dataState);
+			}
+			break;
+
+		default:
+			return (false);
+			break;
+	}
+
+	return (true);
+}
+
+static inline bool dataStatisticsConfigGet(
+	dataStatistics state, dataExchange dataState, uint8_t paramAddr, uint32_t *param) {
+	switch (paramAddr) {
+		case CAER_HOST_CONFIG_STATISTICS_TRANSFER_BYTES:
+		case CAER_HOST_CONFIG_STATISTICS_TRANSFER_BYTES + 1:
+			*param = dataStatisticsSplit64(
+				&state->transferBytes, (paramAddr == CAER_HOST_CONFIG_STATISTICS_TRANSFER_BYTES));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_TRANSFERS_COMPLETED:
+		case CAER_HOST_CONFIG_STATISTICS_TRANSFERS_COMPLETED + 1:
+			*param = dataStatisticsSplit64(
+				&state->transfersCompleted, (paramAddr == CAER_HOST_CONFIG_STATISTICS_TRANSFERS_COMPLETED));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_COMMITTED:
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_COMMITTED + 1:
+			*param = dataStatisticsSplit64(
+				&state->containersCommitted, (paramAddr == CAER_HOST_CONFIG_STATISTICS_CONTAINERS_COMMITTED));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_DROPPED:
+		case CAER_HOST_CONFIG_STATISTICS_CONTAINERS_DROPPED + 1:
+			*param = dataStatisticsSplit64(
+				&state->containersDropped, (paramAddr == CAER_HOST_CONFIG_STATISTICS_CONTAINERS_DROPPED));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_PACKETS_GROWN:
+		case CAER_HOST_CONFIG_STATISTICS_PACKETS_GROWN + 1:
+			*param = dataStatisticsSplit64(
+				&state->packetsGrown, (paramAddr == CAER_HOST_CONFIG_STATISTICS_PACKETS_GROWN));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_RING_OCCUPANCY:
+			*param = U32T(atomic_load_explicit(&dataState->occupancy, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_RING_OCCUPANCY_MAX:
+			*param = U32T(atomic_load_explicit(&dataState->occupancyMax, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_STATISTICS_RESET:
+			*param = false;
+			break;
+
+		default:
+			return (false);
+			break;
+	}
+
+	return (true);
+}
+
+#endif /* LIBCAER_SRC_DATA_STATISTICS_H_ */
@@ -5,7 +5,11 @@ static ssize_t davisFindInternal(uint16_t deviceType, caerDeviceDiscoveryResult
 static caerDeviceHandle davisOpenInternal(uint16_t deviceType, uint16_t deviceID, uint8_t busNumberRestrict,
 	uint8_t devAddressRestrict, const char *serialNumberRestrict);
 
+static caerDeviceHandle davisReplayOpenInternal(
+	uint16_t deviceType, uint16_t deviceID, const char *filePath, bool maxSpeed);
+
 static void davisEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent);
+static caerEventPacketHeader davisRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity);
 
 // FX3 Debug Transfer Support
 static void allocateDebugTransfers(davisHandle handle);
@@ -302,6 +306,8 @@ static caerDeviceHandle davisOpenInternal(uint16_t deviceType, uint16_t deviceID
 
 	// Setup USB.
 	usbSetDataCallback(&handle->usbState, &davisEventTranslator, handle);
+	usbSetRawDataCallback(&handle->usbState, &davisRawDataExchange, handle);
+	usbSetStatistics(&handle->usbState, &handle->cHandle.state.container.statistics);
 	usbSetDataEndpoint(&handle->usbState, USB_DEFAULT_DATA_ENDPOINT);
 	usbSetTransfersNumber(&handle->usbState, 8);
 	usbSetTransfersSize(&handle->usbState, 8192);
@@ -361,6 +367,186 @@ bool davisClose(caerDeviceHandle cdh) {
 	return (true);
 }
 
+caerDeviceHandle davisReplayOpenAll(uint16_t deviceID, const char *filePath, bool maxSpeed) {
+	return (davisReplayOpenInternal(CAER_DEVICE_DAVIS, deviceID, filePath, maxSpeed));
+}
+
+caerDeviceHandle davisReplayOpenFX2(uint16_t deviceID, const char *filePath, bool maxSpeed) {
+	return (davisReplayOpenInternal(CAER_DEVICE_DAVIS_FX2, deviceID, filePath, maxSpeed));
+}
+
+caerDeviceHandle davisReplayOpenFX3(uint16_t deviceID, const char *filePath, bool maxSpeed) {
+	return (davisReplayOpenInternal(CAER_DEVICE_DAVIS_FX3, deviceID, filePath, maxSpeed));
+}
+
+// Device state needed by the translator, saved with raw recordings.
+static void recordFieldsGet(davisHandle handle, struct usb_record_field fields[DAVIS_RECORD_FIELDS]) {
+	struct caer_davis_info *info = &handle->cHandle.info;
+	davisCommonState state       = &handle->cHandle.state;
+
+	fields[0]  = USB_RECORD_FIELD(info->deviceID, USB_RECORD_INT16);
+	fields[1]  = USB_RECORD_FIELD(info->deviceSerialNumber, USB_RECORD_STRING);
+	fields[2]  = USB_RECORD_FIELD(info->deviceUSBBusNumber, USB_RECORD_UINT8);
+	fields[3]  = USB_RECORD_FIELD(info->deviceUSBDeviceAddress, USB_RECORD_UINT8);
+	fields[4]  = USB_RECORD_FIELD(info->firmwareVersion, USB_RECORD_INT16);
+	fields[5]  = USB_RECORD_FIELD(info->logicVersion, USB_RECORD_INT16);
+	fields[6]  = USB_RECORD_FIELD(info->chipID, USB_RECORD_INT16);
+	fields[7]  = USB_RECORD_FIELD(info->deviceIsMaster, USB_RECORD_BOOL);
+	fields[8]  = USB_RECORD_FIELD(info->muxHasStatistics, USB_RECORD_BOOL);
+	fields[9]  = USB_RECORD_FIELD(info->dvsSizeX, USB_RECORD_INT16);
+	fields[10] = USB_RECORD_FIELD(info->dvsSizeY, USB_RECORD_INT16);
+	fields[11] = USB_RECORD_FIELD(info->dvsHasPixelFilter, USB_RECORD_BOOL);
+	fields[12] = USB_RECORD_FIELD(info->dvsHasBackgroundActivityFilter, USB_RECORD_BOOL);
+	fields[13] = USB_RECORD_FIELD(info->dvsHasROIFilter, USB_RECORD_BOOL);
+	fields[14] = USB_RECORD_FIELD(info->dvsHasSkipFilter, USB_RECORD_BOOL);
+	fields[15] = USB_RECORD_FIELD(info->dvsHasPolarityFilter, USB_RECORD_BOOL);
+	fields[16] = USB_RECORD_FIELD(info->dvsHasStatistics, USB_RECORD_BOOL);
+	fields[17] = USB_RECORD_FIELD(info->apsSizeX, USB_RECORD_INT16);
+	fields[18] = USB_RECORD_FIELD(info->apsSizeY, USB_RECORD_INT16);
+	fields[19] = USB_RECORD_FIELD(info->apsColorFilter, USB_RECORD_ENUM);
+	fields[20] = USB_RECORD_FIELD(info->apsHasGlobalShutter, USB_RECORD_BOOL);
+	fields[21] = USB_RECORD_FIELD(info->imuType, USB_RECORD_ENUM);
+	fields[22] = USB_RECORD_FIELD(info->extInputHasGenerator, USB_RECORD_BOOL);
+	fields[23] = USB_RECORD_FIELD(state->timestamps.wrapOverflow, USB_RECORD_INT32);
+	fields[24] = USB_RECORD_FIELD(state->timestamps.wrapAdd, USB_RECORD_INT32);
+	fields[25] = USB_RECORD_FIELD(state->timestamps.last, USB_RECORD_INT32);
+	fields[26] = USB_RECORD_FIELD(state->timestamps.current, USB_RECORD_INT32);
+	fields[27] = USB_RECORD_FIELD(state->dvs.lastY, USB_RECORD_UINT16);
+	fields[28] = USB_RECORD_FIELD(state->dvs.sizeX, USB_RECORD_UINT16);
+	fields[29] = USB_RECORD_FIELD(state->dvs.sizeY, USB_RECORD_UINT16);
+	fields[30] = USB_RECORD_FIELD(state->dvs.invertXY, USB_RECORD_BOOL);
+	fields[31] = USB_RECORD_FIELD(state->aps.sizeX, USB_RECORD_UINT16);
+	fields[32] = USB_RECORD_FIELD(state->aps.sizeY, USB_RECORD_UINT16);
+	fields[33] = USB_RECORD_FIELD(state->aps.invertXY, USB_RECORD_BOOL);
+	fields[34] = USB_RECORD_FIELD(state->aps.flipX, USB_RECORD_BOOL);
+	fields[35] = USB_RECORD_FIELD(state->aps.flipY, USB_RECORD_BOOL);
+	fields[36] = USB_RECORD_FIELD(state->aps.globalShutter, USB_RECORD_BOOL);
+	fields[37] = USB_RECORD_FIELD(state->aps.roi.tmpData, USB_RECORD_UINT16);
+	fields[38] = USB_RECORD_FIELD(state->aps.roi.update, USB_RECORD_UINT16);
+	fields[39] = USB_RECORD_FIELD(state->aps.roi.positionX, USB_RECORD_UINT16);
+	fields[40] = USB_RECORD_FIELD(state->aps.roi.positionY, USB_RECORD_UINT16);
+	fields[41] = USB_RECORD_FIELD(state->aps.roi.sizeX, USB_RECORD_UINT16);
+	fields[42] = USB_RECORD_FIELD(state->aps.roi.sizeY, USB_RECORD_UINT16);
+	fields[43] = USB_RECORD_FIELD(state->aps.cDavisSupport.offsetDirection, USB_RECORD_BOOL);
+	fields[44] = USB_RECORD_FIELD(state->aps.cDavisSupport.offset, USB_RECORD_INT16);
+	fields[45] = USB_RECORD_FIELD(state->aps.expectedCountX, USB_RECORD_UINT16);
+	fields[46] = USB_RECORD_FIELD(state->aps.expectedCountY, USB_RECORD_UINT16);
+	fields[47] = USB_RECORD_FIELD(state->aps.frame.mode, USB_RECORD_ATOMIC_UINT8);
+	fields[48] = USB_RECORD_FIELD(state->imu.ignoreEvents, USB_RECORD_BOOL);
+	fields[49] = USB_RECORD_FIELD(state->imu.flipX, USB_RECORD_BOOL);
+	fields[50] = USB_RECORD_FIELD(state->imu.flipY, USB_RECORD_BOOL);
+	fields[51] = USB_RECORD_FIELD(state->imu.flipZ, USB_RECORD_BOOL);
+	fields[52] = USB_RECORD_FIELD(state->imu.type, USB_RECORD_UINT8);
+	fields[53] = USB_RECORD_FIELD(state->imu.count, USB_RECORD_UINT8);
+	fields[54] = USB_RECORD_FIELD(state->imu.tmpData, USB_RECORD_UINT8);
+	fields[55] = USB_RECORD_FIELD(state->imu.accelScale, USB_RECORD_FLOAT);
+	fields[56] = USB_RECORD_FIELD(state->imu.gyroScale, USB_RECORD_FLOAT);
+	fields[57] = USB_RECORD_FIELD(state->deviceClocks.logicClock, USB_RECORD_UINT16);
+	fields[58] = USB_RECORD_FIELD(state->deviceClocks.adcClock, USB_RECORD_UINT16);
+	fields[59] = USB_RECORD_FIELD(state->deviceClocks.usbClock, USB_RECORD_UINT16);
+	fields[60] = USB_RECORD_FIELD(state->deviceClocks.clockDeviationFactor, USB_RECORD_UINT16);
+	fields[61] = USB_RECORD_FIELD(state->deviceClocks.logicClockActual, USB_RECORD_FLOAT);
+	fields[62] = USB_RECORD_FIELD(state->deviceClocks.adcClockActual, USB_RECORD_FLOAT);
+	fields[63] = USB_RECORD_FIELD(state->deviceClocks.usbClockActual, USB_RECORD_FLOAT);
+}
+
+static caerDeviceHandle davisReplayOpenInternal(
+	uint16_t deviceType, uint16_t deviceID, const char *filePath, bool maxSpeed) {
+	errno = 0;
+
+	caerLog(CAER_LOG_DEBUG, __func__, "Initializing %s replay.", DAVIS_DEVICE_NAME);
+
+	davisHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		// Failed to allocate memory for device handle!
+		caerLog(CAER_LOG_CRITICAL, __func__, "Failed to allocate memory for device handle.");
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	// Set main deviceType correctly right away.
+	handle->cHandle.deviceType = deviceType;
+
+	// Setup common handling.
+	handle->cHandle.spiConfigPtr = &handle->usbState;
+
+	davisCommonState state = &handle->cHandle.state;
+
+	// Initialize state variables to default values (if not zero, taken care of by calloc above).
+	dataExchangeSettingsInit(&state->dataExchange);
+
+	// Replay must not drop data, to reproduce the recorded output exactly.
+	atomic_store(&state->dataExchange.dropPolicy, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER);
+
+	// Packet settings (size (in events) and time interval (in µs)).
+	containerGenerationSettingsInit(&state->container);
+
+	// Logging settings (initialize to global log-level).
+	enum caer_log_level globalLogLevel = caerLogLevelGet();
+	atomic_store(&state->deviceLogLevel, globalLogLevel);
+	usbSetLogLevel(&handle->usbState, globalLogLevel);
+
+	// Set device thread name. Maximum length of 15 chars due to Linux limitations.
+	char usbThreadName[MAX_THREAD_NAME_LENGTH + 1];
+	snprintf(usbThreadName, MAX_THREAD_NAME_LENGTH + 1, "%s ID-%" PRIu16, DAVIS_DEVICE_NAME, deviceID);
+	usbThreadName[MAX_THREAD_NAME_LENGTH] = '\0';
+
+	usbSetThreadName(&handle->usbState, usbThreadName);
+
+	// Restore recorded info and translator state.
+	struct usb_record_field fields[DAVIS_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	bool replayOpened = usbReplayOpen(&handle->usbState, filePath, maxSpeed, deviceType, fields, DAVIS_RECORD_FIELDS);
+
+	handle->cHandle.info.deviceString = usbThreadName; // Temporary, until replaced by full string.
+
+	if (!replayOpened) {
+		davisLog(CAER_LOG_CRITICAL, &handle->cHandle,
+			"Failed to open replay, see above log message for more information.");
+
+		free(handle);
+
+		// errno set by usbReplayOpen().
+		return (NULL);
+	}
+
+	char *replayInfoString = malloc(USB_INFO_STRING_SIZE);
+	if (replayInfoString == NULL) {
+		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to generate replay information string.");
+
+		usbDeviceClose(&handle->usbState);
+		free(handle);
+
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	snprintf(replayInfoString, USB_INFO_STRING_SIZE, DAVIS_DEVICE_NAME " ID-%" PRIu16 " SN-%s [replay]", deviceID,
+		handle->cHandle.info.deviceSerialNumber);
+
+	handle->cHandle.info.deviceID     = I16T(deviceID);
+	handle->cHandle.info.deviceString = replayInfoString;
+
+	// Setup replay, same translator as USB.
+	usbSetDataCallback(&handle->usbState, &davisEventTranslator, handle);
+	usbSetRawDataCallback(&handle->usbState, &davisRawDataExchange, handle);
+	usbSetStatistics(&handle->usbState, &handle->cHandle.state.container.statistics);
+
+	davisLog(CAER_LOG_DEBUG, &handle->cHandle, "Initialized replay of '%s' successfully.", filePath);
+
+	return ((caerDeviceHandle) handle);
+}
+
+bool davisRawRecordStart(caerDeviceHandle cdh, const char *filePath) {
+	davisHandle handle = (davisHandle) cdh;
+
+	struct usb_record_field fields[DAVIS_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	return (usbRecordStart(&handle->usbState, filePath, handle->cHandle.deviceType, fields, DAVIS_RECORD_FIELDS));
+}
+
 bool davisSendDefaultConfig(caerDeviceHandle cdh) {
 	davisHandle handle = (davisHandle) cdh;
 
@@ -465,26 +651,37 @@ bool davisDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
 		return (false);
 	}
 
-	// Ensure no data is left over from previous runs, if the camera
-	// wasn't shut-down properly. First ensure it is shut down completely.
-	davisConfigSet(cdh, DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_RUN, false);
-	davisConfigSet(cdh, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_RUN, false);
-	davisConfigSet(cdh, DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_RUN_ACCELEROMETER, false);
-	davisConfigSet(cdh, DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_RUN_GYROSCOPE, false);
-	davisConfigSet(cdh, DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_RUN_TEMPERATURE, false);
-	davisConfigSet(cdh, DAVIS_CONFIG_EXTINPUT, DAVIS_CONFIG_EXTINPUT_RUN_DETECTOR, false);
+	// A replay has no device to configure, the data comes from the recording.
+	if (!usbIsReplay(&handle->usbState)) {
+		// Ensure no data is left over from previous runs, if the camera
+		// wasn't shut-down properly. First ensure it is shut down completely.
+		davisConfigSet(cdh, DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_RUN, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_RUN, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_RUN_ACCELEROMETER, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_RUN_GYROSCOPE, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_RUN_TEMPERATURE, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_EXTINPUT, DAVIS_CONFIG_EXTINPUT_RUN_DETECTOR, false);
 
-	davisConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_RUN, false);
-	davisConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_TIMESTAMP_RUN, false);
-	davisConfigSet(cdh, DAVIS_CONFIG_USB, DAVIS_CONFIG_USB_RUN, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_RUN, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_TIMESTAMP_RUN, false);
+		davisConfigSet(cdh, DAVIS_CONFIG_USB, DAVIS_CONFIG_USB_RUN, false);
+
+		davisConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_RUN_CHIP, false);
+
+		// Then wait 10ms for FPGA device side buffers to clear.
+		thrd_sleep(10000);
 
-	davisConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_RUN_CHIP, false);
+		// And reset the USB side of things.
+		usbControlResetDataEndpoint(&handle->usbState, USB_DEFAULT_DATA_ENDPOINT);
+	}
 
-	// Then wait 10ms for FPGA device side buffers to clear.
-	thrd_sleep(10000);
+	if (usbRawDataIsEnabled(&handle->usbState)) {
+		containerGenerationRawDataPoolFill(
+			&state->container, I32T(usbGetTransfersSize(&handle->usbState)), handle->cHandle.info.deviceID);
+	}
 
-	// And reset the USB side of things.
-	usbControlResetDataEndpoint(&handle->usbState, USB_DEFAULT_DATA_ENDPOINT);
+	// The decode thread, if any, gets the same back-pressure as the data exchange.
+	usbSetDecodeQueueBlocking(&handle->usbState, dataExchangeBlocksProducer(&state->dataExchange));
 
 	if (!usbDataTransfersStart(&handle->usbState)) {
 		freeAllDataMemory(state);
@@ -493,7 +690,7 @@ bool davisDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
 		return (false);
 	}
 
-	if (dataExchangeStartProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&handle->usbState) && dataExchangeStartProducers(&state->dataExchange)) {
 		// Enable data transfer on USB end-point 2.
 		davisConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_RUN_CHIP, true);
 
@@ -522,7 +719,7 @@ bool davisDataStop(caerDeviceHandle cdh) {
 	davisHandle handle     = (davisHandle) cdh;
 	davisCommonState state = &handle->cHandle.state;
 
-	if (dataExchangeStopProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&handle->usbState) && dataExchangeStopProducers(&state->dataExchange)) {
 		// Disable data transfer on USB end-point 2. Reverse order of enabling.
 		davisConfigSet(cdh, DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_RUN, false);
 		davisConfigSet(cdh, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_RUN, false);
@@ -551,6 +748,28 @@ caerEventPacketContainer davisDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&handle->cHandle.state.dataExchange, &handle->usbState.dataTransfersRun));
 }
 
+size_t davisDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	davisHandle handle = (davisHandle) cdh;
+
+	return (dataExchangeGetMany(&handle->cHandle.state.dataExchange, &handle->usbState.dataTransfersRun, containers,
+		maxContainers));
+}
+
+void davisDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	davisHandle handle = (davisHandle) cdh;
+
+	containerGenerationRecycle(&handle->cHandle.state.container, container);
+}
+
+static caerEventPacketHeader davisRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity) {
+	davisHandle handle     = (davisHandle) vhd;
+	davisCommonState state = &handle->cHandle.state;
+
+	return (containerGenerationRawDataExchange(&state->container, packet, capacity, &state->dataExchange,
+		&handle->usbState.dataTransfersRun, handle->cHandle.info.deviceID, handle->cHandle.info.deviceString,
+		&state->deviceLogLevel));
+}
+
 static void davisEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	davisHandle handle = (davisHandle) vhd;
 
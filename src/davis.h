@@ -20,6 +20,8 @@
 #define DEBUG_TRANSFER_NUM  4
 #define DEBUG_TRANSFER_SIZE 64
 
+#define DAVIS_RECORD_FIELDS 64
+
 struct davis_handle {
 	struct davis_common_handle cHandle;
 	// DAVIS USB device specific state.
@@ -47,6 +49,11 @@ caerDeviceHandle davisOpenFX3(
 
 bool davisClose(caerDeviceHandle cdh);
 
+caerDeviceHandle davisReplayOpenAll(uint16_t deviceID, const char *filePath, bool maxSpeed);
+caerDeviceHandle davisReplayOpenFX2(uint16_t deviceID, const char *filePath, bool maxSpeed);
+caerDeviceHandle davisReplayOpenFX3(uint16_t deviceID, const char *filePath, bool maxSpeed);
+bool davisRawRecordStart(caerDeviceHandle cdh, const char *filePath);
+
 bool davisSendDefaultConfig(caerDeviceHandle cdh);
 // Negative addresses are used for host-side configuration.
 // Positive addresses (including zero) are used for device-side configuration.
@@ -58,5 +65,7 @@ bool davisDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *pt
 	void *dataShutdownUserPtr);
 bool davisDataStop(caerDeviceHandle handle);
 caerEventPacketContainer davisDataGet(caerDeviceHandle handle);
+size_t davisDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+void davisDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DAVIS_H_ */
@@ -9,6 +9,7 @@
 #include "autoexposure.h"
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 #include "libcaer/frame_utils.h"
 #include "spi_config_interface.h"
 
@@ -176,6 +177,8 @@ static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncr
 static void davisCommonDataStop(davisCommonHandle handle);
 static void davisCommonEventTranslator(
 	davisCommonHandle handle, const uint8_t *buffer, size_t bufferSize, atomic_uint_fast32_t *transfersRunning);
+static void davisCommonContainerCommit(
+	davisCommonHandle handle, bool tsReset, bool tsBigWrap, atomic_uint_fast32_t *transfersRunning);
 static void davisCommonTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param);
 
 static void davisLog(enum caer_log_level logLevel, davisCommonHandle handle, const char *format, ...) {
@@ -199,28 +202,28 @@ static inline void freeAllDataMemory(davisCommonState state) {
 	// already assigned to the current packet container, we
 	// free them separately from it.
 	if (state->currentPackets.polarity != NULL) {
-		free(state->currentPackets.polarity);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.polarity);
 		state->currentPackets.polarity = NULL;
 
 		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
 	}
 
 	if (state->currentPackets.special != NULL) {
-		free(state->currentPackets.special);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
 		state->currentPackets.special = NULL;
 
 		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
 	}
 
 	if (state->currentPackets.frame != NULL) {
-		free(state->currentPackets.frame);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.frame);
 		state->currentPackets.frame = NULL;
 
 		containerGenerationSetPacket(&state->container, FRAME_EVENT, NULL);
 	}
 
 	if (state->currentPackets.imu6 != NULL) {
-		free(state->currentPackets.imu6);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.imu6);
 		state->currentPackets.imu6 = NULL;
 
 		containerGenerationSetPacket(&state->container, IMU6_EVENT, NULL);
@@ -260,6 +263,8 @@ static inline bool ensureSpaceForEvents(
 		return (false);
 	}
 
+	dataStatisticsIncrease(&handle->state.container.statistics.packetsGrown, 1);
+
 	*packet = grownPacket;
 	return (true);
 }
@@ -1012,6 +1017,10 @@ static bool davisCommonConfigSet(davisCommonHandle handle, int8_t modAddr, uint8
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigSet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1546,6 +1555,10 @@ static bool davisCommonConfigGet(davisCommonHandle handle, int8_t modAddr, uint8
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigGet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -2100,6 +2113,15 @@ static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncr
 		return (false);
 	}
 
+	if (!containerGenerationPoolInit(&state->container)) {
+		freeAllDataMemory(state);
+
+		davisLog(CAER_LOG_CRITICAL, handle, "Failed to initialize packet container recycling pool.");
+		return (false);
+	}
+
+	containerGenerationPolaritySizeInit(&state->container, DAVIS_POLARITY_DEFAULT_SIZE);
+
 	// Allocate packets.
 	if (!containerGenerationAllocate(&state->container, DAVIS_EVENT_TYPES)) {
 		freeAllDataMemory(state);
@@ -2206,6 +2228,167 @@ static void davisCommonDataStop(davisCommonHandle handle) {
 
 #define TS_WRAP_ADD 0x8000
 
+// Per-event-type commit triggers, see containerGenerationIsTypeCommitDue().
+static inline bool davisCommonIsTypeCommitDue(davisCommonState state) {
+	containerGeneration container = &state->container;
+	int64_t timestamp             = generateFullTimestamp(state->timestamps.wrapOverflow, state->timestamps.current);
+
+	return (containerGenerationIsTypeCommitDue(
+				container, SPECIAL_EVENT, state->currentPackets.specialPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, POLARITY_EVENT, state->currentPackets.polarityPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, FRAME_EVENT, state->currentPackets.framePosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, IMU6_EVENT, state->currentPackets.imu6Position, timestamp));
+}
+
+static void davisCommonContainerCommit(
+	davisCommonHandle handle, bool tsReset, bool tsBigWrap, atomic_uint_fast32_t *transfersRunning) {
+	davisCommonState state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	// Track how many polarity events go into a container, to pre-size the next packet.
+	containerGenerationPolaritySizeUpdate(&state->container, state->currentPackets.polarityPosition);
+
+	if (state->currentPackets.polarityPosition > 0) {
+		polarityGroupCountersCommit(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+		containerGenerationSetPacket(
+			&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+		// Run pixel filter auto-train. Can only be enabled if hw-filter present.
+		if (atomic_load_explicit(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, memory_order_relaxed)) {
+			if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
+				state->dvs.pixelFilterAutoTrain.noiseFilter
+					= caerFilterDVSNoiseInitialize(U16T(handle->info.dvsSizeX), U16T(handle->info.dvsSizeY));
+				if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
+					// Failed to initialize, auto-training not possible.
+					atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
+					goto out;
+				}
+
+				// Allocate+init success, configure it for hot-pixel learning.
+				caerFilterDVSNoiseConfigSet(
+					state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_COUNT, 1000);
+				caerFilterDVSNoiseConfigSet(
+					state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_TIME, 1000000);
+				caerFilterDVSNoiseConfigSet(
+					state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, true);
+			}
+
+			// NoiseFilter must be allocated and initialized if we get here.
+			caerFilterDVSNoiseApply(
+				state->dvs.pixelFilterAutoTrain.noiseFilter, state->currentPackets.polarity);
+
+			uint64_t stillLearning = 1;
+			caerFilterDVSNoiseConfigGet(
+				state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, &stillLearning);
+
+			if (!stillLearning) {
+				// Learning done, we can grab the list of hot pixels, and hardware-filter them.
+				caerFilterDVSPixel hotPixels;
+				ssize_t hotPixelsSize
+					= caerFilterDVSNoiseGetHotPixels(state->dvs.pixelFilterAutoTrain.noiseFilter, &hotPixels);
+				if (hotPixelsSize < 0) {
+					// Failed to get list.
+					atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
+					goto out;
+				}
+
+				// Limit to maximum hardware size.
+				if (hotPixelsSize > DVS_HOTPIXEL_HW_MAX) {
+					hotPixelsSize = DVS_HOTPIXEL_HW_MAX;
+				}
+
+				// Go through the found pixels and filter them. Disable not used slots.
+				size_t i = 0;
+
+				for (; i < (size_t) hotPixelsSize; i++) {
+					spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+						U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i),
+						(state->dvs.invertXY) ? (hotPixels[i].y) : (hotPixels[i].x), NULL, NULL);
+					spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+						U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i),
+						(state->dvs.invertXY) ? (hotPixels[i].x) : (hotPixels[i].y), NULL, NULL);
+				}
+
+				for (; i < DVS_HOTPIXEL_HW_MAX; i++) {
+					spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+						U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i), U32T(state->dvs.sizeX), NULL,
+						NULL);
+					spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
+						U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i), U32T(state->dvs.sizeY), NULL, NULL);
+				}
+
+				// We're done!
+				free(hotPixels);
+
+				atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
+				goto out;
+			}
+		}
+		else {
+		out:
+			// Deallocate when turned off, either by user or by having completed.
+			if (state->dvs.pixelFilterAutoTrain.noiseFilter != NULL) {
+				caerFilterDVSNoiseDestroy(state->dvs.pixelFilterAutoTrain.noiseFilter);
+				state->dvs.pixelFilterAutoTrain.noiseFilter = NULL;
+			}
+		}
+
+		state->currentPackets.polarity         = NULL;
+		state->currentPackets.polarityPosition = 0;
+		emptyContainerCommit                   = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	if (state->currentPackets.framePosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, FRAME_EVENT, (caerEventPacketHeader) state->currentPackets.frame);
+
+		state->currentPackets.frame         = NULL;
+		state->currentPackets.framePosition = 0;
+		emptyContainerCommit                = false;
+	}
+
+	if (state->currentPackets.imu6Position > 0) {
+		containerGenerationSetPacket(
+			&state->container, IMU6_EVENT, (caerEventPacketHeader) state->currentPackets.imu6);
+
+		state->currentPackets.imu6         = NULL;
+		state->currentPackets.imu6Position = 0;
+		emptyContainerCommit               = false;
+	}
+
+	if (tsReset || tsBigWrap) {
+		// Ignore all APS and IMU6 (composite) events, until a new APS or IMU6
+		// Start event comes in, for the next packet.
+		// This is to correctly support the forced packet commits that a TS reset,
+		// or a TS big wrap, impose. Continuing to parse events would result
+		// in a corrupted state of the first event in the new packet, as it would
+		// be incomplete, incorrect and miss vital initialization data.
+		// See APS and IMU6 END states for more details on a related issue.
+		state->aps.ignoreEvents = true;
+		state->imu.ignoreEvents = true;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, transfersRunning, handle->info.deviceID,
+		handle->info.deviceString, &state->deviceLogLevel);
+}
+
 static void davisCommonEventTranslator(
 	davisCommonHandle handle, const uint8_t *buffer, size_t bufferSize, atomic_uint_fast32_t *transfersRunning) {
 	davisCommonState state = &handle->state;
@@ -2224,8 +2407,13 @@ static void davisCommonEventTranslator(
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DAVIS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, DAVIS_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					DAVIS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -2233,8 +2421,15 @@ static void davisCommonEventTranslator(
 		}
 
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DAVIS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			int32_t polaritySize = containerGenerationPolaritySizePredict(&state->container);
+
+			state->currentPackets.polarity = (caerPolarityEventPacket) containerGenerationPacketReuse(
+				&state->container, POLARITY_EVENT, POLARITY_EVENT, polaritySize, state->timestamps.wrapOverflow);
+			if (state->currentPackets.polarity == NULL) {
+				state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+					polaritySize, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.polarity == NULL) {
 				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
 				return;
@@ -2252,8 +2447,13 @@ static void davisCommonEventTranslator(
 		}
 
 		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.imu6 = (caerIMU6EventPacket) containerGenerationPacketReuse(&state->container,
+				IMU6_EVENT, IMU6_EVENT, DAVIS_IMU_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.imu6 == NULL) {
+				state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
+					DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.imu6 == NULL) {
 				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
 				return;
@@ -2761,21 +2961,17 @@ static void davisCommonEventTranslator(
 
 					if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
 							(size_t) state->currentPackets.polarityPosition, 1, handle)) {
-						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-							state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
 						// Timestamp at event-stream insertion point.
-						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-						caerPolarityEventSetPolarity(currentPolarityEvent, (code & 0x01));
 						if (state->dvs.invertXY) {
-							caerPolarityEventSetY(currentPolarityEvent, data);
-							caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
+							polarityGroupEventStore(state->currentPackets.polarity,
+								state->currentPackets.polarityPosition, state->dvs.lastY, data, (code & 0x01),
+								state->timestamps.current);
 						}
 						else {
-							caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-							caerPolarityEventSetX(currentPolarityEvent, data);
+							polarityGroupEventStore(state->currentPackets.polarity,
+								state->currentPackets.polarityPosition, data, state->dvs.lastY, (code & 0x01),
+								state->timestamps.current);
 						}
-						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
 						state->currentPackets.polarityPosition++;
 					}
 
@@ -3083,146 +3279,20 @@ static void davisCommonEventTranslator(
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && davisCommonIsTypeCommitDue(state);
+
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				// Run pixel filter auto-train. Can only be enabled if hw-filter present.
-				if (atomic_load_explicit(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, memory_order_relaxed)) {
-					if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
-						state->dvs.pixelFilterAutoTrain.noiseFilter
-							= caerFilterDVSNoiseInitialize(U16T(handle->info.dvsSizeX), U16T(handle->info.dvsSizeY));
-						if (state->dvs.pixelFilterAutoTrain.noiseFilter == NULL) {
-							// Failed to initialize, auto-training not possible.
-							atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
-							goto out;
-						}
-
-						// Allocate+init success, configure it for hot-pixel learning.
-						caerFilterDVSNoiseConfigSet(
-							state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_COUNT, 1000);
-						caerFilterDVSNoiseConfigSet(
-							state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_TIME, 1000000);
-						caerFilterDVSNoiseConfigSet(
-							state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, true);
-					}
-
-					// NoiseFilter must be allocated and initialized if we get here.
-					caerFilterDVSNoiseApply(
-						state->dvs.pixelFilterAutoTrain.noiseFilter, state->currentPackets.polarity);
-
-					uint64_t stillLearning = 1;
-					caerFilterDVSNoiseConfigGet(
-						state->dvs.pixelFilterAutoTrain.noiseFilter, CAER_FILTER_DVS_HOTPIXEL_LEARN, &stillLearning);
-
-					if (!stillLearning) {
-						// Learning done, we can grab the list of hot pixels, and hardware-filter them.
-						caerFilterDVSPixel hotPixels;
-						ssize_t hotPixelsSize
-							= caerFilterDVSNoiseGetHotPixels(state->dvs.pixelFilterAutoTrain.noiseFilter, &hotPixels);
-						if (hotPixelsSize < 0) {
-							// Failed to get list.
-							atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
-							goto out;
-						}
-
-						// Limit to maximum hardware size.
-						if (hotPixelsSize > DVS_HOTPIXEL_HW_MAX) {
-							hotPixelsSize = DVS_HOTPIXEL_HW_MAX;
-						}
-
-						// Go through the found pixels and filter them. Disable not used slots.
-						size_t i = 0;
-
-						for (; i < (size_t) hotPixelsSize; i++) {
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i),
-								(state->dvs.invertXY) ? (hotPixels[i].y) : (hotPixels[i].x), NULL, NULL);
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i),
-								(state->dvs.invertXY) ? (hotPixels[i].x) : (hotPixels[i].y), NULL, NULL);
-						}
-
-						for (; i < DVS_HOTPIXEL_HW_MAX; i++) {
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_COLUMN + 2 * i), U32T(state->dvs.sizeX), NULL,
-								NULL);
-							spiConfigSendAsync(handle->spiConfigPtr, DAVIS_CONFIG_DVS,
-								U8T(DAVIS_CONFIG_DVS_FILTER_PIXEL_0_ROW + 2 * i), U32T(state->dvs.sizeY), NULL, NULL);
-						}
-
-						// We're done!
-						free(hotPixels);
-
-						atomic_store(&state->dvs.pixelFilterAutoTrain.autoTrainRunning, false);
-						goto out;
-					}
-				}
-				else {
-				out:
-					// Deallocate when turned off, either by user or by having completed.
-					if (state->dvs.pixelFilterAutoTrain.noiseFilter != NULL) {
-						caerFilterDVSNoiseDestroy(state->dvs.pixelFilterAutoTrain.noiseFilter);
-						state->dvs.pixelFilterAutoTrain.noiseFilter = NULL;
-					}
-				}
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			if (state->currentPackets.framePosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, FRAME_EVENT, (caerEventPacketHeader) state->currentPackets.frame);
-
-				state->currentPackets.frame         = NULL;
-				state->currentPackets.framePosition = 0;
-				emptyContainerCommit                = false;
-			}
-
-			if (state->currentPackets.imu6Position > 0) {
-				containerGenerationSetPacket(
-					&state->container, IMU6_EVENT, (caerEventPacketHeader) state->currentPackets.imu6);
-
-				state->currentPackets.imu6         = NULL;
-				state->currentPackets.imu6Position = 0;
-				emptyContainerCommit               = false;
-			}
-
-			if (tsReset || tsBigWrap) {
-				// Ignore all APS and IMU6 (composite) events, until a new APS or IMU6
-				// Start event comes in, for the next packet.
-				// This is to correctly support the forced packet commits that a TS reset,
-				// or a TS big wrap, impose. Continuing to parse events would result
-				// in a corrupted state of the first event in the new packet, as it would
-				// be incomplete, incorrect and miss vital initialization data.
-				// See APS and IMU6 END states for more details on a related issue.
-				state->aps.ignoreEvents = true;
-				state->imu.ignoreEvents = true;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, transfersRunning, handle->info.deviceID,
-				handle->info.deviceString, &state->deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			davisCommonContainerCommit(handle, tsReset, tsBigWrap, transfersRunning);
 		}
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		davisCommonContainerCommit(handle, false, false, transfersRunning);
+	}
 }
 
 static void davisCommonTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param) {
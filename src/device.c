@@ -29,6 +29,34 @@ static caerDeviceHandle (*usbConstructors[CAER_SUPPORTED_DEVICES_NUMBER])(
 		[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKOpen,
 };
 
+static caerDeviceHandle (*replayConstructors[CAER_SUPPORTED_DEVICES_NUMBER])(
+	uint16_t deviceID, const char *filePath, bool maxSpeed)
+	= {
+		[CAER_DEVICE_DVS128]      = &dvs128ReplayOpen,
+		[CAER_DEVICE_DAVIS_FX2]   = &davisReplayOpenFX2,
+		[CAER_DEVICE_DAVIS_FX3]   = &davisReplayOpenFX3,
+		[CAER_DEVICE_DYNAPSE]     = NULL,
+		[CAER_DEVICE_DAVIS]       = &davisReplayOpenAll,
+		[CAER_DEVICE_EDVS]        = NULL,
+		[CAER_DEVICE_DAVIS_RPI]   = NULL,
+		[CAER_DEVICE_DVS132S]     = NULL,
+		[CAER_DEVICE_DVXPLORER]   = &dvXplorerReplayOpen,
+		[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKReplayOpen,
+};
+
+static bool (*rawRecordStarters[CAER_SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle, const char *filePath) = {
+	[CAER_DEVICE_DVS128]      = &dvs128RawRecordStart,
+	[CAER_DEVICE_DAVIS_FX2]   = &davisRawRecordStart,
+	[CAER_DEVICE_DAVIS_FX3]   = &davisRawRecordStart,
+	[CAER_DEVICE_DYNAPSE]     = NULL,
+	[CAER_DEVICE_DAVIS]       = &davisRawRecordStart,
+	[CAER_DEVICE_EDVS]        = NULL,
+	[CAER_DEVICE_DAVIS_RPI]   = NULL,
+	[CAER_DEVICE_DVS132S]     = NULL,
+	[CAER_DEVICE_DVXPLORER]   = &dvXplorerRawRecordStart,
+	[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKRawRecordStart,
+};
+
 static caerDeviceHandle (*serialConstructors[CAER_SUPPORTED_DEVICES_NUMBER])(
 	uint16_t deviceID, const char *serialPortName, uint32_t serialBaudRate)
 	= {
@@ -174,6 +202,44 @@ static caerEventPacketContainer (*dataGetters[CAER_SUPPORTED_DEVICES_NUMBER])(ca
 	[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataGet,
 };
 
+static size_t (*dataManyGetters[CAER_SUPPORTED_DEVICES_NUMBER])(
+	caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers)
+	= {
+		[CAER_DEVICE_DVS128]    = &dvs128DataGetMany,
+		[CAER_DEVICE_DAVIS_FX2] = &davisDataGetMany,
+		[CAER_DEVICE_DAVIS_FX3] = &davisDataGetMany,
+		[CAER_DEVICE_DYNAPSE]   = &dynapseDataGetMany,
+		[CAER_DEVICE_DAVIS]     = &davisDataGetMany,
+#if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 1
+		[CAER_DEVICE_EDVS] = &edvsDataGetMany,
+#else
+		[CAER_DEVICE_EDVS]     = NULL,
+#endif
+		[CAER_DEVICE_DAVIS_RPI]   = NULL,
+		[CAER_DEVICE_DVS132S]     = &dvs132sDataGetMany,
+		[CAER_DEVICE_DVXPLORER]   = &dvXplorerDataGetMany,
+		[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataGetMany,
+};
+
+static void (*dataRecyclers[CAER_SUPPORTED_DEVICES_NUMBER])(
+	caerDeviceHandle handle, caerEventPacketContainer container)
+	= {
+		[CAER_DEVICE_DVS128]    = &dvs128DataRecycle,
+		[CAER_DEVICE_DAVIS_FX2] = &davisDataRecycle,
+		[CAER_DEVICE_DAVIS_FX3] = &davisDataRecycle,
+		[CAER_DEVICE_DYNAPSE]   = &dynapseDataRecycle,
+		[CAER_DEVICE_DAVIS]     = &davisDataRecycle,
+#if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 1
+		[CAER_DEVICE_EDVS] = &edvsDataRecycle,
+#else
+		[CAER_DEVICE_EDVS]     = NULL,
+#endif
+		[CAER_DEVICE_DAVIS_RPI]   = NULL,
+		[CAER_DEVICE_DVS132S]     = &dvs132sDataRecycle,
+		[CAER_DEVICE_DVXPLORER]   = &dvXplorerDataRecycle,
+		[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataRecycle,
+};
+
 // Add empty InfoGet for optional devices, such as serial ones.
 #if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 0
 struct caer_edvs_info caerEDVSInfoGet(caerDeviceHandle handle) {
@@ -204,6 +270,44 @@ caerDeviceHandle caerDeviceOpen(uint16_t deviceID, uint16_t deviceType, uint8_t
 	return (usbConstructors[deviceType](deviceID, busNumberRestrict, devAddressRestrict, serialNumberRestrict));
 }
 
+caerDeviceHandle caerDeviceRawReplayOpen(uint16_t deviceID, uint16_t deviceType, const char *filePath, bool maxSpeed) {
+	// Check if device type is supported.
+	if (deviceType >= CAER_SUPPORTED_DEVICES_NUMBER) {
+		return (NULL);
+	}
+
+	// Check if the path is valid.
+	if (filePath == NULL) {
+		return (NULL);
+	}
+
+	// Execute replay constructor function.
+	if (replayConstructors[deviceType] == NULL) {
+		return (NULL);
+	}
+
+	return (replayConstructors[deviceType](deviceID, filePath, maxSpeed));
+}
+
+bool caerDeviceRawRecordStart(caerDeviceHandle handle, const char *filePath) {
+	// Check if the pointers are valid.
+	if ((handle == NULL) || (filePath == NULL)) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= CAER_SUPPORTED_DEVICES_NUMBER) {
+		return (false);
+	}
+
+	// Call appropriate function.
+	if (rawRecordStarters[handle->deviceType] == NULL) {
+		return (false);
+	}
+
+	return (rawRecordStarters[handle->deviceType](handle, filePath));
+}
+
 caerDeviceHandle caerDeviceOpenSerial(
 	uint16_t deviceID, uint16_t deviceType, const char *serialPortName, uint32_t serialBaudRate) {
 	// Check if device type is supported.
@@ -371,6 +475,41 @@ caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle) {
 	return (dataGetters[handle->deviceType](handle));
 }
 
+size_t caerDeviceDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers) {
+	// Check if the pointers are valid.
+	if ((handle == NULL) || (containers == NULL)) {
+		return (0);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= CAER_SUPPORTED_DEVICES_NUMBER) {
+		return (0);
+	}
+
+	// Call appropriate function.
+	if (dataManyGetters[handle->deviceType] == NULL) {
+		return (0);
+	}
+
+	return (dataManyGetters[handle->deviceType](handle, containers, maxContainers));
+}
+
+void caerDeviceDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container) {
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		caerEventPacketContainerFree(container);
+		return;
+	}
+
+	// Check if device type is supported.
+	if ((handle->deviceType >= CAER_SUPPORTED_DEVICES_NUMBER) || (dataRecyclers[handle->deviceType] == NULL)) {
+		caerEventPacketContainerFree(container);
+		return;
+	}
+
+	dataRecyclers[handle->deviceType](handle, container);
+}
+
 bool caerDeviceConfigGet64(caerDeviceHandle handle, int8_t modAddr, uint8_t paramAddr, uint64_t *param) {
 	// Ensure param is zeroed out.
 	*param = 0;
@@ -2,6 +2,8 @@
 
 static void dvs128Log(enum caer_log_level logLevel, dvs128Handle handle, const char *format, ...) ATTRIBUTE_FORMAT(3);
 static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent);
+static void dvs128ContainerCommit(dvs128Handle handle, bool tsReset);
+static caerEventPacketHeader dvs128RawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity);
 static bool dvs128SendBiases(dvs128State state);
 
 static void dvs128Log(enum caer_log_level logLevel, dvs128Handle handle, const char *format, ...) {
@@ -55,14 +57,14 @@ static inline void freeAllDataMemory(dvs128State state) {
 	// already assigned to the current packet container, we
 	// free them separately from it.
 	if (state->currentPackets.polarity != NULL) {
-		free(state->currentPackets.polarity);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.polarity);
 		state->currentPackets.polarity = NULL;
 
 		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
 	}
 
 	if (state->currentPackets.special != NULL) {
-		free(state->currentPackets.special);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
 		state->currentPackets.special = NULL;
 
 		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
@@ -150,6 +152,8 @@ caerDeviceHandle dvs128Open(
 
 	// Setup USB.
 	usbSetDataCallback(&state->usbState, &dvs128EventTranslator, handle);
+	usbSetRawDataCallback(&state->usbState, &dvs128RawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
 	usbSetDataEndpoint(&state->usbState, DVS_DATA_ENDPOINT);
 	usbSetTransfersNumber(&state->usbState, 8);
 	usbSetTransfersSize(&state->usbState, 4096);
@@ -197,6 +201,121 @@ bool dvs128Close(caerDeviceHandle cdh) {
 	return (true);
 }
 
+// Device state needed by the translator, saved with raw recordings.
+static void recordFieldsGet(dvs128Handle handle, struct usb_record_field fields[DVS_RECORD_FIELDS]) {
+	struct caer_dvs128_info *info = &handle->info;
+	dvs128State state             = &handle->state;
+
+	fields[0]  = USB_RECORD_FIELD(info->deviceID, USB_RECORD_INT16);
+	fields[1]  = USB_RECORD_FIELD(info->deviceSerialNumber, USB_RECORD_STRING);
+	fields[2]  = USB_RECORD_FIELD(info->deviceUSBBusNumber, USB_RECORD_UINT8);
+	fields[3]  = USB_RECORD_FIELD(info->deviceUSBDeviceAddress, USB_RECORD_UINT8);
+	fields[4]  = USB_RECORD_FIELD(info->firmwareVersion, USB_RECORD_INT16);
+	fields[5]  = USB_RECORD_FIELD(info->deviceIsMaster, USB_RECORD_BOOL);
+	fields[6]  = USB_RECORD_FIELD(info->dvsSizeX, USB_RECORD_INT16);
+	fields[7]  = USB_RECORD_FIELD(info->dvsSizeY, USB_RECORD_INT16);
+	fields[8]  = USB_RECORD_FIELD(state->timestamps.wrapOverflow, USB_RECORD_INT32);
+	fields[9]  = USB_RECORD_FIELD(state->timestamps.wrapAdd, USB_RECORD_INT32);
+	fields[10] = USB_RECORD_FIELD(state->timestamps.last, USB_RECORD_INT32);
+	fields[11] = USB_RECORD_FIELD(state->timestamps.current, USB_RECORD_INT32);
+}
+
+caerDeviceHandle dvs128ReplayOpen(uint16_t deviceID, const char *filePath, bool maxSpeed) {
+	errno = 0;
+
+	caerLog(CAER_LOG_DEBUG, __func__, "Initializing %s replay.", DVS_DEVICE_NAME);
+
+	dvs128Handle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		// Failed to allocate memory for device handle!
+		caerLog(CAER_LOG_CRITICAL, __func__, "Failed to allocate memory for device handle.");
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	// Set main deviceType correctly right away.
+	handle->deviceType = CAER_DEVICE_DVS128;
+
+	dvs128State state = &handle->state;
+
+	// Initialize state variables to default values (if not zero, taken care of by calloc above).
+	dataExchangeSettingsInit(&state->dataExchange);
+
+	// Replay must not drop data, to reproduce the recorded output exactly.
+	atomic_store(&state->dataExchange.dropPolicy, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER);
+
+	// Packet settings (size (in events) and time interval (in µs)).
+	containerGenerationSettingsInit(&state->container);
+
+	// Logging settings (initialize to global log-level).
+	enum caer_log_level globalLogLevel = caerLogLevelGet();
+	atomic_store(&state->deviceLogLevel, globalLogLevel);
+	usbSetLogLevel(&state->usbState, globalLogLevel);
+
+	// Always master by default.
+	atomic_store(&state->dvs.isMaster, true);
+
+	// Set device thread name. Maximum length of 15 chars due to Linux limitations.
+	char usbThreadName[MAX_THREAD_NAME_LENGTH + 1];
+	snprintf(usbThreadName, MAX_THREAD_NAME_LENGTH + 1, "%s ID-%" PRIu16, DVS_DEVICE_NAME, deviceID);
+	usbThreadName[MAX_THREAD_NAME_LENGTH] = '\0';
+
+	usbSetThreadName(&state->usbState, usbThreadName);
+
+	// Restore recorded info and translator state.
+	struct usb_record_field fields[DVS_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	bool replayOpened
+		= usbReplayOpen(&state->usbState, filePath, maxSpeed, CAER_DEVICE_DVS128, fields, DVS_RECORD_FIELDS);
+
+	handle->info.deviceString = usbThreadName; // Temporary, until replaced by full string.
+
+	if (!replayOpened) {
+		dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to open replay, see above log message for more information.");
+
+		free(handle);
+
+		// errno set by usbReplayOpen().
+		return (NULL);
+	}
+
+	char *replayInfoString = malloc(USB_INFO_STRING_SIZE);
+	if (replayInfoString == NULL) {
+		dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to generate replay information string.");
+
+		usbDeviceClose(&state->usbState);
+		free(handle);
+
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	snprintf(replayInfoString, USB_INFO_STRING_SIZE, DVS_DEVICE_NAME " ID-%" PRIu16 " SN-%s [replay]", deviceID,
+		handle->info.deviceSerialNumber);
+
+	handle->info.deviceID     = I16T(deviceID);
+	handle->info.deviceString = replayInfoString;
+
+	// Setup replay, same translator as USB.
+	usbSetDataCallback(&state->usbState, &dvs128EventTranslator, handle);
+	usbSetRawDataCallback(&state->usbState, &dvs128RawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
+
+	dvs128Log(CAER_LOG_DEBUG, handle, "Initialized replay of '%s' successfully.", filePath);
+
+	return ((caerDeviceHandle) handle);
+}
+
+bool dvs128RawRecordStart(caerDeviceHandle cdh, const char *filePath) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+
+	struct usb_record_field fields[DVS_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	return (usbRecordStart(&handle->state.usbState, filePath, handle->deviceType, fields, DVS_RECORD_FIELDS));
+}
+
 struct caer_dvs128_info caerDVS128InfoGet(caerDeviceHandle cdh) {
 	dvs128Handle handle = (dvs128Handle) cdh;
 
@@ -255,6 +374,10 @@ bool dvs128ConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigSet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -373,6 +496,10 @@ bool dvs128ConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigGet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -455,6 +582,13 @@ bool dvs128DataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr)
 		return (false);
 	}
 
+	if (!containerGenerationPoolInit(&state->container)) {
+		freeAllDataMemory(state);
+
+		dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to initialize packet container recycling pool.");
+		return (false);
+	}
+
 	// Allocate packets.
 	if (!containerGenerationAllocate(&state->container, DVS_EVENT_TYPES)) {
 		freeAllDataMemory(state);
@@ -481,6 +615,14 @@ bool dvs128DataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr)
 		return (false);
 	}
 
+	if (usbRawDataIsEnabled(&state->usbState)) {
+		containerGenerationRawDataPoolFill(
+			&state->container, I32T(usbGetTransfersSize(&state->usbState)), handle->info.deviceID);
+	}
+
+	// The decode thread, if any, gets the same back-pressure as the data exchange.
+	usbSetDecodeQueueBlocking(&state->usbState, dataExchangeBlocksProducer(&state->dataExchange));
+
 	if (!usbDataTransfersStart(&state->usbState)) {
 		freeAllDataMemory(state);
 
@@ -488,7 +630,7 @@ bool dvs128DataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr)
 		return (false);
 	}
 
-	if (dataExchangeStartProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&state->usbState) && dataExchangeStartProducers(&state->dataExchange)) {
 		// Enable data transfer on USB end-point 6.
 		dvs128ConfigSet((caerDeviceHandle) handle, DVS128_CONFIG_DVS, DVS128_CONFIG_DVS_RUN, true);
 	}
@@ -500,7 +642,7 @@ bool dvs128DataStop(caerDeviceHandle cdh) {
 	dvs128Handle handle = (dvs128Handle) cdh;
 	dvs128State state   = &handle->state;
 
-	if (dataExchangeStopProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&state->usbState) && dataExchangeStopProducers(&state->dataExchange)) {
 		// Disable data transfer on USB end-point 6.
 		dvs128ConfigSet((caerDeviceHandle) handle, DVS128_CONFIG_DVS, DVS128_CONFIG_DVS_RUN, false);
 	}
@@ -527,6 +669,28 @@ caerEventPacketContainer dvs128DataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dvs128DataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+	dvs128State state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, maxContainers));
+}
+
+void dvs128DataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+	dvs128State state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
+static caerEventPacketHeader dvs128RawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity) {
+	dvs128Handle handle = vhd;
+	dvs128State state   = &handle->state;
+
+	return (containerGenerationRawDataExchange(&state->container, packet, capacity, &state->dataExchange,
+		&state->usbState.dataTransfersRun, handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel));
+}
+
 #define DVS128_TIMESTAMP_WRAP_MASK  0x80
 #define DVS128_TIMESTAMP_RESET_MASK 0x40
 #define DVS128_POLARITY_SHIFT       0
@@ -538,6 +702,49 @@ caerEventPacketContainer dvs128DataGet(caerDeviceHandle cdh) {
 #define DVS128_SYNC_EVENT_MASK      0x8000
 #define TS_WRAP_ADD                 0x4000
 
+// Per-event-type commit triggers, see containerGenerationIsTypeCommitDue().
+static inline bool dvs128IsTypeCommitDue(dvs128State state) {
+	containerGeneration container = &state->container;
+	int64_t timestamp             = generateFullTimestamp(state->timestamps.wrapOverflow, state->timestamps.current);
+
+	return (containerGenerationIsTypeCommitDue(
+				container, SPECIAL_EVENT, state->currentPackets.specialPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, POLARITY_EVENT, state->currentPackets.polarityPosition, timestamp));
+}
+
+static void dvs128ContainerCommit(dvs128Handle handle, bool tsReset) {
+	dvs128State state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	if (state->currentPackets.polarityPosition > 0) {
+		polarityGroupCountersCommit(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+		containerGenerationSetPacket(
+			&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+		state->currentPackets.polarity         = NULL;
+		state->currentPackets.polarityPosition = 0;
+		emptyContainerCommit                   = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
+		handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
+}
+
 static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	dvs128Handle handle = vhd;
 	dvs128State state   = &handle->state;
@@ -564,8 +771,13 @@ static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytes
 		}
 
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.polarity = (caerPolarityEventPacket) containerGenerationPacketReuse(&state->container,
+				POLARITY_EVENT, POLARITY_EVENT, DVS_POLARITY_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.polarity == NULL) {
+				state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+					DVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.polarity == NULL) {
 				dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
 				return;
@@ -583,11 +795,18 @@ static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytes
 			}
 
 			state->currentPackets.polarity = grownPacket;
+
+			dataStatisticsIncrease(&state->container.statistics.packetsGrown, 1);
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, DVS_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					DVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				dvs128Log(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -605,6 +824,8 @@ static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytes
 			}
 
 			state->currentPackets.special = grownPacket;
+
+			dataStatisticsIncrease(&state->container.statistics.packetsGrown, 1);
 		}
 
 		bool tsReset   = false;
@@ -712,15 +933,9 @@ static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytes
 					continue; // Skip invalid event.
 				}
 
-				caerPolarityEvent currentEvent = caerPolarityEventPacketGetEvent(
-					state->currentPackets.polarity, state->currentPackets.polarityPosition);
+				polarityGroupEventStore(state->currentPackets.polarity, state->currentPackets.polarityPosition, x, y,
+					polarity, state->timestamps.current);
 				state->currentPackets.polarityPosition++;
-
-				caerPolarityEventSetTimestamp(currentEvent, state->timestamps.current);
-				caerPolarityEventSetPolarity(currentEvent, polarity);
-				caerPolarityEventSetY(currentEvent, y);
-				caerPolarityEventSetX(currentEvent, x);
-				caerPolarityEventValidate(currentEvent, state->currentPackets.polarity);
 			}
 		}
 
@@ -735,40 +950,24 @@ static void dvs128EventTranslator(void *vhd, const uint8_t *buffer, size_t bytes
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && dvs128IsTypeCommitDue(state);
+
 		// NOTE: with the current DVS128 architecture, currentTimestamp always comes together
 		// with an event, so the very first event that matches this threshold will be
 		// also part of the committed packet container. This doesn't break any of the invariants.
 
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			dvs128ContainerCommit(handle, tsReset);
 		}
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		dvs128ContainerCommit(handle, false);
+	}
 }
 
 static bool dvs128SendBiases(dvs128State state) {
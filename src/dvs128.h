@@ -6,6 +6,7 @@
 
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 #include "usb_utils.h"
 
 #define DVS_DEVICE_NAME "DVS128"
@@ -20,6 +21,8 @@
 
 #define DVS_EVENT_TYPES 2
 
+#define DVS_RECORD_FIELDS 12
+
 #define DVS_POLARITY_DEFAULT_SIZE 4096
 #define DVS_SPECIAL_DEFAULT_SIZE  128
 
@@ -85,6 +88,9 @@ caerDeviceHandle dvs128Open(
 	uint16_t deviceID, uint8_t busNumberRestrict, uint8_t devAddressRestrict, const char *serialNumberRestrict);
 bool dvs128Close(caerDeviceHandle handle);
 
+caerDeviceHandle dvs128ReplayOpen(uint16_t deviceID, const char *filePath, bool maxSpeed);
+bool dvs128RawRecordStart(caerDeviceHandle cdh, const char *filePath);
+
 bool dvs128SendDefaultConfig(caerDeviceHandle handle);
 // Negative addresses are used for host-side configuration.
 // Positive addresses (including zero) are used for device-side configuration.
@@ -96,5 +102,7 @@ bool dvs128DataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *p
 	void *dataShutdownUserPtr);
 bool dvs128DataStop(caerDeviceHandle handle);
 caerEventPacketContainer dvs128DataGet(caerDeviceHandle handle);
+size_t dvs128DataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+void dvs128DataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DVS128_H_ */
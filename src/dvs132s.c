@@ -6,6 +6,8 @@ static void dvs132sLog(enum caer_log_level logLevel, dvs132sHandle handle, const
 static bool dvs132sSendDefaultFPGAConfig(caerDeviceHandle cdh);
 static bool dvs132sSendDefaultBiasConfig(caerDeviceHandle cdh);
 static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent);
+static void dvs132sContainerCommit(dvs132sHandle handle, bool tsReset, bool tsBigWrap);
+static caerEventPacketHeader dvs132sRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity);
 static void dvs132sTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param);
 
 // FX3 Debug Transfer Support
@@ -122,21 +124,21 @@ static inline void freeAllDataMemory(dvs132sState state) {
 	// already assigned to the current packet container, we
 	// free them separately from it.
 	if (state->currentPackets.polarity != NULL) {
-		free(state->currentPackets.polarity);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.polarity);
 		state->currentPackets.polarity = NULL;
 
 		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
 	}
 
 	if (state->currentPackets.special != NULL) {
-		free(state->currentPackets.special);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
 		state->currentPackets.special = NULL;
 
 		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
 	}
 
 	if (state->currentPackets.imu6 != NULL) {
-		free(state->currentPackets.imu6);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.imu6);
 		state->currentPackets.imu6 = NULL;
 
 		containerGenerationSetPacket(&state->container, IMU6_EVENT_PKT_POS, NULL);
@@ -223,6 +225,8 @@ caerDeviceHandle dvs132sOpen(
 
 	// Setup USB.
 	usbSetDataCallback(&state->usbState, &dvs132sEventTranslator, handle);
+	usbSetRawDataCallback(&state->usbState, &dvs132sRawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
 	usbSetDataEndpoint(&state->usbState, USB_DEFAULT_DATA_ENDPOINT);
 	usbSetTransfersNumber(&state->usbState, 8);
 	usbSetTransfersSize(&state->usbState, 8192);
@@ -443,6 +447,10 @@ bool dvs132sConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigSet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -666,6 +674,10 @@ bool dvs132sConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigGet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -926,6 +938,13 @@ bool dvs132sDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
+	if (!containerGenerationPoolInit(&state->container)) {
+		freeAllDataMemory(state);
+
+		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to initialize packet container recycling pool.");
+		return (false);
+	}
+
 	// Allocate packets.
 	if (!containerGenerationAllocate(&state->container, DVS132S_EVENT_TYPES)) {
 		freeAllDataMemory(state);
@@ -985,6 +1004,14 @@ bool dvs132sDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 	// And reset the USB side of things.
 	usbControlResetDataEndpoint(&state->usbState, USB_DEFAULT_DATA_ENDPOINT);
 
+	if (usbRawDataIsEnabled(&state->usbState)) {
+		containerGenerationRawDataPoolFill(
+			&state->container, I32T(usbGetTransfersSize(&state->usbState)), handle->info.deviceID);
+	}
+
+	// The decode thread, if any, gets the same back-pressure as the data exchange.
+	usbSetDecodeQueueBlocking(&state->usbState, dataExchangeBlocksProducer(&state->dataExchange));
+
 	if (!usbDataTransfersStart(&state->usbState)) {
 		freeAllDataMemory(state);
 
@@ -1060,6 +1087,28 @@ caerEventPacketContainer dvs132sDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dvs132sDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	dvs132sHandle handle = (dvs132sHandle) cdh;
+	dvs132sState state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, maxContainers));
+}
+
+void dvs132sDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dvs132sHandle handle = (dvs132sHandle) cdh;
+	dvs132sState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
+static caerEventPacketHeader dvs132sRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity) {
+	dvs132sHandle handle = vhd;
+	dvs132sState state   = &handle->state;
+
+	return (containerGenerationRawDataExchange(&state->container, packet, capacity, &state->dataExchange,
+		&state->usbState.dataTransfersRun, handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel));
+}
+
 #define TS_WRAP_ADD 0x8000
 
 static inline bool ensureSpaceForEvents(
@@ -1076,10 +1125,77 @@ static inline bool ensureSpaceForEvents(
 		return (false);
 	}
 
+	dataStatisticsIncrease(&handle->state.container.statistics.packetsGrown, 1);
+
 	*packet = grownPacket;
 	return (true);
 }
 
+// Per-event-type commit triggers, see containerGenerationIsTypeCommitDue().
+static inline bool dvs132sIsTypeCommitDue(dvs132sState state) {
+	containerGeneration container = &state->container;
+	int64_t timestamp             = generateFullTimestamp(state->timestamps.wrapOverflow, state->timestamps.current);
+
+	return (containerGenerationIsTypeCommitDue(
+				container, SPECIAL_EVENT, state->currentPackets.specialPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, POLARITY_EVENT, state->currentPackets.polarityPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, IMU6_EVENT, state->currentPackets.imu6Position, timestamp));
+}
+
+static void dvs132sContainerCommit(dvs132sHandle handle, bool tsReset, bool tsBigWrap) {
+	dvs132sState state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	if (state->currentPackets.polarityPosition > 0) {
+		polarityGroupCountersCommit(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+		containerGenerationSetPacket(
+			&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+		state->currentPackets.polarity         = NULL;
+		state->currentPackets.polarityPosition = 0;
+		emptyContainerCommit                   = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	if (state->currentPackets.imu6Position > 0) {
+		containerGenerationSetPacket(
+			&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
+
+		state->currentPackets.imu6         = NULL;
+		state->currentPackets.imu6Position = 0;
+		emptyContainerCommit               = false;
+	}
+
+	if (tsReset || tsBigWrap) {
+		// Ignore all IMU6 (composite) events, until a new IMU6
+		// Start event comes in, for the next packet.
+		// This is to correctly support the forced packet commits that a TS reset,
+		// or a TS big wrap, impose. Continuing to parse events would result
+		// in a corrupted state of the first event in the new packet, as it would
+		// be incomplete, incorrect and miss vital initialization data.
+		// See IMU6 END states for more details on a related issue.
+		state->imu.ignoreEvents = true;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
+		handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+}
+
 static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t bufferSize) {
 	dvs132sHandle handle = vhd;
 	dvs132sState state   = &handle->state;
@@ -1106,8 +1222,13 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVS132S_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, DVS132S_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					DVS132S_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -1115,8 +1236,13 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 		}
 
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVS132S_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.polarity = (caerPolarityEventPacket) containerGenerationPacketReuse(&state->container,
+				POLARITY_EVENT, POLARITY_EVENT, DVS132S_POLARITY_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.polarity == NULL) {
+				state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+					DVS132S_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.polarity == NULL) {
 				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
 				return;
@@ -1124,8 +1250,13 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 		}
 
 		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DVS132S_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.imu6 = (caerIMU6EventPacket) containerGenerationPacketReuse(&state->container,
+				IMU6_EVENT_PKT_POS, IMU6_EVENT, DVS132S_IMU_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.imu6 == NULL) {
+				state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
+					DVS132S_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.imu6 == NULL) {
 				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
 				return;
@@ -1350,83 +1481,63 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 
 						// Pixel 0: Top Left for host-packet-order.
 						if (pres0) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol0);
+							// Received event, timestamp at event-stream insertion point.
 							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, state->dvs.lastY, state->dvs.lastX, pol0,
+									state->timestamps.current);
 							}
 							else {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, state->dvs.lastX, state->dvs.lastY, pol0,
+									state->timestamps.current);
 							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
 							state->currentPackets.polarityPosition++;
 						}
 
 						// Pixel 1: Top Right for host-packet-order.
 						if (pres1) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol1);
+							// Received event, timestamp at event-stream insertion point.
 							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, state->dvs.lastY,
+									U16T(state->dvs.lastX + 1), pol1, state->timestamps.current);
 							}
 							else {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, U16T(state->dvs.lastX + 1),
+									state->dvs.lastY, pol1, state->timestamps.current);
 							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
 							state->currentPackets.polarityPosition++;
 						}
 
 						if (pres2) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol2);
+							// Received event, timestamp at event-stream insertion point.
 							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, U16T(state->dvs.lastY + 1),
+									state->dvs.lastX, pol2, state->timestamps.current);
 							}
 							else {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, state->dvs.lastX,
+									U16T(state->dvs.lastY + 1), pol2, state->timestamps.current);
 							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
 							state->currentPackets.polarityPosition++;
 						}
 
 						if (pres3) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol3);
+							// Received event, timestamp at event-stream insertion point.
 							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, U16T(state->dvs.lastY + 1),
+									U16T(state->dvs.lastX + 1), pol3, state->timestamps.current);
 							}
 							else {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
+								polarityGroupEventStore(state->currentPackets.polarity,
+									state->currentPackets.polarityPosition, U16T(state->dvs.lastX + 1),
+									U16T(state->dvs.lastY + 1), pol3, state->timestamps.current);
 							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
 							state->currentPackets.polarityPosition++;
 						}
 					}
@@ -1632,56 +1743,20 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && dvs132sIsTypeCommitDue(state);
+
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			if (state->currentPackets.imu6Position > 0) {
-				containerGenerationSetPacket(
-					&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
-
-				state->currentPackets.imu6         = NULL;
-				state->currentPackets.imu6Position = 0;
-				emptyContainerCommit               = false;
-			}
-
-			if (tsReset || tsBigWrap) {
-				// Ignore all IMU6 (composite) events, until a new IMU6
-				// Start event comes in, for the next packet.
-				// This is to correctly support the forced packet commits that a TS reset,
-				// or a TS big wrap, impose. Continuing to parse events would result
-				// in a corrupted state of the first event in the new packet, as it would
-				// be incomplete, incorrect and miss vital initialization data.
-				// See IMU6 END states for more details on a related issue.
-				state->imu.ignoreEvents = true;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			dvs132sContainerCommit(handle, tsReset, tsBigWrap);
 		}
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		dvs132sContainerCommit(handle, false, false);
+	}
 }
 
 static void dvs132sTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param) {
@@ -6,6 +6,7 @@
 
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 #include "usb_utils.h"
 
 #define IMU_TYPE_TEMP   0x01
@@ -119,5 +120,7 @@ bool dvs132sDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *
 	void *dataShutdownUserPtr);
 bool dvs132sDataStop(caerDeviceHandle handle);
 caerEventPacketContainer dvs132sDataGet(caerDeviceHandle handle);
+size_t dvs132sDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+void dvs132sDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DVS132S_H_ */
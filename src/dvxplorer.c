@@ -5,9 +5,12 @@
 static void dvXplorerLog(enum caer_log_level logLevel, dvXplorerHandle handle, const char *format, ...)
 	ATTRIBUTE_FORMAT(3);
 static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent);
+static void dvXplorerContainerCommit(dvXplorerHandle handle, bool tsReset, bool tsBigWrap);
+static caerEventPacketHeader dvXplorerRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity);
 static void dvXplorerTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param);
 static void resetParser(dvXplorerHandle handle, const char *reason);
 static void mipiCx3EventTranslator(void *vhd, const uint8_t *buffer, const size_t bufferSize);
+static void mipiCx3ContainerCommit(dvXplorerHandle handle, bool tsReset);
 
 // FX3 Debug Transfer Support
 static void allocateDebugTransfers(dvXplorerHandle handle);
@@ -124,21 +127,21 @@ static inline void freeAllDataMemory(dvXplorerState state) {
 	// already assigned to the current packet container, we
 	// free them separately from it.
 	if (state->currentPackets.polarity != NULL) {
-		free(state->currentPackets.polarity);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.polarity);
 		state->currentPackets.polarity = NULL;
 
 		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
 	}
 
 	if (state->currentPackets.special != NULL) {
-		free(state->currentPackets.special);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
 		state->currentPackets.special = NULL;
 
 		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
 	}
 
 	if (state->currentPackets.imu6 != NULL) {
-		free(state->currentPackets.imu6);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.imu6);
 		state->currentPackets.imu6 = NULL;
 
 		containerGenerationSetPacket(&state->container, IMU6_EVENT_PKT_POS, NULL);
@@ -249,6 +252,8 @@ caerDeviceHandle dvXplorerOpen(
 		usbSetDataCallback(&state->usbState, &dvXplorerEventTranslator, handle);
 	}
 
+	usbSetRawDataCallback(&state->usbState, &dvXplorerRawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
 	usbSetDataEndpoint(&state->usbState, USB_DEFAULT_DATA_ENDPOINT);
 	usbSetTransfersNumber(&state->usbState, 8);
 	usbSetTransfersSize(&state->usbState, 8192);
@@ -392,6 +397,164 @@ bool dvXplorerClose(caerDeviceHandle cdh) {
 	return (true);
 }
 
+// Device state needed by the translators, saved with raw recordings.
+static void recordFieldsGet(dvXplorerHandle handle, struct usb_record_field fields[DVXPLORER_RECORD_FIELDS]) {
+	struct caer_dvx_info *info = &handle->info;
+	dvXplorerState state       = &handle->state;
+
+	fields[0]  = USB_RECORD_FIELD(info->deviceID, USB_RECORD_INT16);
+	fields[1]  = USB_RECORD_FIELD(info->deviceSerialNumber, USB_RECORD_STRING);
+	fields[2]  = USB_RECORD_FIELD(info->deviceUSBBusNumber, USB_RECORD_UINT8);
+	fields[3]  = USB_RECORD_FIELD(info->deviceUSBDeviceAddress, USB_RECORD_UINT8);
+	fields[4]  = USB_RECORD_FIELD(info->firmwareVersion, USB_RECORD_INT16);
+	fields[5]  = USB_RECORD_FIELD(info->logicVersion, USB_RECORD_INT16);
+	fields[6]  = USB_RECORD_FIELD(info->chipID, USB_RECORD_INT16);
+	fields[7]  = USB_RECORD_FIELD(info->deviceIsMaster, USB_RECORD_BOOL);
+	fields[8]  = USB_RECORD_FIELD(info->muxHasStatistics, USB_RECORD_BOOL);
+	fields[9]  = USB_RECORD_FIELD(info->dvsSizeX, USB_RECORD_INT16);
+	fields[10] = USB_RECORD_FIELD(info->dvsSizeY, USB_RECORD_INT16);
+	fields[11] = USB_RECORD_FIELD(info->dvsHasStatistics, USB_RECORD_BOOL);
+	fields[12] = USB_RECORD_FIELD(info->imuType, USB_RECORD_ENUM);
+	fields[13] = USB_RECORD_FIELD(info->extInputHasGenerator, USB_RECORD_BOOL);
+	fields[14] = USB_RECORD_FIELD(state->isMipiCX3Device, USB_RECORD_BOOL);
+	fields[15] = USB_RECORD_FIELD(state->timestamps.wrapOverflow, USB_RECORD_INT32);
+	fields[16] = USB_RECORD_FIELD(state->timestamps.wrapAdd, USB_RECORD_INT32);
+	fields[17] = USB_RECORD_FIELD(state->timestamps.last, USB_RECORD_INT32);
+	fields[18] = USB_RECORD_FIELD(state->timestamps.current, USB_RECORD_INT32);
+	fields[19] = USB_RECORD_FIELD(state->timestampsMIPI.reference, USB_RECORD_INT64);
+	fields[20] = USB_RECORD_FIELD(state->timestampsMIPI.referenceOverflow, USB_RECORD_INT64);
+	fields[21] = USB_RECORD_FIELD(state->timestampsMIPI.lastReference, USB_RECORD_INT32);
+	fields[22] = USB_RECORD_FIELD(state->timestampsMIPI.lastUsedSub, USB_RECORD_INT32);
+	fields[23] = USB_RECORD_FIELD(state->timestampsMIPI.lastUsedReference, USB_RECORD_INT64);
+	fields[24] = USB_RECORD_FIELD(state->timestampsMIPI.currTimestamp, USB_RECORD_INT64);
+	fields[25] = USB_RECORD_FIELD(state->timestampsMIPI.lastTimestamp, USB_RECORD_INT64);
+	fields[26] = USB_RECORD_FIELD(state->dvs.lastX, USB_RECORD_UINT16);
+	fields[27] = USB_RECORD_FIELD(state->dvs.lastYG1, USB_RECORD_UINT16);
+	fields[28] = USB_RECORD_FIELD(state->dvs.lastYG2, USB_RECORD_UINT16);
+	fields[29] = USB_RECORD_FIELD(state->dvs.sizeX, USB_RECORD_INT16);
+	fields[30] = USB_RECORD_FIELD(state->dvs.sizeY, USB_RECORD_INT16);
+	fields[31] = USB_RECORD_FIELD(state->dvs.flipX, USB_RECORD_BOOL);
+	fields[32] = USB_RECORD_FIELD(state->dvs.flipY, USB_RECORD_BOOL);
+	fields[33] = USB_RECORD_FIELD(state->dvs.invertXY, USB_RECORD_BOOL);
+	fields[34] = USB_RECORD_FIELD(state->dvs.cropperYStart, USB_RECORD_UINT16);
+	fields[35] = USB_RECORD_FIELD(state->dvs.cropperYEnd, USB_RECORD_UINT16);
+	fields[36] = USB_RECORD_FIELD(state->dvs.dualBinning, USB_RECORD_BOOL);
+	fields[37] = USB_RECORD_FIELD(state->dvs.lastColumn, USB_RECORD_INT16);
+	fields[38] = USB_RECORD_FIELD(state->imu.ignoreEvents, USB_RECORD_BOOL);
+	fields[39] = USB_RECORD_FIELD(state->imu.flipX, USB_RECORD_BOOL);
+	fields[40] = USB_RECORD_FIELD(state->imu.flipY, USB_RECORD_BOOL);
+	fields[41] = USB_RECORD_FIELD(state->imu.flipZ, USB_RECORD_BOOL);
+	fields[42] = USB_RECORD_FIELD(state->imu.type, USB_RECORD_UINT8);
+	fields[43] = USB_RECORD_FIELD(state->imu.count, USB_RECORD_UINT8);
+	fields[44] = USB_RECORD_FIELD(state->imu.tmpData, USB_RECORD_UINT8);
+	fields[45] = USB_RECORD_FIELD(state->imu.accelScale, USB_RECORD_FLOAT);
+	fields[46] = USB_RECORD_FIELD(state->imu.gyroScale, USB_RECORD_FLOAT);
+	fields[47] = USB_RECORD_FIELD(state->deviceClocks.logicClock, USB_RECORD_UINT16);
+	fields[48] = USB_RECORD_FIELD(state->deviceClocks.usbClock, USB_RECORD_UINT16);
+	fields[49] = USB_RECORD_FIELD(state->deviceClocks.clockDeviationFactor, USB_RECORD_UINT16);
+	fields[50] = USB_RECORD_FIELD(state->deviceClocks.logicClockActual, USB_RECORD_FLOAT);
+	fields[51] = USB_RECORD_FIELD(state->deviceClocks.usbClockActual, USB_RECORD_FLOAT);
+}
+
+caerDeviceHandle dvXplorerReplayOpen(uint16_t deviceID, const char *filePath, bool maxSpeed) {
+	errno = 0;
+
+	caerLog(CAER_LOG_DEBUG, __func__, "Initializing %s replay.", DVXPLORER_DEVICE_NAME);
+
+	dvXplorerHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		// Failed to allocate memory for device handle!
+		caerLog(CAER_LOG_CRITICAL, __func__, "Failed to allocate memory for device handle.");
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	// Set main deviceType correctly right away.
+	handle->deviceType = CAER_DEVICE_DVXPLORER;
+
+	dvXplorerState state = &handle->state;
+
+	// Initialize state variables to default values (if not zero, taken care of by calloc above).
+	dataExchangeSettingsInit(&state->dataExchange);
+
+	// Replay must not drop data, to reproduce the recorded output exactly.
+	atomic_store(&state->dataExchange.dropPolicy, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER);
+
+	// Packet settings (size (in events) and time interval (in µs)).
+	containerGenerationSettingsInit(&state->container);
+
+	// Logging settings (initialize to global log-level).
+	enum caer_log_level globalLogLevel = caerLogLevelGet();
+	atomic_store(&state->deviceLogLevel, globalLogLevel);
+	usbSetLogLevel(&state->usbState, globalLogLevel);
+
+	// Set device thread name. Maximum length of 15 chars due to Linux limitations.
+	char usbThreadName[MAX_THREAD_NAME_LENGTH + 1];
+	snprintf(usbThreadName, MAX_THREAD_NAME_LENGTH + 1, "%s %" PRIu16, DVXPLORER_DEVICE_NAME, deviceID);
+	usbThreadName[MAX_THREAD_NAME_LENGTH] = '\0';
+
+	usbSetThreadName(&state->usbState, usbThreadName);
+
+	// Restore recorded info and translator state.
+	struct usb_record_field fields[DVXPLORER_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	bool replayOpened = usbReplayOpen(
+		&state->usbState, filePath, maxSpeed, CAER_DEVICE_DVXPLORER, fields, DVXPLORER_RECORD_FIELDS);
+
+	handle->info.deviceString = usbThreadName; // Temporary, until replaced by full string.
+
+	if (!replayOpened) {
+		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to open replay, see above log message for more information.");
+
+		free(handle);
+
+		// errno set by usbReplayOpen().
+		return (NULL);
+	}
+
+	char *replayInfoString = malloc(USB_INFO_STRING_SIZE);
+	if (replayInfoString == NULL) {
+		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to generate replay information string.");
+
+		usbDeviceClose(&state->usbState);
+		free(handle);
+
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	snprintf(replayInfoString, USB_INFO_STRING_SIZE, DVXPLORER_DEVICE_NAME " ID-%" PRIu16 " SN-%s [replay]", deviceID,
+		handle->info.deviceSerialNumber);
+
+	handle->info.deviceID     = I16T(deviceID);
+	handle->info.deviceString = replayInfoString;
+
+	// Setup replay, same translators as USB.
+	if (handle->state.isMipiCX3Device) {
+		usbSetDataCallback(&state->usbState, &mipiCx3EventTranslator, handle);
+	}
+	else {
+		usbSetDataCallback(&state->usbState, &dvXplorerEventTranslator, handle);
+	}
+
+	usbSetRawDataCallback(&state->usbState, &dvXplorerRawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
+
+	dvXplorerLog(CAER_LOG_DEBUG, handle, "Initialized replay of '%s' successfully.", filePath);
+
+	return ((caerDeviceHandle) handle);
+}
+
+bool dvXplorerRawRecordStart(caerDeviceHandle cdh, const char *filePath) {
+	dvXplorerHandle handle = (dvXplorerHandle) cdh;
+
+	struct usb_record_field fields[DVXPLORER_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	return (usbRecordStart(&handle->state.usbState, filePath, handle->deviceType, fields, DVXPLORER_RECORD_FIELDS));
+}
+
 struct caer_dvx_info caerDVXplorerInfoGet(caerDeviceHandle cdh) {
 	dvXplorerHandle handle = (dvXplorerHandle) cdh;
 
@@ -548,6 +711,10 @@ bool dvXplorerConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr,
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigSet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1485,6 +1652,10 @@ bool dvXplorerConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr,
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigGet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -2413,6 +2584,15 @@ bool dvXplorerDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *p
 		return (false);
 	}
 
+	if (!containerGenerationPoolInit(&state->container)) {
+		freeAllDataMemory(state);
+
+		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to initialize packet container recycling pool.");
+		return (false);
+	}
+
+	containerGenerationPolaritySizeInit(&state->container, DVXPLORER_POLARITY_DEFAULT_SIZE);
+
 	// Allocate packets.
 	if (!containerGenerationAllocate(&state->container, DVXPLORER_EVENT_TYPES)) {
 		freeAllDataMemory(state);
@@ -2453,25 +2633,36 @@ bool dvXplorerDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *p
 	// the first one is observed.
 	state->imu.ignoreEvents = true;
 
-	// Ensure no data is left over from previous runs, if the camera
-	// wasn't shut-down properly. First ensure it is shut down completely.
-	dvXplorerConfigSet(cdh, DVX_DVS, DVX_DVS_RUN, false);
-	dvXplorerConfigSet(cdh, DVX_IMU, DVX_IMU_RUN_ACCELEROMETER, false);
-	dvXplorerConfigSet(cdh, DVX_IMU, DVX_IMU_RUN_GYROSCOPE, false);
-	dvXplorerConfigSet(cdh, DVX_IMU, DVX_IMU_RUN_TEMPERATURE, false);
-	dvXplorerConfigSet(cdh, DVX_EXTINPUT, DVX_EXTINPUT_RUN_DETECTOR, false);
+	// A replay has no device to configure, the data comes from the recording.
+	if (!usbIsReplay(&state->usbState)) {
+		// Ensure no data is left over from previous runs, if the camera
+		// wasn't shut-down properly. First ensure it is shut down completely.
+		dvXplorerConfigSet(cdh, DVX_DVS, DVX_DVS_RUN, false);
+		dvXplorerConfigSet(cdh, DVX_IMU, DVX_IMU_RUN_ACCELEROMETER, false);
+		dvXplorerConfigSet(cdh, DVX_IMU, DVX_IMU_RUN_GYROSCOPE, false);
+		dvXplorerConfigSet(cdh, DVX_IMU, DVX_IMU_RUN_TEMPERATURE, false);
+		dvXplorerConfigSet(cdh, DVX_EXTINPUT, DVX_EXTINPUT_RUN_DETECTOR, false);
 
-	if (!handle->state.isMipiCX3Device) {
-		dvXplorerConfigSet(cdh, DVX_MUX, DVX_MUX_RUN, false);
-		dvXplorerConfigSet(cdh, DVX_MUX, DVX_MUX_TIMESTAMP_RUN, false);
-		dvXplorerConfigSet(cdh, DVX_USB, DVX_USB_RUN, false);
+		if (!handle->state.isMipiCX3Device) {
+			dvXplorerConfigSet(cdh, DVX_MUX, DVX_MUX_RUN, false);
+			dvXplorerConfigSet(cdh, DVX_MUX, DVX_MUX_TIMESTAMP_RUN, false);
+			dvXplorerConfigSet(cdh, DVX_USB, DVX_USB_RUN, false);
+		}
+
+		// Then wait 10ms for FPGA device side buffers to clear.
+		thrd_sleep(10000);
+
+		// And reset the USB side of things.
+		usbControlResetDataEndpoint(&state->usbState, USB_DEFAULT_DATA_ENDPOINT);
 	}
 
-	// Then wait 10ms for FPGA device side buffers to clear.
-	thrd_sleep(10000);
+	if (usbRawDataIsEnabled(&state->usbState)) {
+		containerGenerationRawDataPoolFill(
+			&state->container, I32T(usbGetTransfersSize(&state->usbState)), handle->info.deviceID);
+	}
 
-	// And reset the USB side of things.
-	usbControlResetDataEndpoint(&state->usbState, USB_DEFAULT_DATA_ENDPOINT);
+	// The decode thread, if any, gets the same back-pressure as the data exchange.
+	usbSetDecodeQueueBlocking(&state->usbState, dataExchangeBlocksProducer(&state->dataExchange));
 
 	if (!usbDataTransfersStart(&state->usbState)) {
 		freeAllDataMemory(state);
@@ -2480,7 +2671,7 @@ bool dvXplorerDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *p
 		return (false);
 	}
 
-	if (dataExchangeStartProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&state->usbState) && dataExchangeStartProducers(&state->dataExchange)) {
 		if (!handle->state.isMipiCX3Device) {
 			// Enable data transfer on USB end-point 2.
 			dvXplorerConfigSet(cdh, DVX_USB, DVX_USB_RUN, true);
@@ -2510,7 +2701,7 @@ bool dvXplorerDataStop(caerDeviceHandle cdh) {
 	dvXplorerHandle handle = (dvXplorerHandle) cdh;
 	dvXplorerState state   = &handle->state;
 
-	if (dataExchangeStopProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&state->usbState) && dataExchangeStopProducers(&state->dataExchange)) {
 		// Disable streaming from DVS chip.
 		dvXplorerConfigSet(cdh, DVX_DVS_CHIP, DVX_DVS_CHIP_MODE, DVX_DVS_CHIP_MODE_OFF);
 
@@ -2553,6 +2744,28 @@ caerEventPacketContainer dvXplorerDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dvXplorerDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	dvXplorerHandle handle = (dvXplorerHandle) cdh;
+	dvXplorerState state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, maxContainers));
+}
+
+void dvXplorerDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dvXplorerHandle handle = (dvXplorerHandle) cdh;
+	dvXplorerState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
+static caerEventPacketHeader dvXplorerRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity) {
+	dvXplorerHandle handle = vhd;
+	dvXplorerState state   = &handle->state;
+
+	return (containerGenerationRawDataExchange(&state->container, packet, capacity, &state->dataExchange,
+		&state->usbState.dataTransfersRun, handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel));
+}
+
 #define TS_WRAP_ADD 0x8000
 
 static inline bool ensureSpaceForEvents(
@@ -2569,10 +2782,80 @@ static inline bool ensureSpaceForEvents(
 		return (false);
 	}
 
+	dataStatisticsIncrease(&handle->state.container.statistics.packetsGrown, 1);
+
 	*packet = grownPacket;
 	return (true);
 }
 
+// Per-event-type commit triggers, see containerGenerationIsTypeCommitDue().
+static inline bool dvXplorerIsTypeCommitDue(dvXplorerState state) {
+	containerGeneration container = &state->container;
+	int64_t timestamp             = generateFullTimestamp(state->timestamps.wrapOverflow, state->timestamps.current);
+
+	return (containerGenerationIsTypeCommitDue(
+				container, SPECIAL_EVENT, state->currentPackets.specialPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, POLARITY_EVENT, state->currentPackets.polarityPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, IMU6_EVENT, state->currentPackets.imu6Position, timestamp));
+}
+
+static void dvXplorerContainerCommit(dvXplorerHandle handle, bool tsReset, bool tsBigWrap) {
+	dvXplorerState state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	// Track how many polarity events go into a container, to pre-size the next packet.
+	containerGenerationPolaritySizeUpdate(&state->container, state->currentPackets.polarityPosition);
+
+	if (state->currentPackets.polarityPosition > 0) {
+		polarityGroupCountersCommit(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+		containerGenerationSetPacket(
+			&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+		state->currentPackets.polarity         = NULL;
+		state->currentPackets.polarityPosition = 0;
+		emptyContainerCommit                   = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	if (state->currentPackets.imu6Position > 0) {
+		containerGenerationSetPacket(
+			&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
+
+		state->currentPackets.imu6         = NULL;
+		state->currentPackets.imu6Position = 0;
+		emptyContainerCommit               = false;
+	}
+
+	if (tsReset || tsBigWrap) {
+		// Ignore all IMU6 (composite) events, until a new IMU6
+		// Start event comes in, for the next packet.
+		// This is to correctly support the forced packet commits that a TS reset,
+		// or a TS big wrap, impose. Continuing to parse events would result
+		// in a corrupted state of the first event in the new packet, as it would
+		// be incomplete, incorrect and miss vital initialization data.
+		// See IMU6 END states for more details on a related issue.
+		state->imu.ignoreEvents = true;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
+		handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+}
+
 static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bufferSize) {
 	dvXplorerHandle handle = vhd;
 	dvXplorerState state   = &handle->state;
@@ -2599,8 +2882,13 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVXPLORER_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, DVXPLORER_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					DVXPLORER_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -2608,8 +2896,15 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 		}
 
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVXPLORER_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			int32_t polaritySize = containerGenerationPolaritySizePredict(&state->container);
+
+			state->currentPackets.polarity = (caerPolarityEventPacket) containerGenerationPacketReuse(
+				&state->container, POLARITY_EVENT, POLARITY_EVENT, polaritySize, state->timestamps.wrapOverflow);
+			if (state->currentPackets.polarity == NULL) {
+				state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+					polaritySize, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.polarity == NULL) {
 				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
 				return;
@@ -2617,8 +2912,13 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 		}
 
 		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.imu6 = (caerIMU6EventPacket) containerGenerationPacketReuse(&state->container,
+				IMU6_EVENT_PKT_POS, IMU6_EVENT, DVXPLORER_IMU_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.imu6 == NULL) {
+				state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
+					DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.imu6 == NULL) {
 				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
 				return;
@@ -2839,48 +3139,57 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 				case 2:
 				case 3: { // 8-pixel group event presence and polarity.
 						  // Code 2 is MGROUP Group 2 (SGROUP OFF), Code 3 is MGROUP Group 1 (SGROUP ON).
-					if (!ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
-							(size_t) state->currentPackets.polarityPosition, 8, handle)) {
-						break;
-					}
-
-					bool polarity  = ((data & 0x0100) == 0);
-					uint16_t lastY = (code == 3) ? (state->dvs.lastYG1) : (state->dvs.lastYG2);
+					bool polarity    = ((data & 0x0100) == 0);
+					uint8_t presence = U8T(data & 0x00FF);
+					uint16_t lastY   = (code == 3) ? (state->dvs.lastYG1) : (state->dvs.lastYG2);
+					uint16_t xAddr   = state->dvs.lastX;
+
+					// With dual binning and flip, pixels from index 'flipSplit' on fall into
+					// the upper half of the Y axis and have to be moved down by 'yFlip'.
+					uint16_t yFlip     = 0;
+					uint16_t flipSplit = 8;
+
+					if (state->dvs.dualBinning) {
+						uint16_t halfX = U16T(state->dvs.sizeX / 2);
+						uint16_t halfY = U16T(state->dvs.sizeY / 2);
+
+						if (state->dvs.flipX && (xAddr >= halfX)) {
+							xAddr -= halfX;
+						}
 
-					for (uint16_t i = 0, mask = 0x0001; i < 8; i++, mask <<= 1) {
-						// Check if event present first.
-						if ((data & mask) == 0) {
-							continue;
+						if (state->dvs.flipY && ((lastY + 7) >= halfY)) {
+							yFlip     = halfY;
+							flipSplit = (lastY >= halfY) ? (0) : U16T(halfY - lastY);
 						}
+					}
 
-						uint16_t xAddr = state->dvs.lastX;
-						uint16_t yAddr = lastY + i;
+					// A group split in two needs space for two full expansions.
+					bool split = (flipSplit > 0) && (flipSplit < 8);
 
-						if (state->dvs.dualBinning) {
-							if (state->dvs.flipX && (xAddr >= U16T(state->dvs.sizeX / 2))) {
-								xAddr -= U16T(state->dvs.sizeX / 2);
-							}
+					if (!ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
+							(size_t) state->currentPackets.polarityPosition, (split) ? (16) : (8), handle)) {
+						break;
+					}
 
-							if (state->dvs.flipY && (yAddr >= U16T(state->dvs.sizeY / 2))) {
-								yAddr -= U16T(state->dvs.sizeY / 2);
-							}
-						}
+					const uint32_t pixelStep = polarityGroupPixelStep(state->dvs.invertXY);
 
-						if (state->dvs.invertXY) {
-							SWAP_VAR(uint16_t, xAddr, yAddr);
-						}
+					if (flipSplit > 0) {
+						uint32_t firstData = (state->dvs.invertXY) ? (polarityGroupEventData(lastY, xAddr, polarity))
+																   : (polarityGroupEventData(xAddr, lastY, polarity));
+
+						state->currentPackets.polarityPosition += polarityGroupExpand(state->currentPackets.polarity,
+							state->currentPackets.polarityPosition, U8T(presence & ((1U << flipSplit) - 1)), firstData,
+							pixelStep, state->timestamps.current);
+					}
 
-						// Received event!
-						caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-							state->currentPackets.polarity, state->currentPackets.polarityPosition);
+					if (flipSplit < 8) {
+						uint16_t yAddr     = U16T(lastY + flipSplit - yFlip);
+						uint32_t firstData = (state->dvs.invertXY) ? (polarityGroupEventData(yAddr, xAddr, polarity))
+																   : (polarityGroupEventData(xAddr, yAddr, polarity));
 
-						// Timestamp at event-stream insertion point.
-						caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-						caerPolarityEventSetPolarity(currentPolarityEvent, polarity);
-						caerPolarityEventSetX(currentPolarityEvent, xAddr);
-						caerPolarityEventSetY(currentPolarityEvent, yAddr);
-						caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-						state->currentPackets.polarityPosition++;
+						state->currentPackets.polarityPosition += polarityGroupExpand(state->currentPackets.polarity,
+							state->currentPackets.polarityPosition, U8T(presence >> flipSplit), firstData, pixelStep,
+							state->timestamps.current);
 					}
 
 					break;
@@ -3121,56 +3430,20 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && dvXplorerIsTypeCommitDue(state);
+
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			if (state->currentPackets.imu6Position > 0) {
-				containerGenerationSetPacket(
-					&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
-
-				state->currentPackets.imu6         = NULL;
-				state->currentPackets.imu6Position = 0;
-				emptyContainerCommit               = false;
-			}
-
-			if (tsReset || tsBigWrap) {
-				// Ignore all IMU6 (composite) events, until a new IMU6
-				// Start event comes in, for the next packet.
-				// This is to correctly support the forced packet commits that a TS reset,
-				// or a TS big wrap, impose. Continuing to parse events would result
-				// in a corrupted state of the first event in the new packet, as it would
-				// be incomplete, incorrect and miss vital initialization data.
-				// See IMU6 END states for more details on a related issue.
-				state->imu.ignoreEvents = true;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			dvXplorerContainerCommit(handle, tsReset, tsBigWrap);
 		}
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		dvXplorerContainerCommit(handle, false, false);
+	}
 }
 
 static void dvXplorerTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param) {
@@ -3199,6 +3472,50 @@ static void resetParser(dvXplorerHandle handle, const char *reason) {
 	dvXplorerLog(CAER_LOG_INFO, handle, "Parser reset, reason: %s.", reason);
 }
 
+static void mipiCx3ContainerCommit(dvXplorerHandle handle, bool tsReset) {
+	dvXplorerState state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	// Track how many polarity events go into a container, to pre-size the next packet.
+	containerGenerationPolaritySizeUpdate(&state->container, state->currentPackets.polarityPosition);
+
+	if (state->currentPackets.polarityPosition > 0) {
+		polarityGroupCountersCommit(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+		containerGenerationSetPacket(
+			&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+		state->currentPackets.polarity         = NULL;
+		state->currentPackets.polarityPosition = 0;
+		emptyContainerCommit                   = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	if (state->currentPackets.imu6Position > 0) {
+		containerGenerationSetPacket(
+			&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
+
+		state->currentPackets.imu6         = NULL;
+		state->currentPackets.imu6Position = 0;
+		emptyContainerCommit               = false;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
+		handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+}
+
 static void mipiCx3EventTranslator(void *vhd, const uint8_t *buffer, const size_t bufferSize) {
 	dvXplorerHandle handle = vhd;
 	dvXplorerState state   = &handle->state;
@@ -3233,8 +3550,13 @@ static void mipiCx3EventTranslator(void *vhd, const uint8_t *buffer, const size_
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVXPLORER_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, DVXPLORER_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					DVXPLORER_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -3242,8 +3564,15 @@ static void mipiCx3EventTranslator(void *vhd, const uint8_t *buffer, const size_
 		}
 
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVXPLORER_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			int32_t polaritySize = containerGenerationPolaritySizePredict(&state->container);
+
+			state->currentPackets.polarity = (caerPolarityEventPacket) containerGenerationPacketReuse(
+				&state->container, POLARITY_EVENT, POLARITY_EVENT, polaritySize, state->timestamps.wrapOverflow);
+			if (state->currentPackets.polarity == NULL) {
+				state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+					polaritySize, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.polarity == NULL) {
 				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
 				return;
@@ -3251,8 +3580,13 @@ static void mipiCx3EventTranslator(void *vhd, const uint8_t *buffer, const size_
 		}
 
 		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.imu6 = (caerIMU6EventPacket) containerGenerationPacketReuse(&state->container,
+				IMU6_EVENT_PKT_POS, IMU6_EVENT, DVXPLORER_IMU_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.imu6 == NULL) {
+				state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
+					DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.imu6 == NULL) {
 				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
 				return;
@@ -3300,49 +3634,16 @@ static void mipiCx3EventTranslator(void *vhd, const uint8_t *buffer, const size_
 				continue;
 			}
 
-			const uint8_t group1Events = (event >> 0) & 0x00FF;
-			const bool group1Polarity  = (((event >> 16) & 0x01) == 0); // ON polarity is 0 here.
-
-			for (uint8_t i = 0, mask = 0x01; i < 8; i++, mask <<= 1) {
-				// Check if event present first.
-				if ((group1Events & mask) == 0) {
-					continue;
-				}
-
-				// Received event!
-				caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-					state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-				// Timestamp at event-stream insertion point.
-				caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-				caerPolarityEventSetPolarity(currentPolarityEvent, group1Polarity);
-				caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastColumn));
-				caerPolarityEventSetY(currentPolarityEvent, U16T(group1Address + i));
-				caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-				state->currentPackets.polarityPosition++;
-			}
-
-			const uint8_t group2Events = (event >> 8) & 0x00FF;
-			const bool group2Polarity  = (((event >> 17) & 0x01) == 0); // ON polarity is 0 here.
-
-			for (uint8_t i = 0, mask = 0x01; i < 8; i++, mask <<= 1) {
-				// Check if event present first.
-				if ((group2Events & mask) == 0) {
-					continue;
-				}
+			// Bits 15-0 hold the presence masks of both groups, bits 17-16 their polarities.
+			const uint16_t groupsEvents = event & 0xFFFF;
+			const bool group1Polarity   = (((event >> 16) & 0x01) == 0); // ON polarity is 0 here.
+			const bool group2Polarity   = (((event >> 17) & 0x01) == 0);
 
-				// Received event!
-				caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-					state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-				// Timestamp at event-stream insertion point.
-				caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-				caerPolarityEventSetPolarity(currentPolarityEvent, group2Polarity);
-				caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastColumn));
-				caerPolarityEventSetY(currentPolarityEvent, U16T(group2Address + i));
-				caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-				state->currentPackets.polarityPosition++;
-			}
+			state->currentPackets.polarityPosition += polarityGroupPairExpand(state->currentPackets.polarity,
+				state->currentPackets.polarityPosition, groupsEvents,
+				polarityGroupEventData(U16T(state->dvs.lastColumn), U16T(group1Address), group1Polarity),
+				polarityGroupEventData(U16T(state->dvs.lastColumn), U16T(group2Address), group2Polarity),
+				polarityGroupPixelStep(false), state->timestamps.current);
 		}
 		else {
 			// COLUMN event.
@@ -3472,45 +3773,20 @@ static void mipiCx3EventTranslator(void *vhd, const uint8_t *buffer, const size_
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && dvXplorerIsTypeCommitDue(state);
+
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			if (state->currentPackets.imu6Position > 0) {
-				containerGenerationSetPacket(
-					&state->container, IMU6_EVENT_PKT_POS, (caerEventPacketHeader) state->currentPackets.imu6);
-
-				state->currentPackets.imu6         = NULL;
-				state->currentPackets.imu6Position = 0;
-				emptyContainerCommit               = false;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			mipiCx3ContainerCommit(handle, tsReset);
 		}
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		mipiCx3ContainerCommit(handle, false);
+	}
 }
 
 //////////////////////////////////
@@ -6,6 +6,7 @@
 
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 #include "usb_utils.h"
 
 #define IMU_TYPE_TEMP   0x01
@@ -22,6 +23,8 @@
 
 #define DVXPLORER_DEVICE_NAME "DVXplorer"
 
+#define DVXPLORER_RECORD_FIELDS 52
+
 #define DVXPLORER_DEVICE_PID                 0x8419
 #define DVXPLORER_REQUIRED_LOGIC_VERSION     18
 #define DVXPLORER_REQUIRED_LOGIC_PATCH_LEVEL 2
@@ -210,6 +213,9 @@ caerDeviceHandle dvXplorerOpen(
 	uint16_t deviceID, uint8_t busNumberRestrict, uint8_t devAddressRestrict, const char *serialNumberRestrict);
 bool dvXplorerClose(caerDeviceHandle cdh);
 
+caerDeviceHandle dvXplorerReplayOpen(uint16_t deviceID, const char *filePath, bool maxSpeed);
+bool dvXplorerRawRecordStart(caerDeviceHandle cdh, const char *filePath);
+
 bool dvXplorerSendDefaultConfig(caerDeviceHandle cdh);
 // Negative addresses are used for host-side configuration.
 // Positive addresses (including zero) are used for device-side configuration.
@@ -221,5 +227,7 @@ bool dvXplorerDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void
 	void *dataShutdownUserPtr);
 bool dvXplorerDataStop(caerDeviceHandle handle);
 caerEventPacketContainer dvXplorerDataGet(caerDeviceHandle handle);
+size_t dvXplorerDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+void dvXplorerDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DVXPLORER_H_ */
@@ -3,6 +3,8 @@
 static void dynapseLog(enum caer_log_level logLevel, dynapseHandle handle, const char *format, ...) ATTRIBUTE_FORMAT(3);
 static bool sendUSBCommandVerifyMultiple(dynapseHandle handle, uint8_t *config, size_t configNum);
 static void dynapseEventTranslator(void *vdh, const uint8_t *buffer, size_t bytesSent);
+static void dynapseContainerCommit(dynapseHandle handle, bool tsReset);
+static caerEventPacketHeader dynapseRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity);
 static void setSilentBiases(caerDeviceHandle cdh, uint8_t chipId);
 static void setLowPowerBiases(caerDeviceHandle cdh, uint8_t chipId);
 
@@ -251,14 +253,14 @@ static inline void freeAllDataMemory(dynapseState state) {
 	// already assigned to the current packet container, we
 	// free them separately from it.
 	if (state->currentPackets.spike != NULL) {
-		free(state->currentPackets.spike);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.spike);
 		state->currentPackets.spike = NULL;
 
 		containerGenerationSetPacket(&state->container, DYNAPSE_SPIKE_EVENT_POS, NULL);
 	}
 
 	if (state->currentPackets.special != NULL) {
-		free(state->currentPackets.special);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
 		state->currentPackets.special = NULL;
 
 		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
@@ -345,6 +347,8 @@ caerDeviceHandle dynapseOpen(
 
 	// Setup USB.
 	usbSetDataCallback(&state->usbState, &dynapseEventTranslator, handle);
+	usbSetRawDataCallback(&state->usbState, &dynapseRawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
 	usbSetDataEndpoint(&state->usbState, USB_DEFAULT_DATA_ENDPOINT);
 	usbSetTransfersNumber(&state->usbState, 8);
 	usbSetTransfersSize(&state->usbState, 8192);
@@ -760,6 +764,10 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigSet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1105,6 +1113,10 @@ bool dynapseConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigGet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1309,6 +1321,13 @@ bool dynapseDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
+	if (!containerGenerationPoolInit(&state->container)) {
+		freeAllDataMemory(state);
+
+		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to initialize packet container recycling pool.");
+		return (false);
+	}
+
 	// Allocate packets.
 	if (!containerGenerationAllocate(&state->container, DYNAPSE_EVENT_TYPES)) {
 		freeAllDataMemory(state);
@@ -1335,6 +1354,14 @@ bool dynapseDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
+	if (usbRawDataIsEnabled(&state->usbState)) {
+		containerGenerationRawDataPoolFill(
+			&state->container, I32T(usbGetTransfersSize(&state->usbState)), handle->info.deviceID);
+	}
+
+	// The decode thread, if any, gets the same back-pressure as the data exchange.
+	usbSetDecodeQueueBlocking(&state->usbState, dataExchangeBlocksProducer(&state->dataExchange));
+
 	if (!usbDataTransfersStart(&state->usbState)) {
 		freeAllDataMemory(state);
 
@@ -1391,8 +1418,71 @@ caerEventPacketContainer dynapseDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t dynapseDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+	dynapseState state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, maxContainers));
+}
+
+void dynapseDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+	dynapseState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
+static caerEventPacketHeader dynapseRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity) {
+	dynapseHandle handle = vhd;
+	dynapseState state   = &handle->state;
+
+	return (containerGenerationRawDataExchange(&state->container, packet, capacity, &state->dataExchange,
+		&state->usbState.dataTransfersRun, handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel));
+}
+
 #define TS_WRAP_ADD 0x8000
 
+// Per-event-type commit triggers, see containerGenerationIsTypeCommitDue().
+static inline bool dynapseIsTypeCommitDue(dynapseState state) {
+	containerGeneration container = &state->container;
+	int64_t timestamp             = generateFullTimestamp(state->timestamps.wrapOverflow, state->timestamps.current);
+
+	return (containerGenerationIsTypeCommitDue(
+				container, SPECIAL_EVENT, state->currentPackets.specialPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, SPIKE_EVENT, state->currentPackets.spikePosition, timestamp));
+}
+
+static void dynapseContainerCommit(dynapseHandle handle, bool tsReset) {
+	dynapseState state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	if (state->currentPackets.spikePosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, DYNAPSE_SPIKE_EVENT_POS, (caerEventPacketHeader) state->currentPackets.spike);
+
+		state->currentPackets.spike         = NULL;
+		state->currentPackets.spikePosition = 0;
+		emptyContainerCommit                = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
+		handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+}
+
 static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	dynapseHandle handle = vhd;
 	dynapseState state   = &handle->state;
@@ -1419,8 +1509,13 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 		}
 
 		if (state->currentPackets.spike == NULL) {
-			state->currentPackets.spike = caerSpikeEventPacketAllocate(
-				DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.spike = (caerSpikeEventPacket) containerGenerationPacketReuse(&state->container,
+				DYNAPSE_SPIKE_EVENT_POS, SPIKE_EVENT, DYNAPSE_SPIKE_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.spike == NULL) {
+				state->currentPackets.spike = caerSpikeEventPacketAllocate(
+					DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.spike == NULL) {
 				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate spike event packet.");
 				return;
@@ -1438,11 +1533,18 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 			}
 
 			state->currentPackets.spike = grownPacket;
+
+			dataStatisticsIncrease(&state->container.statistics.packetsGrown, 1);
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DYNAPSE_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, DYNAPSE_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					DYNAPSE_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -1460,6 +1562,8 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 			}
 
 			state->currentPackets.special = grownPacket;
+
+			dataStatisticsIncrease(&state->container.statistics.packetsGrown, 1);
 		}
 
 		bool tsReset   = false;
@@ -1582,36 +1686,20 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && dynapseIsTypeCommitDue(state);
+
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.spikePosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, DYNAPSE_SPIKE_EVENT_POS, (caerEventPacketHeader) state->currentPackets.spike);
-
-				state->currentPackets.spike         = NULL;
-				state->currentPackets.spikePosition = 0;
-				emptyContainerCommit                = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			dynapseContainerCommit(handle, tsReset);
 		}
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		dynapseContainerCommit(handle, false);
+	}
 }
 
 bool caerDynapseSendDataToUSB(caerDeviceHandle cdh, const uint32_t *pointer, size_t numConfig) {
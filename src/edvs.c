@@ -12,7 +12,8 @@ static void edvsLog(enum caer_log_level logLevel, edvsHandle handle, const char
 static bool serialThreadStart(edvsHandle handle);
 static void serialThreadStop(edvsHandle handle);
 static int serialThreadRun(void *handlePtr);
-static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent);
+static void serialThreadSchedulingUpdate(edvsHandle handle, uint32_t *cpuAffinity, uint32_t *realTimePriority);
+static void edvsContainerCommit(edvsHandle handle, bool tsReset);
 static bool edvsSendBiases(edvsState state, int biasID);
 
 static void edvsLog(enum caer_log_level logLevel, edvsHandle handle, const char *format, ...) {
@@ -144,14 +145,14 @@ static inline void freeAllDataMemory(edvsState state) {
 	// already assigned to the current packet container, we
 	// free them separately from it.
 	if (state->currentPackets.polarity != NULL) {
-		free(state->currentPackets.polarity);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.polarity);
 		state->currentPackets.polarity = NULL;
 
 		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
 	}
 
 	if (state->currentPackets.special != NULL) {
-		free(state->currentPackets.special);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
 		state->currentPackets.special = NULL;
 
 		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
@@ -451,6 +452,14 @@ bool edvsConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 					atomic_store(&state->serialState.serialReadSize, param);
 					break;
 
+				case CAER_HOST_CONFIG_SERIAL_THREAD_CPU_AFFINITY:
+					atomic_store(&state->serialState.serialThreadCpuAffinity, param);
+					break;
+
+				case CAER_HOST_CONFIG_SERIAL_THREAD_REALTIME_PRIORITY:
+					atomic_store(&state->serialState.serialThreadRealTimePriority, param);
+					break;
+
 				default:
 					return (false);
 					break;
@@ -465,6 +474,10 @@ bool edvsConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigSet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -553,6 +566,14 @@ bool edvsConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 					*param = U32T(atomic_load(&state->serialState.serialReadSize));
 					break;
 
+				case CAER_HOST_CONFIG_SERIAL_THREAD_CPU_AFFINITY:
+					*param = U32T(atomic_load(&state->serialState.serialThreadCpuAffinity));
+					break;
+
+				case CAER_HOST_CONFIG_SERIAL_THREAD_REALTIME_PRIORITY:
+					*param = U32T(atomic_load(&state->serialState.serialThreadRealTimePriority));
+					break;
+
 				default:
 					return (false);
 					break;
@@ -567,6 +588,10 @@ bool edvsConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigGet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -665,6 +690,11 @@ static int serialThreadRun(void *handlePtr) {
 
 	thrd_set_name(threadName);
 
+	// Scheduling starts out inherited from the creating thread.
+	uint32_t cpuAffinity      = 0;
+	uint32_t realTimePriority = 0;
+	serialThreadSchedulingUpdate(handle, &cpuAffinity, &realTimePriority);
+
 	// Signal data thread ready back to start function.
 	atomic_store(&state->serialState.serialThreadState, THR_RUNNING);
 
@@ -672,13 +702,17 @@ static int serialThreadRun(void *handlePtr) {
 
 	// Handle serial port reading (wait on data, 10 ms timeout).
 	while (atomic_load_explicit(&state->serialState.serialThreadState, memory_order_relaxed) == THR_RUNNING) {
+		serialThreadSchedulingUpdate(handle, &cpuAffinity, &realTimePriority);
+
 		size_t readSize = atomic_load_explicit(&state->serialState.serialReadSize, memory_order_relaxed);
 
 		// Wait for at least 16 full events to be present in the buffer.
 		int bytesAvailable = 0;
 
+		// Stop waiting early if the latency bound on pending events runs out.
 		while ((bytesAvailable < (16 * EDVS_EVENT_SIZE))
-			   && atomic_load_explicit(&state->serialState.serialThreadState, memory_order_relaxed) == THR_RUNNING) {
+			   && atomic_load_explicit(&state->serialState.serialThreadState, memory_order_relaxed) == THR_RUNNING
+			   && !containerGenerationIsCommitLatencyElapsed(&state->container)) {
 			bytesAvailable = sp_input_waiting(state->serialState.serialPort);
 		}
 
@@ -689,6 +723,12 @@ static int serialThreadRun(void *handlePtr) {
 		// Ensure read size is a multiple of event size.
 		readSize &= (size_t) ~0x03;
 
+		if (readSize == 0) {
+			// Nothing to read, let the translator commit what is pending.
+			edvsEventTranslator(handle, NULL, 0);
+			continue;
+		}
+
 		uint8_t dataBuffer[readSize];
 		int bytesRead = sp_blocking_read(state->serialState.serialPort, dataBuffer, readSize, 10);
 		if (bytesRead < 0) {
@@ -700,6 +740,8 @@ static int serialThreadRun(void *handlePtr) {
 		}
 
 		if (bytesRead >= EDVS_EVENT_SIZE) {
+			dataStatisticsTransfer(&state->container.statistics, (size_t) bytesRead);
+
 			// Read something (at least 1 possible event), process it and try again.
 			edvsEventTranslator(handle, dataBuffer, (size_t) bytesRead);
 		}
@@ -713,6 +755,37 @@ static int serialThreadRun(void *handlePtr) {
 	return (EXIT_SUCCESS);
 }
 
+// Apply the configured CPU affinity and real-time priority to the calling
+// thread, if they differ from the ones it currently uses, which are updated.
+static void serialThreadSchedulingUpdate(edvsHandle handle, uint32_t *cpuAffinity, uint32_t *realTimePriority) {
+	edvsState state = &handle->state;
+
+	uint32_t newCpuAffinity
+		= U32T(atomic_load_explicit(&state->serialState.serialThreadCpuAffinity, memory_order_relaxed));
+
+	if (newCpuAffinity != *cpuAffinity) {
+		*cpuAffinity = newCpuAffinity;
+
+		if (thrd_set_affinity(newCpuAffinity) != thrd_success) {
+			edvsLog(CAER_LOG_ERROR, handle, "Failed to set serial thread CPU affinity to 0x%" PRIX32 ".",
+				newCpuAffinity);
+		}
+	}
+
+	uint32_t newRealTimePriority
+		= U32T(atomic_load_explicit(&state->serialState.serialThreadRealTimePriority, memory_order_relaxed));
+
+	if (newRealTimePriority != *realTimePriority) {
+		*realTimePriority = newRealTimePriority;
+
+		if (thrd_set_realtime_priority((int) newRealTimePriority) != thrd_success) {
+			edvsLog(CAER_LOG_ERROR, handle,
+				"Failed to set serial thread real-time priority to %" PRIu32 ". Missing privileges?",
+				newRealTimePriority);
+		}
+	}
+}
+
 bool edvsDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr), void (*dataNotifyDecrease)(void *ptr),
 	void *dataNotifyUserPtr, void (*dataShutdownNotify)(void *ptr), void *dataShutdownUserPtr) {
 	edvsHandle handle = (edvsHandle) cdh;
@@ -731,6 +804,13 @@ bool edvsDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
 		return (false);
 	}
 
+	if (!containerGenerationPoolInit(&state->container)) {
+		freeAllDataMemory(state);
+
+		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to initialize packet container recycling pool.");
+		return (false);
+	}
+
 	// Allocate packets.
 	if (!containerGenerationAllocate(&state->container, EDVS_EVENT_TYPES)) {
 		freeAllDataMemory(state);
@@ -803,11 +883,69 @@ caerEventPacketContainer edvsDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->serialState.serialThreadState));
 }
 
+size_t edvsDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	edvsHandle handle = (edvsHandle) cdh;
+	edvsState state   = &handle->state;
+
+	return (dataExchangeGetMany(
+		&state->dataExchange, &state->serialState.serialThreadState, containers, maxContainers));
+}
+
+void edvsDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	edvsHandle handle = (edvsHandle) cdh;
+	edvsState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
 #define TS_WRAP_ADD   0x10000
 #define HIGH_BIT_MASK 0x80
 #define LOW_BITS_MASK 0x7F
 
-static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
+// Per-event-type commit triggers, see containerGenerationIsTypeCommitDue().
+static inline bool edvsIsTypeCommitDue(edvsState state) {
+	containerGeneration container = &state->container;
+	int64_t timestamp             = generateFullTimestamp(state->timestamps.wrapOverflow, state->timestamps.current);
+
+	return (containerGenerationIsTypeCommitDue(
+				container, SPECIAL_EVENT, state->currentPackets.specialPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, POLARITY_EVENT, state->currentPackets.polarityPosition, timestamp));
+}
+
+static void edvsContainerCommit(edvsHandle handle, bool tsReset) {
+	edvsState state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	if (state->currentPackets.polarityPosition > 0) {
+		polarityGroupCountersCommit(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+		containerGenerationSetPacket(
+			&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+		state->currentPackets.polarity         = NULL;
+		state->currentPackets.polarityPosition = 0;
+		emptyContainerCommit                   = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->serialState.serialThreadState,
+		handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
+}
+
+void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	edvsHandle handle = vhd;
 	edvsState state   = &handle->state;
 
@@ -832,7 +970,7 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 
 		if ((i + 3) >= bytesSent) {
 			// Cannot fetch next event data, we're done with this buffer.
-			return;
+			break;
 		}
 
 		// Allocate new packets for next iteration as needed.
@@ -842,8 +980,13 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 		}
 
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				EDVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.polarity = (caerPolarityEventPacket) containerGenerationPacketReuse(&state->container,
+				POLARITY_EVENT, POLARITY_EVENT, EDVS_POLARITY_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.polarity == NULL) {
+				state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+					EDVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.polarity == NULL) {
 				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
 				return;
@@ -861,11 +1004,18 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 			}
 
 			state->currentPackets.polarity = grownPacket;
+
+			dataStatisticsIncrease(&state->container.statistics.packetsGrown, 1);
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				EDVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, EDVS_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					EDVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -883,6 +1033,8 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 			}
 
 			state->currentPackets.special = grownPacket;
+
+			dataStatisticsIncrease(&state->container.statistics.packetsGrown, 1);
 		}
 
 		bool tsReset   = false;
@@ -968,13 +1120,8 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 
 				// Check range conformity.
 				if ((x < EDVS_ARRAY_SIZE_X) && (y < EDVS_ARRAY_SIZE_Y)) {
-					caerPolarityEvent currentEvent = caerPolarityEventPacketGetEvent(
-						state->currentPackets.polarity, state->currentPackets.polarityPosition++);
-					caerPolarityEventSetTimestamp(currentEvent, state->timestamps.current);
-					caerPolarityEventSetPolarity(currentEvent, polarity);
-					caerPolarityEventSetY(currentEvent, y);
-					caerPolarityEventSetX(currentEvent, x);
-					caerPolarityEventValidate(currentEvent, state->currentPackets.polarity);
+					polarityGroupEventStore(state->currentPackets.polarity, state->currentPackets.polarityPosition++, x,
+						y, polarity, state->timestamps.current);
 				}
 				else {
 					if (x >= EDVS_ARRAY_SIZE_X) {
@@ -1000,42 +1147,26 @@ static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSe
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && edvsIsTypeCommitDue(state);
+
 		// NOTE: with the current EDVS architecture, currentTimestamp always comes together
 		// with an event, so the very first event that matches this threshold will be
 		// also part of the committed packet container. This doesn't break any of the invariants.
 
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->serialState.serialThreadState,
-				handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			edvsContainerCommit(handle, tsReset);
 		}
 
 		i += 4;
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		edvsContainerCommit(handle, false);
+	}
 }
 
 static bool edvsSendBiases(edvsState state, int biasID) {
@@ -7,6 +7,7 @@
 #include "c11threads_posix.h"
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 
 #include <libserialport.h>
 #include <stdatomic.h>
@@ -33,6 +34,8 @@ struct serial_state {
 	// Serial thread state
 	thrd_t serialThread;
 	atomic_uint_fast32_t serialThreadState;
+	atomic_uint_fast32_t serialThreadCpuAffinity;
+	atomic_uint_fast32_t serialThreadRealTimePriority;
 	// Serial Data Transfers
 	atomic_uint_fast32_t serialReadSize;
 	// Serial Data Transfers shutdown callback
@@ -101,5 +104,11 @@ bool edvsDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *ptr
 	void *dataShutdownUserPtr);
 bool edvsDataStop(caerDeviceHandle handle);
 caerEventPacketContainer edvsDataGet(caerDeviceHandle handle);
+size_t edvsDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+void edvsDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
+
+// Translate raw serial data to events. Only called by the serial thread,
+// and directly by the benchmarks to feed it synthetic data.
+void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent);
 
 #endif /* LIBCAER_SRC_EDVS_H_ */
@@ -0,0 +1,337 @@
+#include "libcaer/events/common.h"
+
+#include "c11threads_posix.h"
+#include "portable_aligned_alloc.h"
+
+#include <stdatomic.h>
+
+#if defined(OS_UNIX)
+#	include <sys/mman.h>
+#endif
+
+#define ARENA_REGION_SIZE_DEFAULT (4 * 1024 * 1024)
+#define ARENA_PAGE_SIZE           (4 * 1024)
+#define ARENA_HUGE_PAGE_SIZE      (2 * 1024 * 1024)
+#define ARENA_BLOCK_ALIGNMENT     16
+#define ARENA_REGION_ALIGNMENT    64
+
+#define ARENA_ALIGN_UP(SIZE, ALIGNMENT) ((((SIZE) + (ALIGNMENT) -1) / (ALIGNMENT)) * (ALIGNMENT))
+
+struct arena_region {
+	// Live blocks carved from this region, plus one while the arena still carves from it.
+	atomic_uint_fast32_t references;
+	// Size of the whole region, this header included.
+	size_t size;
+	// Bytes already carved from the region, this header included. Protected by the arena lock.
+	size_t used;
+	// Memory comes from mmap(), else from portable_aligned_alloc().
+	bool mapped;
+};
+
+struct arena_block {
+	// Region this block was carved from.
+	struct arena_region *region;
+	// Usable size of the block, a multiple of ARENA_BLOCK_ALIGNMENT.
+	size_t size;
+};
+
+#define ARENA_REGION_HEADER_SIZE ARENA_ALIGN_UP(sizeof(struct arena_region), (size_t) ARENA_REGION_ALIGNMENT)
+#define ARENA_BLOCK_HEADER_SIZE  ARENA_ALIGN_UP(sizeof(struct arena_block), (size_t) ARENA_BLOCK_ALIGNMENT)
+
+struct caer_event_packet_arena {
+	size_t regionSize;
+	bool hugePages;
+	// Set once mapping huge pages failed, to not retry on every new region. Protected by lock.
+	bool hugePagesFailed;
+	mtx_t lock;
+	// Region new blocks are carved from. Protected by lock.
+	struct arena_region *current;
+};
+
+static void *defaultAllocate(void *userData, size_t size, bool zero);
+static void *defaultReallocate(void *userData, void *memory, size_t size);
+static void defaultDeallocate(void *userData, void *memory);
+static struct arena_region *arenaRegionCreate(caerEventPacketArena arena, size_t size);
+static void arenaRegionRelease(struct arena_region *region);
+static void *arenaAllocate(void *userData, size_t size, bool zero);
+static void *arenaReallocate(void *userData, void *memory, size_t size);
+static void arenaDeallocate(void *userData, void *memory);
+
+static struct caer_event_packet_allocator eventPacketAllocator
+	= {.allocate = &defaultAllocate, .reallocate = &defaultReallocate, .deallocate = &defaultDeallocate};
+
+void caerEventPacketAllocatorSet(const struct caer_event_packet_allocator *allocator) {
+	if ((allocator == NULL) || (allocator->allocate == NULL) || (allocator->reallocate == NULL)
+		|| (allocator->deallocate == NULL)) {
+		eventPacketAllocator.allocate   = &defaultAllocate;
+		eventPacketAllocator.reallocate = &defaultReallocate;
+		eventPacketAllocator.deallocate = &defaultDeallocate;
+		eventPacketAllocator.userData   = NULL;
+		return;
+	}
+
+	eventPacketAllocator = *allocator;
+}
+
+struct caer_event_packet_allocator caerEventPacketAllocatorGet(void) {
+	return (eventPacketAllocator);
+}
+
+void *caerEventPacketMemoryAllocate(size_t size, bool zero) {
+	return ((*eventPacketAllocator.allocate)(eventPacketAllocator.userData, size, zero));
+}
+
+void *caerEventPacketMemoryReallocate(void *memory, size_t size) {
+	return ((*eventPacketAllocator.reallocate)(eventPacketAllocator.userData, memory, size));
+}
+
+void caerEventPacketMemoryFree(void *memory) {
+	(*eventPacketAllocator.deallocate)(eventPacketAllocator.userData, memory);
+}
+
+static void *defaultAllocate(void *userData, size_t size, bool zero) {
+	(void) (userData);
+
+	return ((zero) ? (calloc(1, size)) : (malloc(size)));
+}
+
+static void *defaultReallocate(void *userData, void *memory, size_t size) {
+	(void) (userData);
+
+	return (realloc(memory, size));
+}
+
+static void defaultDeallocate(void *userData, void *memory) {
+	(void) (userData);
+
+	free(memory);
+}
+
+caerEventPacketArena caerEventPacketArenaCreate(size_t regionSize, bool hugePages) {
+	caerEventPacketArena arena = calloc(1, sizeof(*arena));
+	if (arena == NULL) {
+		return (NULL);
+	}
+
+	if (mtx_init(&arena->lock, mtx_plain) != thrd_success) {
+		free(arena);
+		return (NULL);
+	}
+
+	if (regionSize == 0) {
+		regionSize = ARENA_REGION_SIZE_DEFAULT;
+	}
+
+	arena->regionSize = ARENA_ALIGN_UP(regionSize, (hugePages) ? (ARENA_HUGE_PAGE_SIZE) : (ARENA_PAGE_SIZE));
+	arena->hugePages  = hugePages;
+
+	return (arena);
+}
+
+struct caer_event_packet_allocator caerEventPacketArenaAllocator(caerEventPacketArena arena) {
+	struct caer_event_packet_allocator allocator;
+
+	allocator.allocate   = &arenaAllocate;
+	allocator.reallocate = &arenaReallocate;
+	allocator.deallocate = &arenaDeallocate;
+	allocator.userData   = arena;
+
+	return (allocator);
+}
+
+void caerEventPacketArenaDestroy(caerEventPacketArena arena) {
+	if (arena == NULL) {
+		return;
+	}
+
+	// Blocks still alive keep their region around, until they are freed.
+	if (arena->current != NULL) {
+		arenaRegionRelease(arena->current);
+	}
+
+	mtx_destroy(&arena->lock);
+
+	free(arena);
+}
+
+// Regions are always handed out zeroed: fresh mappings already are, and
+// since memory is never reused within a region, all blocks then are too.
+static struct arena_region *arenaRegionCreate(caerEventPacketArena arena, size_t size) {
+	bool hugePages = (arena->hugePages && !arena->hugePagesFailed);
+	void *memory   = NULL;
+	bool mapped    = false;
+
+	size = ARENA_ALIGN_UP(size, (hugePages) ? (ARENA_HUGE_PAGE_SIZE) : (ARENA_PAGE_SIZE));
+
+#if defined(OS_UNIX)
+#	if defined(MAP_HUGETLB)
+	if (hugePages) {
+		memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (memory == MAP_FAILED) {
+			// No huge pages reserved on the system, use transparent ones.
+			memory                 = NULL;
+			arena->hugePagesFailed = true;
+		}
+	}
+#	endif
+
+	if (memory == NULL) {
+		memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (memory == MAP_FAILED) {
+			memory = NULL;
+		}
+#	if defined(MADV_HUGEPAGE)
+		else if (arena->hugePages) {
+			// Only a hint, failure is fine.
+			madvise(memory, size, MADV_HUGEPAGE);
+		}
+#	endif
+	}
+
+	mapped = (memory != NULL);
+#endif
+
+	if (memory == NULL) {
+		memory = portable_aligned_alloc(ARENA_REGION_ALIGNMENT, size);
+		if (memory == NULL) {
+			return (NULL);
+		}
+
+		memset(memory, 0, size);
+	}
+
+	struct arena_region *region = memory;
+
+	atomic_store_explicit(&region->references, 1, memory_order_relaxed);
+	region->size   = size;
+	region->used   = ARENA_REGION_HEADER_SIZE;
+	region->mapped = mapped;
+
+	return (region);
+}
+
+static void arenaRegionRelease(struct arena_region *region) {
+	if (atomic_fetch_sub_explicit(&region->references, 1, memory_order_acq_rel) != 1) {
+		return;
+	}
+
+#if defined(OS_UNIX)
+	if (region->mapped) {
+		munmap(region, region->size);
+		return;
+	}
+#endif
+
+	portable_aligned_free(region);
+}
+
+static void *arenaAllocate(void *userData, size_t size, bool zero) {
+	// Arena memory is always zeroed, see arenaRegionCreate().
+	(void) (zero);
+
+	caerEventPacketArena arena = userData;
+	size_t blockSize           = ARENA_BLOCK_HEADER_SIZE + ARENA_ALIGN_UP(size, (size_t) ARENA_BLOCK_ALIGNMENT);
+	struct arena_region *region;
+	size_t offset;
+
+	mtx_lock(&arena->lock);
+
+	if (blockSize > ((arena->regionSize - ARENA_REGION_HEADER_SIZE) / 2)) {
+		// Big blocks get their own region, referenced only by the block.
+		region = arenaRegionCreate(arena, ARENA_REGION_HEADER_SIZE + blockSize);
+		if (region == NULL) {
+			mtx_unlock(&arena->lock);
+			return (NULL);
+		}
+
+		offset       = region->used;
+		region->used = region->size;
+	}
+	else {
+		region = arena->current;
+
+		if ((region == NULL) || ((region->used + blockSize) > region->size)) {
+			struct arena_region *newRegion = arenaRegionCreate(arena, arena->regionSize);
+			if (newRegion == NULL) {
+				mtx_unlock(&arena->lock);
+				return (NULL);
+			}
+
+			// Done carving from the old region, drop the arena's reference to it.
+			if (region != NULL) {
+				arenaRegionRelease(region);
+			}
+
+			region         = newRegion;
+			arena->current = newRegion;
+		}
+
+		atomic_fetch_add_explicit(&region->references, 1, memory_order_relaxed);
+
+		offset = region->used;
+		region->used += blockSize;
+	}
+
+	mtx_unlock(&arena->lock);
+
+	struct arena_block *block = (struct arena_block *) (((uint8_t *) region) + offset);
+
+	block->region = region;
+	block->size   = blockSize - ARENA_BLOCK_HEADER_SIZE;
+
+	return (((uint8_t *) block) + ARENA_BLOCK_HEADER_SIZE);
+}
+
+static void *arenaReallocate(void *userData, void *memory, size_t size) {
+	if (memory == NULL) {
+		return (arenaAllocate(userData, size, false));
+	}
+
+	caerEventPacketArena arena = userData;
+	struct arena_block *block  = (struct arena_block *) (((uint8_t *) memory) - ARENA_BLOCK_HEADER_SIZE);
+	size_t newSize             = ARENA_ALIGN_UP(size, (size_t) ARENA_BLOCK_ALIGNMENT);
+
+	// Shrinking keeps the block as it is.
+	if (newSize <= block->size) {
+		return (memory);
+	}
+
+	// Grow in place if this is the last block carved from the current region, and it still has space.
+	struct arena_region *region = block->region;
+
+	mtx_lock(&arena->lock);
+
+	if ((region == arena->current) && ((((uint8_t *) memory) + block->size) == (((uint8_t *) region) + region->used))
+		&& ((region->used + (newSize - block->size)) <= region->size)) {
+		region->used += newSize - block->size;
+		block->size = newSize;
+
+		mtx_unlock(&arena->lock);
+		return (memory);
+	}
+
+	mtx_unlock(&arena->lock);
+
+	void *newMemory = arenaAllocate(userData, size, false);
+	if (newMemory == NULL) {
+		return (NULL);
+	}
+
+	memcpy(newMemory, memory, block->size);
+
+	arenaDeallocate(userData, memory);
+
+	return (newMemory);
+}
+
+static void arenaDeallocate(void *userData, void *memory) {
+	(void) (userData);
+
+	if (memory == NULL) {
+		return;
+	}
+
+	struct arena_block *block = (struct arena_block *) (((uint8_t *) memory) - ARENA_BLOCK_HEADER_SIZE);
+
+	arenaRegionRelease(block->region);
+}
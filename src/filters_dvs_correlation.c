@@ -0,0 +1,602 @@
+#include "libcaer/filters/dvs_correlation.h"
+
+#define DVS_CORRELATION_WINDOW_SIZE_MAX 4096
+#define DVS_CORRELATION_SUBSAMPLE_MAX   4
+
+// Timestamp of row/column kernel events without any event yet. Old enough to
+// never support an event, yet far enough from the limits to not overflow.
+#define DVS_CORRELATION_TS_NEVER (INT64_MIN / 4)
+
+// Lattice map and nearest-time window entries are 32 bit, as in the DVS noise
+// filter's timestamp map: the timestamp relative to the filter's base, plus
+// DVS_CORRELATION_TS_BIAS to keep it positive, shifted left by one, with the
+// polarity in the lowest bit. Zero is a timestamp too old to ever support an
+// event: it fills the lattice's border, so lookups need no border checks, and
+// replaces timestamps that fall out of the encodable range.
+#define DVS_CORRELATION_TS_BIAS (INT32_C(1) << 30)
+// Events are kept within this distance of the base, else the kernel's memory
+// is rebased onto them. The time setting is limited to it, so that expired
+// timestamps are always older than it.
+#define DVS_CORRELATION_TS_RANGE   (INT32_C(1) << 29)
+#define DVS_CORRELATION_TS_EXPIRED 0
+#define DVS_CORRELATION_TIME_MAX   U32T(DVS_CORRELATION_TS_RANGE)
+
+#define GET_TS(X)          I32T((X) >> 1)
+#define GET_POL(X)         ((X) &0x01)
+#define SET_TSPOL(TS, POL) ((U32T(TS) << 1) | ((POL) &0x01))
+// Initial lattice content: timestamp zero, OFF polarity, for a base at zero.
+#define DVS_CORRELATION_TS_ZERO SET_TSPOL(DVS_CORRELATION_TS_BIAS, 0)
+
+// Nearest-time window addresses: X in the lower 16 bits, Y in the upper.
+#define GET_ADDR_X(X)          ((X) &0xFFFF)
+#define GET_ADDR_Y(X)          ((X) >> 16)
+#define SET_ADDR(ADDRX, ADDRY) (U32T(ADDRX) | (U32T(ADDRY) << 16))
+
+struct dvs_correlation_event {
+	int64_t timestamp;
+	uint16_t x;
+	uint16_t y;
+	bool polarity;
+};
+
+struct caer_filter_dvs_correlation {
+	// Logging support.
+	uint8_t logLevel;
+	// Correlation filter configuration.
+	uint8_t kernel;
+	uint32_t time;
+	bool checkPolarity;
+	uint16_t windowSize;
+	uint8_t subsample;
+	uint64_t statOn;
+	uint64_t statOff;
+	// Maps and their sizes.
+	uint16_t sizeX;
+	uint16_t sizeY;
+	// Kernel memory, one allocation of memorySize entries for the current kernel,
+	// its layout depends on the kernel, see the pointers into it below.
+	void *memory;
+	size_t memorySize;
+	// Row/column kernel: the last event of each column, then of each row, both
+	// with one more entry on each side of the sensor, as border.
+	struct dvs_correlation_event *rowColumnEvents;
+	// Nearest-time kernel: the last events, as a ring buffer starting at
+	// windowNext, split by field so that checking all of them vectorizes.
+	uint32_t *windowTimestamps;
+	uint32_t *windowAddresses;
+	size_t windowNext;
+	// Lattice kernel: the last event of each cell, row by row, with one more
+	// cell on each side of the lattice, as border.
+	uint32_t *latticeMap;
+	size_t latticeColumns;
+	// Timestamp the lattice map and nearest-time window entries are relative to.
+	int64_t timestampBase;
+};
+
+// Lattice column and row, relative to a cell's column and row minus one, of its
+// eight neighbors, row by row.
+static const uint8_t neighborColumns[8] = {0, 1, 2, 0, 2, 0, 1, 2};
+static const uint8_t neighborRows[8]    = {0, 0, 0, 1, 1, 2, 2, 2};
+
+static void filterDVSCorrelationLog(
+	enum caer_log_level logLevel, caerFilterDVSCorrelation handle, const char *format, ...) ATTRIBUTE_FORMAT(3);
+static void caerFilterDVSCorrelationApplyInternal(
+	caerFilterDVSCorrelation correlationFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly);
+static bool kernelMemorySetup(caerFilterDVSCorrelation correlationFilter);
+static void kernelMemoryClear(caerFilterDVSCorrelation correlationFilter);
+static void kernelMemoryRebase(caerFilterDVSCorrelation correlationFilter, int64_t timestamp);
+
+static void filterDVSCorrelationLog(
+	enum caer_log_level logLevel, caerFilterDVSCorrelation handle, const char *format, ...) {
+	// Only log messages above the specified severity level.
+	uint8_t systemLogLevel = handle->logLevel;
+
+	if (logLevel > systemLogLevel) {
+		return;
+	}
+
+	va_list argumentList;
+	va_start(argumentList, format);
+	caerLogVAFull(systemLogLevel, logLevel, "DVS Correlation Filter", format, argumentList);
+	va_end(argumentList);
+}
+
+caerFilterDVSCorrelation caerFilterDVSCorrelationInitialize(uint16_t sizeX, uint16_t sizeY) {
+	caerFilterDVSCorrelation correlationFilter = calloc(1, sizeof(struct caer_filter_dvs_correlation));
+	if (correlationFilter == NULL) {
+		return (NULL);
+	}
+
+	correlationFilter->sizeX = sizeX;
+	correlationFilter->sizeY = sizeY;
+
+	// Default to global log-level.
+	enum caer_log_level logLevel = caerLogLevelGet();
+	correlationFilter->logLevel  = U8T(logLevel);
+
+	// Default values for filter.
+	correlationFilter->kernel        = CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN;
+	correlationFilter->time          = 2000;  // 2 milliseconds within neighborhood.
+	correlationFilter->checkPolarity = false; // Ignore polarity.
+	correlationFilter->windowSize    = 64;    // Last 64 events.
+	correlationFilter->subsample     = 1;     // 2x2 pixel lattice cells.
+
+	if (!kernelMemorySetup(correlationFilter)) {
+		free(correlationFilter);
+		return (NULL);
+	}
+
+	return (correlationFilter);
+}
+
+void caerFilterDVSCorrelationDestroy(caerFilterDVSCorrelation correlationFilter) {
+	free(correlationFilter->memory);
+
+	free(correlationFilter);
+}
+
+void caerFilterDVSCorrelationApply(caerFilterDVSCorrelation correlationFilter, caerPolarityEventPacket polarity) {
+	caerFilterDVSCorrelationApplyInternal(correlationFilter, polarity, false);
+}
+
+void caerFilterDVSCorrelationStatsApply(
+	caerFilterDVSCorrelation correlationFilter, caerPolarityEventPacketConst polarity) {
+	// Statistics-only mode is guaranteed to only read the memory.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+	caerFilterDVSCorrelationApplyInternal(correlationFilter, (caerPolarityEventPacket) polarity, true);
+#pragma GCC diagnostic pop
+}
+
+// An event in kernel memory supports a new one if it is recent enough and,
+// when checking polarity, has the same.
+static inline bool kernelEventIsRecent(caerFilterDVSCorrelation correlationFilter,
+	const struct dvs_correlation_event *kernelEvent, int64_t timestamp, bool polarity) {
+	return (((timestamp - kernelEvent->timestamp) < I64T(correlationFilter->time))
+			& (!correlationFilter->checkPolarity | (kernelEvent->polarity == polarity)));
+}
+
+// One of the eight pixels around (x, y), not the pixel itself.
+static inline bool kernelEventIsNeighbor(const struct dvs_correlation_event *kernelEvent, uint16_t x, uint16_t y) {
+	int32_t distanceX = I32T(kernelEvent->x) - I32T(x);
+	int32_t distanceY = I32T(kernelEvent->y) - I32T(y);
+
+	return ((U32T(distanceX + 1) <= 2) & (U32T(distanceY + 1) <= 2) & ((distanceX | distanceY) != 0));
+}
+
+static inline void kernelEventSet(
+	struct dvs_correlation_event *kernelEvent, uint16_t x, uint16_t y, int64_t timestamp, bool polarity) {
+	kernelEvent->timestamp = timestamp;
+	kernelEvent->x         = x;
+	kernelEvent->y         = y;
+	kernelEvent->polarity  = polarity;
+}
+
+// Row/column kernel: the last events of the column of the pixel and the two next
+// to it, and of its row and the two next to it, support it if they are neighbors.
+static inline bool rowColumnSupport(
+	caerFilterDVSCorrelation correlationFilter, uint16_t x, uint16_t y, int64_t timestamp, bool polarity) {
+	struct dvs_correlation_event *columns = correlationFilter->rowColumnEvents;
+	struct dvs_correlation_event *rows    = &correlationFilter->rowColumnEvents[(size_t) correlationFilter->sizeX + 2];
+	bool supported                        = false;
+
+	// Neighbor columns and rows, offset by one for the border.
+	for (size_t i = 0; i < 3; i++) {
+		const struct dvs_correlation_event *column = &columns[(size_t) x + i];
+		const struct dvs_correlation_event *row    = &rows[(size_t) y + i];
+
+		supported |= kernelEventIsRecent(correlationFilter, column, timestamp, polarity)
+					 & kernelEventIsNeighbor(column, x, y);
+		supported |= kernelEventIsRecent(correlationFilter, row, timestamp, polarity)
+					 & kernelEventIsNeighbor(row, x, y);
+	}
+
+	kernelEventSet(&columns[(size_t) x + 1], x, y, timestamp, polarity);
+	kernelEventSet(&rows[(size_t) y + 1], x, y, timestamp, polarity);
+
+	return (supported);
+}
+
+// Timestamp as stored in the lattice map and the nearest-time window, relative
+// to the filter's base, rebasing the kernel's memory when out of range.
+static inline int32_t kernelTimestamp(caerFilterDVSCorrelation correlationFilter, int64_t timestamp) {
+	int64_t tsRelative = timestamp - correlationFilter->timestampBase;
+
+	if (U64T(tsRelative + DVS_CORRELATION_TS_RANGE) >= U64T(2 * DVS_CORRELATION_TS_RANGE)) {
+		kernelMemoryRebase(correlationFilter, timestamp);
+		tsRelative = 0;
+	}
+
+	return (I32T(tsRelative + DVS_CORRELATION_TS_BIAS));
+}
+
+// If the difference between the current timestamp and the stored one is
+// smaller than the correlation time, the stored event supports the current one.
+// Takes the sign bit of the difference minus the time instead of comparing, so
+// that the nearest-time kernel's loop vectorizes.
+static inline uint32_t kernelEntryIsRecent(
+	uint32_t entry, int32_t timestamp, int32_t time, uint32_t polarity, uint32_t polarityMask) {
+	return ((U32T(timestamp - GET_TS(entry) - time) >> 31) & U32T(((entry ^ polarity) & polarityMask) == 0));
+}
+
+// Nearest-time kernel: any of the last events in the window supports the
+// pixel if it is a neighbor. They are all checked, for a fixed cost per event,
+// without branches, so that the compiler can vectorize the loop.
+static inline bool nearestTimeSupport(
+	caerFilterDVSCorrelation correlationFilter, uint16_t x, uint16_t y, int64_t timestamp, bool polarity) {
+	int32_t ts                = kernelTimestamp(correlationFilter, timestamp);
+	const uint32_t *entries   = correlationFilter->windowTimestamps;
+	const uint32_t *addresses = correlationFilter->windowAddresses;
+	int32_t time              = I32T(correlationFilter->time);
+	uint32_t pol              = U32T(polarity);
+	uint32_t polarityMask     = (correlationFilter->checkPolarity) ? (0x01) : (0x00);
+	uint32_t supported        = 0;
+
+	for (size_t i = 0; i < correlationFilter->memorySize; i++) {
+		// Distances plus one, so that neighbors are from 0 to 2, and the pixel itself is at 1, 1.
+		uint32_t distanceX = GET_ADDR_X(addresses[i]) - x + 1;
+		uint32_t distanceY = GET_ADDR_Y(addresses[i]) - y + 1;
+
+		supported |= kernelEntryIsRecent(entries[i], ts, time, pol, polarityMask) & U32T(distanceX <= 2)
+					 & U32T(distanceY <= 2) & U32T((distanceX | (distanceY << 2)) != 5);
+	}
+
+	// Replace the oldest event.
+	correlationFilter->windowTimestamps[correlationFilter->windowNext] = SET_TSPOL(ts, pol);
+	correlationFilter->windowAddresses[correlationFilter->windowNext]  = SET_ADDR(x, y);
+
+	correlationFilter->windowNext++;
+	if (correlationFilter->windowNext == correlationFilter->memorySize) {
+		correlationFilter->windowNext = 0;
+	}
+
+	return (supported != 0);
+}
+
+// Lattice kernel: the last events of the eight cells around the pixel's own
+// support it. The lattice's border cells never do. Same lookup as the DVS
+// noise filter's Background-Activity filter, on the cells instead of pixels.
+static inline bool latticeSupport(
+	caerFilterDVSCorrelation correlationFilter, uint16_t x, uint16_t y, int64_t timestamp, bool polarity) {
+	int32_t ts            = kernelTimestamp(correlationFilter, timestamp);
+	size_t columns        = correlationFilter->latticeColumns;
+	size_t cellX          = (size_t) (x >> correlationFilter->subsample) + 1;
+	size_t cellY          = (size_t) (y >> correlationFilter->subsample) + 1;
+	int32_t time          = I32T(correlationFilter->time);
+	uint32_t pol          = U32T(polarity);
+	uint32_t polarityMask = (correlationFilter->checkPolarity) ? (0x01) : (0x00);
+	uint32_t supported    = 0;
+
+	// Top-left neighbor, the others follow at the same offsets as on the lattice.
+	const uint32_t *neighborhood = &correlationFilter->latticeMap[((cellY - 1) * columns) + (cellX - 1)];
+
+	for (size_t i = 0; i < 8; i++) {
+		uint32_t neighbor = neighborhood[(neighborRows[i] * columns) + neighborColumns[i]];
+
+		supported |= kernelEntryIsRecent(neighbor, ts, time, pol, polarityMask);
+	}
+
+	correlationFilter->latticeMap[(cellY * columns) + cellX] = SET_TSPOL(ts, pol);
+
+	return (supported != 0);
+}
+
+// The kernel is a constant for each call in caerFilterDVSCorrelationApplyInternal(),
+// so that each one gets its own loop, with the kernel's lookup inlined.
+static inline void filterEvents(caerFilterDVSCorrelation correlationFilter, caerPolarityEventPacket polarityPacket,
+	bool statisticsOnly,
+	bool (*kernelSupport)(caerFilterDVSCorrelation correlationFilter, uint16_t x, uint16_t y, int64_t timestamp,
+		bool polarity)) {
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&polarityPacket->packetHeader);
+	bool dense          = caerEventPacketHeaderIsDense(&polarityPacket->packetHeader);
+
+	for (int32_t i = 0; i < eventNumber; i++) {
+		caerPolarityEvent event = caerPolarityEventPacketGetEvent(polarityPacket, i);
+
+		// Events invalidated while filtering are always behind the current one,
+		// so the packet's density at the start tells if all events are valid.
+		if (!dense && !caerPolarityEventIsValid(event)) {
+			continue; // Skip invalid polarity events.
+		}
+
+		uint16_t x = caerPolarityEventGetX(event);
+		uint16_t y = caerPolarityEventGetY(event);
+		bool pol   = caerPolarityEventGetPolarity(event);
+		int64_t ts = caerPolarityEventGetTimestamp64(event, polarityPacket);
+
+		if ((*kernelSupport)(correlationFilter, x, y, ts, pol)) {
+			continue;
+		}
+
+		// Event is not supported by any neighbor, invalidate it.
+		if (!statisticsOnly) {
+			caerPolarityEventInvalidate(event, polarityPacket);
+		}
+		if (pol) {
+			correlationFilter->statOn++;
+		}
+		else {
+			correlationFilter->statOff++;
+		}
+	}
+}
+
+static void caerFilterDVSCorrelationApplyInternal(
+	caerFilterDVSCorrelation correlationFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly) {
+	// Nothing to process.
+	if ((polarityPacket == NULL) || (caerEventPacketHeaderGetEventValid(&polarityPacket->packetHeader) == 0)) {
+		return;
+	}
+
+	switch (correlationFilter->kernel) {
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN:
+			filterEvents(correlationFilter, polarityPacket, statisticsOnly, &rowColumnSupport);
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME:
+			filterEvents(correlationFilter, polarityPacket, statisticsOnly, &nearestTimeSupport);
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE:
+			filterEvents(correlationFilter, polarityPacket, statisticsOnly, &latticeSupport);
+			break;
+	}
+}
+
+// Allocate the memory of the configured kernel, replacing the current one.
+// On failure, the current memory is kept.
+static bool kernelMemorySetup(caerFilterDVSCorrelation correlationFilter) {
+	size_t memorySize     = 0;
+	size_t entrySize      = 0;
+	size_t latticeColumns = 0;
+
+	switch (correlationFilter->kernel) {
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN:
+			memorySize = (size_t) correlationFilter->sizeX + (size_t) correlationFilter->sizeY + 4;
+			entrySize  = sizeof(struct dvs_correlation_event);
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME:
+			memorySize = correlationFilter->windowSize;
+			entrySize  = sizeof(uint32_t) + sizeof(uint32_t);
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE: {
+			// Cells covering the whole sensor, plus the border.
+			size_t cellsX = ((size_t) correlationFilter->sizeX >> correlationFilter->subsample) + 1;
+			size_t cellsY = ((size_t) correlationFilter->sizeY >> correlationFilter->subsample) + 1;
+
+			latticeColumns = cellsX + 2;
+			memorySize     = latticeColumns * (cellsY + 2);
+			entrySize      = sizeof(uint32_t);
+			break;
+		}
+	}
+
+	void *memory = malloc(memorySize * entrySize);
+	if (memory == NULL) {
+		filterDVSCorrelationLog(CAER_LOG_ERROR, correlationFilter,
+			"Failed to allocate memory for kernel %" PRIu8 ", %zu events.", correlationFilter->kernel, memorySize);
+		return (false);
+	}
+
+	free(correlationFilter->memory);
+
+	correlationFilter->memory     = memory;
+	correlationFilter->memorySize = memorySize;
+
+	correlationFilter->rowColumnEvents  = NULL;
+	correlationFilter->windowTimestamps = NULL;
+	correlationFilter->windowAddresses  = NULL;
+	correlationFilter->latticeMap       = NULL;
+	correlationFilter->latticeColumns   = latticeColumns;
+
+	switch (correlationFilter->kernel) {
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN:
+			correlationFilter->rowColumnEvents = memory;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME:
+			correlationFilter->windowTimestamps = memory;
+			correlationFilter->windowAddresses  = &correlationFilter->windowTimestamps[memorySize];
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE:
+			correlationFilter->latticeMap = memory;
+			break;
+	}
+
+	kernelMemoryClear(correlationFilter);
+
+	return (true);
+}
+
+static void kernelMemoryClear(caerFilterDVSCorrelation correlationFilter) {
+	for (size_t i = 0; i < correlationFilter->memorySize; i++) {
+		switch (correlationFilter->kernel) {
+			case CAER_FILTER_DVS_CORRELATION_KERNEL_ROW_COLUMN:
+				kernelEventSet(&correlationFilter->rowColumnEvents[i], 0, 0, DVS_CORRELATION_TS_NEVER, false);
+				break;
+
+			case CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME:
+				correlationFilter->windowTimestamps[i] = DVS_CORRELATION_TS_EXPIRED;
+				correlationFilter->windowAddresses[i]  = 0;
+				break;
+
+			case CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE:
+				correlationFilter->latticeMap[i] = DVS_CORRELATION_TS_EXPIRED;
+				break;
+		}
+	}
+
+	// Cells covering the sensor start at timestamp zero, as the DVS noise filter's
+	// timestamp map does, so that events close to zero get the same support.
+	if (correlationFilter->kernel == CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE) {
+		size_t cellSize = (size_t) 1 << correlationFilter->subsample;
+		size_t cellsX   = ((size_t) correlationFilter->sizeX + cellSize - 1) >> correlationFilter->subsample;
+		size_t cellsY   = ((size_t) correlationFilter->sizeY + cellSize - 1) >> correlationFilter->subsample;
+
+		for (size_t y = 1; y <= cellsY; y++) {
+			for (size_t x = 1; x <= cellsX; x++) {
+				correlationFilter->latticeMap[(y * correlationFilter->latticeColumns) + x] = DVS_CORRELATION_TS_ZERO;
+			}
+		}
+	}
+
+	correlationFilter->windowNext    = 0;
+	correlationFilter->timestampBase = 0;
+}
+
+// Move the lattice map or nearest-time window entries to a new base. Timestamps that
+// fall out of the encodable range expire, as do all when moving to an earlier base.
+static void kernelMemoryRebase(caerFilterDVSCorrelation correlationFilter, int64_t timestamp) {
+	int64_t shift     = timestamp - correlationFilter->timestampBase;
+	uint32_t *entries = (correlationFilter->kernel == CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME)
+							? (correlationFilter->windowTimestamps)
+							: (correlationFilter->latticeMap);
+
+	for (size_t i = 0; i < correlationFilter->memorySize; i++) {
+		int64_t entryTimestamp = I64T(GET_TS(entries[i])) - shift;
+
+		if ((shift < 0) || (entryTimestamp <= 0)) {
+			entries[i] = DVS_CORRELATION_TS_EXPIRED;
+		}
+		else {
+			entries[i] = SET_TSPOL(entryTimestamp, GET_POL(entries[i]));
+		}
+	}
+
+	correlationFilter->timestampBase = timestamp;
+}
+
+bool caerFilterDVSCorrelationConfigSet(caerFilterDVSCorrelation correlationFilter, uint8_t paramAddr, uint64_t param) {
+	switch (paramAddr) {
+		case CAER_FILTER_DVS_CORRELATION_KERNEL: {
+			if (param > CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE) {
+				return (false);
+			}
+
+			uint8_t kernel            = correlationFilter->kernel;
+			correlationFilter->kernel = U8T(param);
+
+			if (!kernelMemorySetup(correlationFilter)) {
+				correlationFilter->kernel = kernel;
+				return (false);
+			}
+			break;
+		}
+
+		case CAER_FILTER_DVS_CORRELATION_TIME:
+			// Longer times can't be told apart from expired timestamps, see DVS_CORRELATION_TS_RANGE.
+			correlationFilter->time = (param > DVS_CORRELATION_TIME_MAX) ? (DVS_CORRELATION_TIME_MAX) : (U32T(param));
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_CHECK_POLARITY:
+			correlationFilter->checkPolarity = param;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_WINDOW_SIZE: {
+			if ((param == 0) || (param > DVS_CORRELATION_WINDOW_SIZE_MAX)) {
+				return (false);
+			}
+
+			uint16_t windowSize           = correlationFilter->windowSize;
+			correlationFilter->windowSize = U16T(param);
+
+			if ((correlationFilter->kernel == CAER_FILTER_DVS_CORRELATION_KERNEL_NEAREST_TIME)
+				&& !kernelMemorySetup(correlationFilter)) {
+				correlationFilter->windowSize = windowSize;
+				return (false);
+			}
+			break;
+		}
+
+		case CAER_FILTER_DVS_CORRELATION_SUBSAMPLE: {
+			if (param > DVS_CORRELATION_SUBSAMPLE_MAX) {
+				return (false);
+			}
+
+			uint8_t subsample            = correlationFilter->subsample;
+			correlationFilter->subsample = U8T(param);
+
+			if ((correlationFilter->kernel == CAER_FILTER_DVS_CORRELATION_KERNEL_LATTICE)
+				&& !kernelMemorySetup(correlationFilter)) {
+				correlationFilter->subsample = subsample;
+				return (false);
+			}
+			break;
+		}
+
+		case CAER_FILTER_DVS_CORRELATION_LOG_LEVEL:
+			correlationFilter->logLevel = U8T(param);
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_RESET:
+			if (param) {
+				kernelMemoryClear(correlationFilter);
+
+				// Reset statistics to zero
+				correlationFilter->statOn  = 0;
+				correlationFilter->statOff = 0;
+			}
+			break;
+
+		default:
+			// Unrecognized or invalid parameter address.
+			return (false);
+	}
+
+	// Done!
+	return (true);
+}
+
+bool caerFilterDVSCorrelationConfigGet(
+	caerFilterDVSCorrelation correlationFilter, uint8_t paramAddr, uint64_t *param) {
+	// Ensure param is zeroed out.
+	*param = 0;
+
+	switch (paramAddr) {
+		case CAER_FILTER_DVS_CORRELATION_KERNEL:
+			*param = correlationFilter->kernel;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_TIME:
+			*param = correlationFilter->time;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_CHECK_POLARITY:
+			*param = correlationFilter->checkPolarity;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_WINDOW_SIZE:
+			*param = correlationFilter->windowSize;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_SUBSAMPLE:
+			*param = correlationFilter->subsample;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_STATISTICS:
+			*param = (correlationFilter->statOn + correlationFilter->statOff);
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_STATISTICS_ON:
+			*param = correlationFilter->statOn;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_STATISTICS_OFF:
+			*param = correlationFilter->statOff;
+			break;
+
+		case CAER_FILTER_DVS_CORRELATION_LOG_LEVEL:
+			*param = correlationFilter->logLevel;
+			break;
+
+		default:
+			// Unrecognized or invalid parameter address.
+			return (false);
+	}
+
+	// Done!
+	return (true);
+}
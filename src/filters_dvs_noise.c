@@ -1,10 +1,73 @@
 #include "libcaer/filters/dvs_noise.h"
 
+#include "c11threads_posix.h"
+#include "portable_aligned_alloc.h"
+
+#define DVS_NOISE_THREADS_MAX   64
+#define DVS_NOISE_BAND_ROWS_MIN 16
+// Rows above and below a band that its lookups can reach: one for the
+// neighbors of a pixel, two with the two-level Background Activity lookup.
+#define DVS_NOISE_HALO_ROWS 2
+// Rows are in the halo rows of at most one other band than their own.
+#define DVS_NOISE_BAND_NONE UINT8_MAX
+
+// Timestamp map entries are 32 bit: the timestamp relative to the band's base,
+// plus DVS_NOISE_TS_BIAS to keep it positive, shifted left by one, with the
+// polarity in the lowest bit. Zero is a timestamp too old to ever support or
+// inhibit an event: it fills the border around the sensor, so lookups need no
+// border checks, and replaces timestamps that fall out of the encodable range.
+#define DVS_NOISE_TS_BIAS (INT32_C(1) << 30)
+// Events are kept within this distance of the band's base, else the band is
+// rebased onto them. The time settings are limited to it, so that expired
+// timestamps are always older than them.
+#define DVS_NOISE_TS_RANGE (INT32_C(1) << 29)
+#define DVS_NOISE_TS_EXPIRED 0
+#define DVS_NOISE_TIME_MAX U32T(DVS_NOISE_TS_RANGE)
+
+// Tiles are 4x4 map entries, 64 bytes, one cache line: the map is aligned to them.
+#define DVS_NOISE_TILE_SIZE      4
+#define DVS_NOISE_TILE_ALIGNMENT 64
+// Pixel positions within a tile, see struct caer_filter_dvs_noise's neighborOffsets.
+#define DVS_NOISE_TILE_POSITIONS (DVS_NOISE_TILE_SIZE * DVS_NOISE_TILE_SIZE)
+
+#define DVS_NOISE_ALIGN_UP(SIZE, ALIGNMENT) ((((SIZE) + (ALIGNMENT) -1) / (ALIGNMENT)) * (ALIGNMENT))
+
+struct dvs_noise_band {
+	caerFilterDVSNoise noiseFilter;
+	// Rows owned by this band, from rowStart to rowEnd (excluded).
+	uint16_t rowStart;
+	uint16_t rowEnd;
+	// Timestamp map rows from rowStart - DVS_NOISE_HALO_ROWS to rowEnd + DVS_NOISE_HALO_ROWS.
+	// The halo rows are copies of the neighbor bands' rows, updated by this band.
+	uint32_t *timestampsMap;
+	size_t timestampsMapSize;
+	// Timestamp the map's entries are relative to.
+	int64_t timestampBase;
+	// Events of the current run in the band's own and halo rows, by index, when
+	// filtering with multiple threads, see bandsEventsAssign().
+	int32_t *runEvents;
+	size_t runEventsNumber;
+	// Statistics of the last filtering run, summed up by the calling thread.
+	uint64_t hotPixelStatOn;
+	uint64_t hotPixelStatOff;
+	uint64_t backgroundActivityStatOn;
+	uint64_t backgroundActivityStatOff;
+	uint64_t refractoryPeriodStatOn;
+	uint64_t refractoryPeriodStatOff;
+	// Worker thread, for all bands except the first one.
+	thrd_t thread;
+	mtx_t threadLock;
+	cnd_t threadCond;
+	uint32_t threadJob;
+	bool threadRun;
+};
+
 struct caer_filter_dvs_noise {
 	// Logging support.
 	uint8_t logLevel;
 	// Hot Pixel filter (learning).
 	bool hotPixelLearn;
+	bool hotPixelLearnIncremental;
 	uint32_t hotPixelTime;
 	uint32_t hotPixelCount;
 	bool hotPixelLearningStarted;
@@ -14,6 +77,8 @@ struct caer_filter_dvs_noise {
 	bool hotPixelEnabled;
 	size_t hotPixelArraySize;
 	struct caer_filter_dvs_pixel *hotPixelArray;
+	// Same hot pixels as the array, one bit per pixel, for filtering.
+	uint64_t *hotPixelMap;
 	uint64_t hotPixelStatOn;
 	uint64_t hotPixelStatOff;
 	// Background Activity filter.
@@ -33,7 +98,36 @@ struct caer_filter_dvs_noise {
 	// Maps and their sizes.
 	uint16_t sizeX;
 	uint16_t sizeY;
-	int64_t timestampsMap[];
+	// Timestamp map, split into bands of rows, see struct dvs_noise_band.
+	// Its rows have one more entry on each side of the sensor, as border,
+	// and are laid out one after the other or in tiles, see mapIndex().
+	uint8_t timestampsMapLayout;
+	uint32_t *timestampsMap;
+	size_t timestampsMapColumns;
+	// Map offsets of a pixel's eight neighbors, row by row, for each position
+	// of the pixel within a tile. With rows, they are the same for all positions.
+	ptrdiff_t neighborOffsets[DVS_NOISE_TILE_POSITIONS][8];
+	// Multi-threaded filtering.
+	uint8_t threads;
+	size_t bandsNumber;
+	struct dvs_noise_band *bands;
+	// For each row, the band owning it and the band having it as halo row, if any.
+	uint8_t (*rowBands)[2];
+	mtx_t bandsDoneLock;
+	cnd_t bandsDoneCond;
+	size_t bandsPending;
+	// Current filtering run, read-only for the bands while it lasts.
+	caerPolarityEventPacket runPacket;
+	bool runStatisticsOnly;
+	bool runDense;
+	int32_t runStart;
+	int32_t runEnd;
+	// Events to invalidate once all bands are done, when filtering with multiple threads.
+	uint8_t *runInvalidate;
+	size_t runInvalidateSize;
+	// Storage for the bands' event lists, when filtering with multiple threads.
+	int32_t *runEvents;
+	size_t runEventsSize;
 };
 
 struct dvs_pixel_with_count {
@@ -41,16 +135,38 @@ struct dvs_pixel_with_count {
 	uint32_t count;
 };
 
-#define GET_TS(X)          ((X) >> 1)
+#define GET_TS(X)          I32T((X) >> 1)
 #define GET_POL(X)         ((X) &0x01)
-#define SET_TSPOL(TS, POL) (((TS) << 1) | ((POL) &0x01))
+#define SET_TSPOL(TS, POL) ((U32T(TS) << 1) | ((POL) &0x01))
+// Initial map content: timestamp zero, OFF polarity, for a band based at zero.
+#define DVS_NOISE_TS_ZERO SET_TSPOL(DVS_NOISE_TS_BIAS, 0)
+
+// Map column and row, relative to a pixel's column and row minus one, of its
+// eight neighbors, row by row.
+static const uint8_t neighborColumns[8] = {0, 1, 2, 0, 2, 0, 1, 2};
+static const uint8_t neighborRows[8]    = {0, 0, 0, 1, 1, 2, 2, 2};
 
 static void filterDVSNoiseLog(enum caer_log_level logLevel, caerFilterDVSNoise handle, const char *format, ...)
 	ATTRIBUTE_FORMAT(3);
 static int hotPixelArrayCountCompare(const void *a, const void *b);
 static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter);
+static int32_t hotPixelLearningCount(caerFilterDVSNoise noiseFilter, caerPolarityEventPacketConst polarityPacket,
+	int32_t eventStart, bool *learningDone);
+static inline size_t hotPixelMapWords(caerFilterDVSNoise noiseFilter);
 static void caerFilterDVSNoiseApplyInternal(
 	caerFilterDVSNoise noiseFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly);
+static void filterEvents(caerFilterDVSNoise noiseFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly,
+	int32_t eventStart, int32_t eventEnd);
+static bool bandsEventsAssign(caerFilterDVSNoise noiseFilter, caerPolarityEventPacketConst polarityPacket,
+	int32_t eventStart, int32_t eventEnd);
+static void filterBandEvents(struct dvs_noise_band *band);
+static int filterBandThread(void *bandPtr);
+static bool bandsSetup(caerFilterDVSNoise noiseFilter, size_t threads);
+static void bandsThreadsStop(caerFilterDVSNoise noiseFilter);
+static inline size_t mapIndex(caerFilterDVSNoise noiseFilter, size_t mapX, size_t mapY);
+static size_t bandMapIndex(caerFilterDVSNoise noiseFilter, const struct dvs_noise_band *band, size_t x, size_t y);
+static void bandsMapClear(caerFilterDVSNoise noiseFilter, struct dvs_noise_band *bands, size_t bandsNumber);
+static void bandRebase(struct dvs_noise_band *band, int64_t timestamp);
 
 static void filterDVSNoiseLog(enum caer_log_level logLevel, caerFilterDVSNoise handle, const char *format, ...) {
 	// Only log messages above the specified severity level.
@@ -67,8 +183,15 @@ static void filterDVSNoiseLog(enum caer_log_level logLevel, caerFilterDVSNoise h
 }
 
 caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY) {
-	caerFilterDVSNoise noiseFilter
-		= calloc(1, sizeof(struct caer_filter_dvs_noise) + ((size_t) sizeX * (size_t) sizeY * sizeof(int64_t)));
+	return (caerFilterDVSNoiseInitializeLayout(sizeX, sizeY, CAER_FILTER_DVS_MAP_LAYOUT_ROWS));
+}
+
+caerFilterDVSNoise caerFilterDVSNoiseInitializeLayout(uint16_t sizeX, uint16_t sizeY, uint8_t mapLayout) {
+	if ((mapLayout != CAER_FILTER_DVS_MAP_LAYOUT_ROWS) && (mapLayout != CAER_FILTER_DVS_MAP_LAYOUT_TILES)) {
+		return (NULL);
+	}
+
+	caerFilterDVSNoise noiseFilter = calloc(1, sizeof(struct caer_filter_dvs_noise));
 	if (noiseFilter == NULL) {
 		return (NULL);
 	}
@@ -76,6 +199,33 @@ caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY)
 	noiseFilter->sizeX = sizeX;
 	noiseFilter->sizeY = sizeY;
 
+	noiseFilter->hotPixelMap = calloc(hotPixelMapWords(noiseFilter), sizeof(uint64_t));
+	if (noiseFilter->hotPixelMap == NULL) {
+		free(noiseFilter);
+		return (NULL);
+	}
+
+	noiseFilter->timestampsMapLayout  = mapLayout;
+	noiseFilter->timestampsMapColumns = (size_t) sizeX + 2;
+
+	if (mapLayout == CAER_FILTER_DVS_MAP_LAYOUT_TILES) {
+		noiseFilter->timestampsMapColumns
+			= DVS_NOISE_ALIGN_UP(noiseFilter->timestampsMapColumns, (size_t) DVS_NOISE_TILE_SIZE);
+	}
+
+	// Offsets from a pixel away from the map's start, the same as for any other
+	// pixel at the same position within its tile.
+	for (size_t i = 0; i < DVS_NOISE_TILE_POSITIONS; i++) {
+		size_t mapX = DVS_NOISE_TILE_SIZE + (i % DVS_NOISE_TILE_SIZE);
+		size_t mapY = DVS_NOISE_TILE_SIZE + (i / DVS_NOISE_TILE_SIZE);
+
+		for (size_t j = 0; j < 8; j++) {
+			noiseFilter->neighborOffsets[i][j]
+				= (ptrdiff_t) mapIndex(noiseFilter, mapX + neighborColumns[j] - 1, mapY + neighborRows[j] - 1)
+				  - (ptrdiff_t) mapIndex(noiseFilter, mapX, mapY);
+		}
+	}
+
 	// Default to global log-level.
 	enum caer_log_level logLevel = caerLogLevelGet();
 	noiseFilter->logLevel        = U8T(logLevel);
@@ -90,154 +240,123 @@ caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY)
 	noiseFilter->backgroundActivitySupportMax    = 8;       // At most eight pixels can support.
 	noiseFilter->backgroundActivityTime          = 2000;    // 2 milliseconds within neighborhood.
 
-	return (noiseFilter);
-}
-
-static inline size_t doBackgroundActivityLookup(caerFilterDVSNoise noiseFilter, size_t x, size_t y, size_t pixelIndex,
-	int64_t timestamp, bool polarity, size_t *supportIndexes) {
-	// Compute map limits.
-	bool notBorderLeft  = (x != 0);
-	bool notBorderDown  = (y != (size_t) (noiseFilter->sizeY - 1));
-	bool notBorderRight = (x != (size_t) (noiseFilter->sizeX - 1));
-	bool notBorderUp    = (y != 0);
-
-	// Background Activity filter: if difference between current timestamp
-	// and stored neighbor timestamp is smaller than given time limit, it
-	// means the event is supported by a neighbor and thus valid. If it is
-	// bigger, then the event is not supported, and we need to check the
-	// next neighbor. If all are bigger, the event is invalid.
-	size_t result = 0;
-
-	{
-		if (notBorderLeft) {
-			pixelIndex--;
-
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
-
-			pixelIndex++;
-		}
-
-		if (notBorderRight) {
-			pixelIndex++;
-
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+	if (mtx_init(&noiseFilter->bandsDoneLock, mtx_plain) != thrd_success) {
+		free(noiseFilter->hotPixelMap);
+		free(noiseFilter);
+		return (NULL);
+	}
 
-			pixelIndex--;
-		}
+	if (cnd_init(&noiseFilter->bandsDoneCond) != thrd_success) {
+		mtx_destroy(&noiseFilter->bandsDoneLock);
+		free(noiseFilter->hotPixelMap);
+		free(noiseFilter);
+		return (NULL);
 	}
 
-	if (notBorderUp) {
-		pixelIndex -= noiseFilter->sizeX; // Previous row.
+	// Single band, filtered by the calling thread.
+	if (!bandsSetup(noiseFilter, 1)) {
+		cnd_destroy(&noiseFilter->bandsDoneCond);
+		mtx_destroy(&noiseFilter->bandsDoneLock);
+		free(noiseFilter->hotPixelMap);
+		free(noiseFilter);
+		return (NULL);
+	}
 
-		if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-			if (!noiseFilter->backgroundActivityCheckPolarity
-				|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-				if (supportIndexes != NULL) {
-					supportIndexes[result] = pixelIndex;
-				}
-				result++;
-			}
-		}
+	return (noiseFilter);
+}
 
-		if (notBorderLeft) {
-			pixelIndex--;
+// Background Activity filter: if difference between current timestamp
+// and stored neighbor timestamp is smaller than given time limit, it
+// means the event is supported by that neighbor.
+static inline uint32_t doBackgroundActivityCheck(
+	uint32_t neighbor, int32_t timestamp, int32_t time, uint32_t polarity, uint32_t polarityMask) {
+	return (U32T((timestamp - GET_TS(neighbor)) < time) & U32T(((neighbor ^ polarity) & polarityMask) == 0));
+}
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+// Rows are laid out one after the other. Tiles hold 4x4 entries, each 4 entries
+// of a row followed by the same 4 of the next rows, and are laid out one after the
+// other, tile row by tile row. A pixel's neighbors are then in one cache line for
+// a quarter of the pixels, in two for half of them and in four for the rest.
+static inline size_t mapIndexLayout(caerFilterDVSNoise noiseFilter, uint8_t layout, size_t mapX, size_t mapY) {
+	if (layout == CAER_FILTER_DVS_MAP_LAYOUT_TILES) {
+		return (((mapY / DVS_NOISE_TILE_SIZE) * noiseFilter->timestampsMapColumns * DVS_NOISE_TILE_SIZE)
+				+ ((mapX / DVS_NOISE_TILE_SIZE) * DVS_NOISE_TILE_POSITIONS)
+				+ ((mapY % DVS_NOISE_TILE_SIZE) * DVS_NOISE_TILE_SIZE) + (mapX % DVS_NOISE_TILE_SIZE));
+	}
 
-			pixelIndex++;
-		}
+	return ((mapY * noiseFilter->timestampsMapColumns) + mapX);
+}
 
-		if (notBorderRight) {
-			pixelIndex++;
+static inline size_t mapIndex(caerFilterDVSNoise noiseFilter, size_t mapX, size_t mapY) {
+	return (mapIndexLayout(noiseFilter, noiseFilter->timestampsMapLayout, mapX, mapY));
+}
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+// Position of a map entry within its tile, to select its neighborOffsets.
+// With rows, all positions have the same offsets, the first ones are used.
+static inline size_t mapTilePosition(uint8_t layout, size_t mapX, size_t mapY) {
+	if (layout == CAER_FILTER_DVS_MAP_LAYOUT_TILES) {
+		return (((mapY % DVS_NOISE_TILE_SIZE) * DVS_NOISE_TILE_SIZE) + (mapX % DVS_NOISE_TILE_SIZE));
+	}
 
-			pixelIndex--;
-		}
+	return (0);
+}
 
-		pixelIndex += noiseFilter->sizeX; // Back to middle row.
+// All eight neighbors are checked without branches, the map's border never
+// supporting any event, and the supporting ones are returned as a mask, bit
+// i standing for the neighbor at neighborOffsets[i]. With rows, the offsets
+// follow from the row size, so they are not even loaded.
+static inline uint32_t doBackgroundActivityLookup(caerFilterDVSNoise noiseFilter, uint8_t layout,
+	const uint32_t *pixel, const ptrdiff_t neighborOffsets[8], int32_t timestamp, bool polarity) {
+	int32_t time          = I32T(noiseFilter->backgroundActivityTime);
+	uint32_t pol          = U32T(polarity);
+	uint32_t polarityMask = (noiseFilter->backgroundActivityCheckPolarity) ? (0x01) : (0x00);
+	uint32_t supportMask  = 0;
+
+	if (layout == CAER_FILTER_DVS_MAP_LAYOUT_ROWS) {
+		const uint32_t *rowUp   = pixel - noiseFilter->timestampsMapColumns;
+		const uint32_t *rowDown = pixel + noiseFilter->timestampsMapColumns;
+
+		return (doBackgroundActivityCheck(rowUp[-1], timestamp, time, pol, polarityMask)
+				| (doBackgroundActivityCheck(rowUp[0], timestamp, time, pol, polarityMask) << 1)
+				| (doBackgroundActivityCheck(rowUp[1], timestamp, time, pol, polarityMask) << 2)
+				| (doBackgroundActivityCheck(pixel[-1], timestamp, time, pol, polarityMask) << 3)
+				| (doBackgroundActivityCheck(pixel[1], timestamp, time, pol, polarityMask) << 4)
+				| (doBackgroundActivityCheck(rowDown[-1], timestamp, time, pol, polarityMask) << 5)
+				| (doBackgroundActivityCheck(rowDown[0], timestamp, time, pol, polarityMask) << 6)
+				| (doBackgroundActivityCheck(rowDown[1], timestamp, time, pol, polarityMask) << 7));
 	}
 
-	if (notBorderDown) {
-		pixelIndex += noiseFilter->sizeX; // Next row.
-
-		if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-			if (!noiseFilter->backgroundActivityCheckPolarity
-				|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-				if (supportIndexes != NULL) {
-					supportIndexes[result] = pixelIndex;
-				}
-				result++;
-			}
-		}
+	for (size_t i = 0; i < 8; i++) {
+		supportMask |= doBackgroundActivityCheck(pixel[neighborOffsets[i]], timestamp, time, pol, polarityMask) << i;
+	}
 
-		if (notBorderLeft) {
-			pixelIndex--;
+	return (supportMask);
+}
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
+static inline size_t supportPixelsCount(uint32_t supportMask) {
+	// Count the bits set, summing them two, four and then eight at a time.
+	supportMask = (supportMask & 0x55) + ((supportMask >> 1) & 0x55);
+	supportMask = (supportMask & 0x33) + ((supportMask >> 2) & 0x33);
+	supportMask = (supportMask & 0x0F) + ((supportMask >> 4) & 0x0F);
 
-			pixelIndex++;
-		}
+	return (supportMask);
+}
 
-		if (notBorderRight) {
-			pixelIndex++;
+// Move a map entry to a base later by shift. Timestamps that fall out of
+// the encodable range expire, as do all when moving to an earlier base.
+static inline uint32_t timestampShift(uint32_t entry, int64_t shift) {
+	int64_t timestamp = I64T(GET_TS(entry)) - shift;
 
-			if ((timestamp - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->backgroundActivityTime) {
-				if (!noiseFilter->backgroundActivityCheckPolarity
-					|| polarity == GET_POL(noiseFilter->timestampsMap[pixelIndex])) {
-					if (supportIndexes != NULL) {
-						supportIndexes[result] = pixelIndex;
-					}
-					result++;
-				}
-			}
-		}
+	if ((shift < 0) || (timestamp <= 0)) {
+		return (DVS_NOISE_TS_EXPIRED);
 	}
 
-	return (result);
+	return (SET_TSPOL(timestamp, GET_POL(entry)));
 }
 
 void caerFilterDVSNoiseDestroy(caerFilterDVSNoise noiseFilter) {
+	bandsThreadsStop(noiseFilter);
+
 	// Ensure hot pixel map is also destroyed if still present,
 	// for example if learning never terminated.
 	if (noiseFilter->hotPixelLearningMap != NULL) {
@@ -249,6 +368,17 @@ void caerFilterDVSNoiseDestroy(caerFilterDVSNoise noiseFilter) {
 		free(noiseFilter->hotPixelArray);
 	}
 
+	free(noiseFilter->hotPixelMap);
+
+	free(noiseFilter->runInvalidate);
+	free(noiseFilter->runEvents);
+	free(noiseFilter->rowBands);
+	free(noiseFilter->bands);
+	portable_aligned_free(noiseFilter->timestampsMap);
+
+	cnd_destroy(&noiseFilter->bandsDoneCond);
+	mtx_destroy(&noiseFilter->bandsDoneLock);
+
 	free(noiseFilter);
 }
 
@@ -293,22 +423,39 @@ static void caerFilterDVSNoiseApplyInternal(
 		}
 	}
 
-	CAER_POLARITY_ITERATOR_VALID_START(polarityPacket)
-	uint16_t x        = caerPolarityEventGetX(caerPolarityIteratorElement);
-	uint16_t y        = caerPolarityEventGetY(caerPolarityIteratorElement);
-	bool pol          = caerPolarityEventGetPolarity(caerPolarityIteratorElement);
-	int64_t ts        = caerPolarityEventGetTimestamp64(caerPolarityIteratorElement, polarityPacket);
-	size_t pixelIndex = (y * (size_t) noiseFilter->sizeX) + x; // Target pixel.
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&polarityPacket->packetHeader);
 
 	// Hot Pixel learning: determine which pixels are abnormally active,
 	// by counting how many times they spike in a given time period. The
 	// ones above a given threshold will be considered "hot".
-	// This is done first, so that other filters (including the Hot Pixel
-	// filter itself) don't influence the learning operation.
+	// This only depends on the event addresses, so it's done first, up to
+	// the next event that changes the hot pixels, and doesn't influence the
+	// other filters until the new hot pixels are in place: the events before
+	// it are filtered with the current hot pixels, the others after the new
+	// ones are in place. With incremental learning, that's each event with
+	// which a pixel becomes hot, else the one that ends the learning.
 	if (noiseFilter->hotPixelLearningStarted) {
-		noiseFilter->hotPixelLearningMap[pixelIndex]++;
+		int32_t filterStart = 0;
+		bool learningDone   = false;
+		int32_t learningEnd = hotPixelLearningCount(noiseFilter, polarityPacket, 0, &learningDone);
+
+		while ((learningEnd < eventNumber) && !learningDone) {
+			filterEvents(noiseFilter, polarityPacket, statisticsOnly, filterStart, learningEnd);
+
+			// Incremental learning: the pixel is filtered out from this event on.
+			caerPolarityEventConst event = caerPolarityEventPacketGetEventConst(polarityPacket, learningEnd);
+			size_t pixelIndex
+				= (caerPolarityEventGetY(event) * (size_t) noiseFilter->sizeX) + caerPolarityEventGetX(event);
+
+			noiseFilter->hotPixelMap[pixelIndex / 64] |= (UINT64_C(1) << (pixelIndex % 64));
+
+			filterStart = learningEnd;
+			learningEnd = hotPixelLearningCount(noiseFilter, polarityPacket, learningEnd + 1, &learningDone);
+		}
+
+		if (learningDone) {
+			filterEvents(noiseFilter, polarityPacket, statisticsOnly, filterStart, learningEnd);
 
-		if (ts > (noiseFilter->hotPixelLearningStartTime + noiseFilter->hotPixelTime)) {
 			// Enough time has passed, we can proceed with data evaluation.
 			hotPixelGenerateArray(noiseFilter);
 
@@ -319,103 +466,685 @@ static void caerFilterDVSNoiseApplyInternal(
 			noiseFilter->hotPixelLearningStarted = false;
 			noiseFilter->hotPixelLearn           = false;
 
-			filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter, "HotPixel Learning: completed on ts=%" PRIi64 ".", ts);
+			filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter, "HotPixel Learning: completed on ts=%" PRIi64 ".",
+				caerPolarityEventGetTimestamp64(
+					caerPolarityEventPacketGetEventConst(polarityPacket, learningEnd), polarityPacket));
+
+			filterEvents(noiseFilter, polarityPacket, statisticsOnly, learningEnd, eventNumber);
+			return;
 		}
+
+		filterEvents(noiseFilter, polarityPacket, statisticsOnly, filterStart, eventNumber);
+		return;
 	}
 
-	// Hot Pixel filter: filter out abnormally active pixels by their address.
-	if (noiseFilter->hotPixelEnabled) {
-		bool filteredOut = false;
+	filterEvents(noiseFilter, polarityPacket, statisticsOnly, 0, eventNumber);
+}
 
-		for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
-			if ((x == noiseFilter->hotPixelArray[i].x) && (y == noiseFilter->hotPixelArray[i].y)) {
-				if (!statisticsOnly) {
-					caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
+// Count the valid events of the packet per pixel, from eventStart on, until enough
+// time has passed for the learning to end, setting learningDone, or, with incremental
+// learning, until a pixel becomes hot. Returns the index of that event, or the
+// packet's event number if there is none.
+static int32_t hotPixelLearningCount(caerFilterDVSNoise noiseFilter, caerPolarityEventPacketConst polarityPacket,
+	int32_t eventStart, bool *learningDone) {
+	int64_t learningEndTime = noiseFilter->hotPixelLearningStartTime + noiseFilter->hotPixelTime;
+	int32_t eventNumber     = caerEventPacketHeaderGetEventNumber(&polarityPacket->packetHeader);
+
+	for (int32_t i = eventStart; i < eventNumber; i++) {
+		caerPolarityEventConst event = caerPolarityEventPacketGetEventConst(polarityPacket, i);
+
+		if (!caerPolarityEventIsValid(event)) {
+			continue; // Skip invalid polarity events.
+		}
+
+		uint16_t x        = caerPolarityEventGetX(event);
+		uint16_t y        = caerPolarityEventGetY(event);
+		int64_t ts        = caerPolarityEventGetTimestamp64(event, polarityPacket);
+		size_t pixelIndex = (y * (size_t) noiseFilter->sizeX) + x; // Target pixel.
+
+		noiseFilter->hotPixelLearningMap[pixelIndex]++;
+
+		if (ts > learningEndTime) {
+			*learningDone = true;
+			return (i);
+		}
+
+		// Incremental learning: filter out pixels as soon as they are hot,
+		// instead of only once the whole learning time is over.
+		if (noiseFilter->hotPixelLearnIncremental
+			&& (noiseFilter->hotPixelLearningMap[pixelIndex] == noiseFilter->hotPixelCount)) {
+			return (i);
+		}
+	}
+
+	return (eventNumber);
+}
+
+static inline size_t hotPixelMapWords(caerFilterDVSNoise noiseFilter) {
+	return ((((size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY) + 63) / 64);
+}
+
+static inline bool hotPixelIsListed(caerFilterDVSNoise noiseFilter, uint16_t x, uint16_t y) {
+	size_t pixelIndex = (y * (size_t) noiseFilter->sizeX) + x;
+
+	return (((noiseFilter->hotPixelMap[pixelIndex / 64] >> (pixelIndex % 64)) & 0x01) != 0);
+}
+
+// Filter the events from eventStart to eventEnd (excluded), each band in its own thread.
+static void filterEvents(caerFilterDVSNoise noiseFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly,
+	int32_t eventStart, int32_t eventEnd) {
+	if (eventStart >= eventEnd) {
+		return;
+	}
+
+	// With multiple bands, the packet must stay untouched while they run, as
+	// each band also goes through the events of its neighbors: invalidated
+	// events are only marked, and then invalidated all together at the end.
+	bool multipleBands = (noiseFilter->bandsNumber > 1);
+
+	if (multipleBands && !bandsEventsAssign(noiseFilter, polarityPacket, eventStart, eventEnd)) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter,
+			"Failed to allocate memory for multi-threaded filtering, packet not filtered.");
+		return;
+	}
+
+	if (multipleBands && !statisticsOnly) {
+		size_t runInvalidateSize = (size_t) eventEnd;
+
+		if (runInvalidateSize > noiseFilter->runInvalidateSize) {
+			uint8_t *runInvalidate = realloc(noiseFilter->runInvalidate, runInvalidateSize);
+			if (runInvalidate == NULL) {
+				filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter,
+					"Failed to allocate memory for multi-threaded filtering, packet not filtered.");
+				return;
+			}
+
+			noiseFilter->runInvalidate     = runInvalidate;
+			noiseFilter->runInvalidateSize = runInvalidateSize;
+		}
+
+		memset(&noiseFilter->runInvalidate[eventStart], 0, (size_t) (eventEnd - eventStart));
+	}
+
+	noiseFilter->runPacket         = polarityPacket;
+	noiseFilter->runStatisticsOnly = statisticsOnly;
+	noiseFilter->runDense          = caerEventPacketHeaderIsDense(&polarityPacket->packetHeader);
+	noiseFilter->runStart          = eventStart;
+	noiseFilter->runEnd            = eventEnd;
+
+	if (multipleBands) {
+		mtx_lock(&noiseFilter->bandsDoneLock);
+		noiseFilter->bandsPending = noiseFilter->bandsNumber - 1;
+		mtx_unlock(&noiseFilter->bandsDoneLock);
+
+		for (size_t i = 1; i < noiseFilter->bandsNumber; i++) {
+			struct dvs_noise_band *band = &noiseFilter->bands[i];
+
+			mtx_lock(&band->threadLock);
+			band->threadJob++;
+			cnd_signal(&band->threadCond);
+			mtx_unlock(&band->threadLock);
+		}
+	}
+
+	// The calling thread always filters the first band.
+	filterBandEvents(&noiseFilter->bands[0]);
+
+	if (multipleBands) {
+		mtx_lock(&noiseFilter->bandsDoneLock);
+
+		while (noiseFilter->bandsPending != 0) {
+			cnd_wait(&noiseFilter->bandsDoneCond, &noiseFilter->bandsDoneLock);
+		}
+
+		mtx_unlock(&noiseFilter->bandsDoneLock);
+
+		if (!statisticsOnly) {
+			for (int32_t i = eventStart; i < eventEnd; i++) {
+				if (noiseFilter->runInvalidate[i] != 0) {
+					caerPolarityEventInvalidate(caerPolarityEventPacketGetEvent(polarityPacket, i), polarityPacket);
 				}
-				if (pol) {
-					noiseFilter->hotPixelStatOn++;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < noiseFilter->bandsNumber; i++) {
+		struct dvs_noise_band *band = &noiseFilter->bands[i];
+
+		noiseFilter->hotPixelStatOn += band->hotPixelStatOn;
+		noiseFilter->hotPixelStatOff += band->hotPixelStatOff;
+		noiseFilter->backgroundActivityStatOn += band->backgroundActivityStatOn;
+		noiseFilter->backgroundActivityStatOff += band->backgroundActivityStatOff;
+		noiseFilter->refractoryPeriodStatOn += band->refractoryPeriodStatOn;
+		noiseFilter->refractoryPeriodStatOff += band->refractoryPeriodStatOff;
+
+		band->hotPixelStatOn            = 0;
+		band->hotPixelStatOff           = 0;
+		band->backgroundActivityStatOn  = 0;
+		band->backgroundActivityStatOff = 0;
+		band->refractoryPeriodStatOn    = 0;
+		band->refractoryPeriodStatOff   = 0;
+	}
+}
+
+// Sort the valid events of the run by band, keeping their order: each band gets
+// the indexes of the events in its own rows and in its halo rows, so that its
+// thread only goes through those. Events are counted first, so that all lists
+// fit one after the other into one array, as each event is in at most two.
+static bool bandsEventsAssign(caerFilterDVSNoise noiseFilter, caerPolarityEventPacketConst polarityPacket,
+	int32_t eventStart, int32_t eventEnd) {
+	size_t runEventsSize = 2 * (size_t) (eventEnd - eventStart);
+
+	if (runEventsSize > noiseFilter->runEventsSize) {
+		int32_t *runEvents = realloc(noiseFilter->runEvents, runEventsSize * sizeof(int32_t));
+		if (runEvents == NULL) {
+			return (false);
+		}
+
+		noiseFilter->runEvents     = runEvents;
+		noiseFilter->runEventsSize = runEventsSize;
+	}
+
+	struct dvs_noise_band *bands = noiseFilter->bands;
+	bool dense                   = caerEventPacketHeaderIsDense(&polarityPacket->packetHeader);
+
+	for (size_t i = 0; i < noiseFilter->bandsNumber; i++) {
+		bands[i].runEventsNumber = 0;
+	}
+
+	for (int32_t i = eventStart; i < eventEnd; i++) {
+		caerPolarityEventConst event = caerPolarityEventPacketGetEventConst(polarityPacket, i);
+
+		if (!dense && !caerPolarityEventIsValid(event)) {
+			continue; // Skip invalid polarity events.
+		}
+
+		const uint8_t *rowBands = noiseFilter->rowBands[caerPolarityEventGetY(event)];
+
+		bands[rowBands[0]].runEventsNumber++;
+
+		if (rowBands[1] != DVS_NOISE_BAND_NONE) {
+			bands[rowBands[1]].runEventsNumber++;
+		}
+	}
+
+	size_t runEventsOffset = 0;
+
+	for (size_t i = 0; i < noiseFilter->bandsNumber; i++) {
+		bands[i].runEvents = &noiseFilter->runEvents[runEventsOffset];
+
+		runEventsOffset += bands[i].runEventsNumber;
+		bands[i].runEventsNumber = 0;
+	}
+
+	for (int32_t i = eventStart; i < eventEnd; i++) {
+		caerPolarityEventConst event = caerPolarityEventPacketGetEventConst(polarityPacket, i);
+
+		if (!dense && !caerPolarityEventIsValid(event)) {
+			continue; // Skip invalid polarity events.
+		}
+
+		const uint8_t *rowBands = noiseFilter->rowBands[caerPolarityEventGetY(event)];
+
+		bands[rowBands[0]].runEvents[bands[rowBands[0]].runEventsNumber++] = i;
+
+		if (rowBands[1] != DVS_NOISE_BAND_NONE) {
+			bands[rowBands[1]].runEvents[bands[rowBands[1]].runEventsNumber++] = i;
+		}
+	}
+
+	return (true);
+}
+
+// Filter the events of the current run that fall into the band's own rows, and
+// update its halo rows with the events falling into them. Those are exactly the
+// timestamps their own band writes, as only hot pixels don't update the map.
+// A single band goes through all events, multiple ones through their own lists.
+// The map layout is a constant for each call in filterBandEvents(), so that each
+// one gets its own loop, with the map addressing inlined.
+static inline void filterBandEventsLayout(struct dvs_noise_band *band, uint8_t layout) {
+	caerFilterDVSNoise noiseFilter         = band->noiseFilter;
+	caerPolarityEventPacket polarityPacket = noiseFilter->runPacket;
+	bool statisticsOnly                    = noiseFilter->runStatisticsOnly;
+	bool multipleBands                     = (noiseFilter->bandsNumber > 1);
+	uint32_t *timestampsMap                = band->timestampsMap;
+	int32_t refractoryPeriodTime           = I32T(noiseFilter->refractoryPeriodTime);
+
+	// Band map rows, in rows offset by DVS_NOISE_HALO_ROWS, see mapY below: they
+	// go from DVS_NOISE_HALO_ROWS rows above to as many below the band's own rows.
+	size_t mapRowStart = (size_t) band->rowStart;
+
+	size_t eventsNumber
+		= (multipleBands) ? (band->runEventsNumber) : ((size_t) (noiseFilter->runEnd - noiseFilter->runStart));
+
+	for (size_t n = 0; n < eventsNumber; n++) {
+		int32_t i               = (multipleBands) ? (band->runEvents[n]) : (noiseFilter->runStart + I32T(n));
+		caerPolarityEvent event = caerPolarityEventPacketGetEvent(polarityPacket, i);
+
+		// Events invalidated while filtering are always behind the current one,
+		// so the packet's density at the start tells if all events are valid.
+		// Multiple bands only get valid events.
+		if (!multipleBands && !noiseFilter->runDense && !caerPolarityEventIsValid(event)) {
+			continue; // Skip invalid polarity events.
+		}
+
+		uint16_t y = caerPolarityEventGetY(event);
+
+		// Offset by the halo rows, to not go below zero for the first band.
+		size_t mapY = (size_t) y + DVS_NOISE_HALO_ROWS;
+
+		uint16_t x = caerPolarityEventGetX(event);
+		bool pol   = caerPolarityEventGetPolarity(event);
+		int64_t ts = caerPolarityEventGetTimestamp64(event, polarityPacket);
+
+		// Target pixel, in the band's map, after the border column.
+		size_t pixelX     = (size_t) x + 1;
+		size_t pixelY     = mapY - mapRowStart;
+		size_t pixelIndex = mapIndexLayout(noiseFilter, layout, pixelX, pixelY);
+
+		// Timestamp as stored in the map, relative to the band's base.
+		int64_t tsRelative = ts - band->timestampBase;
+
+		if (U64T(tsRelative + DVS_NOISE_TS_RANGE) >= U64T(2 * DVS_NOISE_TS_RANGE)) {
+			bandRebase(band, ts);
+			tsRelative = 0;
+		}
+
+		int32_t tsMap = I32T(tsRelative + DVS_NOISE_TS_BIAS);
+
+		if ((y < band->rowStart) || (y >= band->rowEnd)) {
+			// Halo row: only keep the timestamp map in sync with the neighbor band.
+			if (!noiseFilter->hotPixelEnabled || !hotPixelIsListed(noiseFilter, x, y)) {
+				timestampsMap[pixelIndex] = SET_TSPOL(tsMap, pol);
+			}
+
+			continue;
+		}
+
+		// Hot Pixel filter: filter out abnormally active pixels by their address.
+		if (noiseFilter->hotPixelEnabled && hotPixelIsListed(noiseFilter, x, y)) {
+			if (!statisticsOnly) {
+				if (multipleBands) {
+					noiseFilter->runInvalidate[i] = 1;
 				}
 				else {
-					noiseFilter->hotPixelStatOff++;
+					caerPolarityEventInvalidate(event, polarityPacket);
 				}
-
-				filteredOut = true;
-				break;
 			}
-		}
+			if (pol) {
+				band->hotPixelStatOn++;
+			}
+			else {
+				band->hotPixelStatOff++;
+			}
 
-		if (filteredOut) {
 			// Go to next event, don't execute other filters and don't
 			// update timestamps map. Hot pixels don't provide any useful
 			// timing information, as they are repeating noise.
 			continue;
 		}
-	}
 
-	// Refractory Period filter.
-	// Execute before BAFilter, as this is a much simpler check, so if we
-	// can we try to eliminate the event early in a less costly manner.
-	if (noiseFilter->refractoryPeriodEnabled) {
-		if ((ts - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->refractoryPeriodTime) {
+		// Refractory Period filter.
+		// Execute before BAFilter, as this is a much simpler check, so if we
+		// can we try to eliminate the event early in a less costly manner.
+		if (noiseFilter->refractoryPeriodEnabled) {
+			if ((tsMap - GET_TS(timestampsMap[pixelIndex])) < refractoryPeriodTime) {
+				if (!statisticsOnly) {
+					if (multipleBands) {
+						noiseFilter->runInvalidate[i] = 1;
+					}
+					else {
+						caerPolarityEventInvalidate(event, polarityPacket);
+					}
+				}
+				if (pol) {
+					band->refractoryPeriodStatOn++;
+				}
+				else {
+					band->refractoryPeriodStatOff++;
+				}
+
+				goto WriteTimestamp;
+			}
+		}
+
+		if (noiseFilter->backgroundActivityEnabled) {
+			const uint32_t *pixel            = &timestampsMap[pixelIndex];
+			const ptrdiff_t *neighborOffsets = noiseFilter->neighborOffsets[mapTilePosition(layout, pixelX, pixelY)];
+			uint32_t supportMask
+				= doBackgroundActivityLookup(noiseFilter, layout, pixel, neighborOffsets, tsMap, pol);
+			size_t supportPixelNum = supportPixelsCount(supportMask);
+
+			if ((supportPixelNum >= noiseFilter->backgroundActivitySupportMin)
+				&& (supportPixelNum <= noiseFilter->backgroundActivitySupportMax)) {
+				if (noiseFilter->backgroundActivityTwoLevels) {
+					// Do the check again for all previously discovered supporting pixels.
+					// Those are never on the border, so their neighbors are all in the map.
+					// Only the set bits are visited, lowest first: its index is the number
+					// of bits below it, so that no branch depends on each neighbor's bit.
+					while (supportMask != 0) {
+						uint32_t supportBit = supportMask & (~supportMask + 1);
+						size_t j            = supportPixelsCount(supportBit - 1);
+						supportMask ^= supportBit;
+
+						size_t neighborPosition
+							= mapTilePosition(layout, pixelX + neighborColumns[j] - 1, pixelY + neighborRows[j] - 1);
+
+						if (doBackgroundActivityLookup(noiseFilter, layout, &pixel[neighborOffsets[j]],
+								noiseFilter->neighborOffsets[neighborPosition], tsMap, pol)
+							!= 0) {
+							goto WriteTimestamp;
+						}
+					}
+				}
+				else {
+					goto WriteTimestamp;
+				}
+			}
+
+			// Event is not supported by any neighbor if we get here, invalidate it.
+			// Then jump over the Refractory Period filter, as it's useless to
+			// execute it (and would cause a double-invalidate error).
 			if (!statisticsOnly) {
-				caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
+				if (multipleBands) {
+					noiseFilter->runInvalidate[i] = 1;
+				}
+				else {
+					caerPolarityEventInvalidate(event, polarityPacket);
+				}
 			}
 			if (pol) {
-				noiseFilter->refractoryPeriodStatOn++;
+				band->backgroundActivityStatOn++;
 			}
 			else {
-				noiseFilter->refractoryPeriodStatOff++;
+				band->backgroundActivityStatOff++;
 			}
+		}
+
+	WriteTimestamp:
+		// Update pixel timestamp (one write). Always update so filters are
+		// ready at enable-time right away.
+		timestampsMap[pixelIndex] = SET_TSPOL(tsMap, pol);
+	}
+}
+
+static void filterBandEvents(struct dvs_noise_band *band) {
+	if (band->noiseFilter->timestampsMapLayout == CAER_FILTER_DVS_MAP_LAYOUT_TILES) {
+		filterBandEventsLayout(band, CAER_FILTER_DVS_MAP_LAYOUT_TILES);
+	}
+	else {
+		filterBandEventsLayout(band, CAER_FILTER_DVS_MAP_LAYOUT_ROWS);
+	}
+}
+
+static int filterBandThread(void *bandPtr) {
+	struct dvs_noise_band *band    = bandPtr;
+	caerFilterDVSNoise noiseFilter = band->noiseFilter;
+	uint32_t threadJob             = 0;
+
+	thrd_set_name("DVSNoiseFilter");
+
+	while (true) {
+		mtx_lock(&band->threadLock);
+
+		while (band->threadRun && (band->threadJob == threadJob)) {
+			cnd_wait(&band->threadCond, &band->threadLock);
+		}
+
+		bool threadRun = band->threadRun;
+		threadJob      = band->threadJob;
+
+		mtx_unlock(&band->threadLock);
+
+		if (!threadRun) {
+			break;
+		}
+
+		filterBandEvents(band);
+
+		mtx_lock(&noiseFilter->bandsDoneLock);
+
+		noiseFilter->bandsPending--;
+		if (noiseFilter->bandsPending == 0) {
+			cnd_signal(&noiseFilter->bandsDoneCond);
+		}
+
+		mtx_unlock(&noiseFilter->bandsDoneLock);
+	}
+
+	return (EXIT_SUCCESS);
+}
+
+// Index of the sensor's pixel (x, y) in the band's map, y being in its own or halo rows.
+static size_t bandMapIndex(caerFilterDVSNoise noiseFilter, const struct dvs_noise_band *band, size_t x, size_t y) {
+	return (mapIndex(noiseFilter, x + 1, y + DVS_NOISE_HALO_ROWS - band->rowStart));
+}
 
-			goto WriteTimestamp;
+// Set all the sensor's pixels in the bands' maps to timestamp zero, like a
+// freshly zeroed 64 bit map. The border and the halo rows outside the sensor
+// stay expired.
+static void bandsMapClear(caerFilterDVSNoise noiseFilter, struct dvs_noise_band *bands, size_t bandsNumber) {
+	for (size_t i = 0; i < bandsNumber; i++) {
+		size_t rowStart = (bands[i].rowStart > DVS_NOISE_HALO_ROWS) ? (bands[i].rowStart - DVS_NOISE_HALO_ROWS) : (0);
+		size_t rowEnd   = (size_t) bands[i].rowEnd + DVS_NOISE_HALO_ROWS;
+
+		if (rowEnd > noiseFilter->sizeY) {
+			rowEnd = noiseFilter->sizeY;
+		}
+
+		for (size_t y = rowStart; y < rowEnd; y++) {
+			for (size_t x = 0; x < noiseFilter->sizeX; x++) {
+				bands[i].timestampsMap[bandMapIndex(noiseFilter, &bands[i], x, y)] = DVS_NOISE_TS_ZERO;
+			}
 		}
+
+		bands[i].timestampBase = 0;
+	}
+}
+
+// Move the band's map to a new base, the timestamp of an event too far from the current one.
+static void bandRebase(struct dvs_noise_band *band, int64_t timestamp) {
+	int64_t shift = timestamp - band->timestampBase;
+
+	for (size_t i = 0; i < band->timestampsMapSize; i++) {
+		band->timestampsMap[i] = timestampShift(band->timestampsMap[i], shift);
 	}
 
-	if (noiseFilter->backgroundActivityEnabled) {
-		size_t supportPixelIndexes[8];
-		size_t supportPixelNum
-			= doBackgroundActivityLookup(noiseFilter, x, y, pixelIndex, ts, pol, supportPixelIndexes);
+	band->timestampBase = timestamp;
+}
+
+// Split the timestamp map into one band per thread, keeping its content,
+// and start the worker threads. On failure, nothing is changed.
+static bool bandsSetup(caerFilterDVSNoise noiseFilter, size_t threads) {
+	size_t bandsNumber = noiseFilter->sizeY / DVS_NOISE_BAND_ROWS_MIN;
 
-		if ((supportPixelNum >= noiseFilter->backgroundActivitySupportMin)
-			&& (supportPixelNum <= noiseFilter->backgroundActivitySupportMax)) {
-			if (noiseFilter->backgroundActivityTwoLevels) {
-				// Do the check again for all previously discovered supporting pixels.
-				for (size_t i = 0; i < supportPixelNum; i++) {
-					size_t supportPixelIndex = supportPixelIndexes[i];
-					size_t supportPixelX     = supportPixelIndex % noiseFilter->sizeX;
-					size_t supportPixelY     = supportPixelIndex / noiseFilter->sizeX;
+	if (threads < bandsNumber) {
+		bandsNumber = threads;
+	}
+
+	if (bandsNumber == 0) {
+		bandsNumber = 1;
+	}
+
+	struct dvs_noise_band *bands = calloc(bandsNumber, sizeof(struct dvs_noise_band));
+	if (bands == NULL) {
+		return (false);
+	}
+
+	size_t rowStart          = 0;
+	size_t timestampsMapSize = 0;
+
+	for (size_t i = 0; i < bandsNumber; i++) {
+		// Spread the remaining rows over the first bands.
+		size_t bandRows = (noiseFilter->sizeY / bandsNumber) + ((i < (noiseFilter->sizeY % bandsNumber)) ? (1) : (0));
+		size_t mapRows  = bandRows + (2 * DVS_NOISE_HALO_ROWS);
+
+		// Each band's map starts on a new tile row.
+		if (noiseFilter->timestampsMapLayout == CAER_FILTER_DVS_MAP_LAYOUT_TILES) {
+			mapRows = DVS_NOISE_ALIGN_UP(mapRows, (size_t) DVS_NOISE_TILE_SIZE);
+		}
+
+		bands[i].noiseFilter       = noiseFilter;
+		bands[i].rowStart          = U16T(rowStart);
+		bands[i].rowEnd            = U16T(rowStart + bandRows);
+		bands[i].timestampsMapSize = mapRows * noiseFilter->timestampsMapColumns;
+
+		rowStart += bandRows;
+		timestampsMapSize += bands[i].timestampsMapSize;
+	}
 
-					if (doBackgroundActivityLookup(
-							noiseFilter, supportPixelX, supportPixelY, supportPixelIndex, ts, pol, NULL)
-						> 0) {
-						goto WriteTimestamp;
+	uint32_t *timestampsMap = portable_aligned_alloc(DVS_NOISE_TILE_ALIGNMENT, timestampsMapSize * sizeof(uint32_t));
+	if (timestampsMap == NULL) {
+		free(bands);
+		return (false);
+	}
+
+	// Zeroed memory is all expired, as needed for the border.
+	memset(timestampsMap, 0, timestampsMapSize * sizeof(uint32_t));
+
+	size_t mapOffset = 0;
+
+	for (size_t i = 0; i < bandsNumber; i++) {
+		bands[i].timestampsMap = &timestampsMap[mapOffset];
+
+		mapOffset += bands[i].timestampsMapSize;
+	}
+
+	// Bands have more rows than both halos together, so each row is in the
+	// halo rows of the band above or the one below it, if any, not both.
+	uint8_t(*rowBands)[2] = calloc(noiseFilter->sizeY, sizeof(*rowBands));
+	if (rowBands == NULL) {
+		free(bands);
+		portable_aligned_free(timestampsMap);
+		return (false);
+	}
+
+	for (size_t i = 0; i < bandsNumber; i++) {
+		for (size_t y = bands[i].rowStart; y < bands[i].rowEnd; y++) {
+			rowBands[y][0] = U8T(i);
+			rowBands[y][1] = DVS_NOISE_BAND_NONE;
+
+			if ((i > 0) && (y < ((size_t) bands[i].rowStart + DVS_NOISE_HALO_ROWS))) {
+				rowBands[y][1] = U8T(i - 1);
+			}
+			else if (((i + 1) < bandsNumber) && ((y + DVS_NOISE_HALO_ROWS) >= bands[i].rowEnd)) {
+				rowBands[y][1] = U8T(i + 1);
+			}
+		}
+	}
+
+	// Copy the current timestamps over, including into the halo rows, from the band owning each row.
+	// The new bands all take the latest base of the old ones, moving the timestamps to it.
+	if (noiseFilter->timestampsMap != NULL) {
+		int64_t timestampBase = noiseFilter->bands[0].timestampBase;
+
+		for (size_t i = 1; i < noiseFilter->bandsNumber; i++) {
+			if (noiseFilter->bands[i].timestampBase > timestampBase) {
+				timestampBase = noiseFilter->bands[i].timestampBase;
+			}
+		}
+
+		for (size_t i = 0; i < bandsNumber; i++) {
+			bands[i].timestampBase = timestampBase;
+		}
+
+		size_t oldBand = 0;
+
+		for (size_t y = 0; y < noiseFilter->sizeY; y++) {
+			while (y >= noiseFilter->bands[oldBand].rowEnd) {
+				oldBand++;
+			}
+
+			const struct dvs_noise_band *band = &noiseFilter->bands[oldBand];
+			int64_t shift                     = timestampBase - band->timestampBase;
+
+			for (size_t i = 0; i < bandsNumber; i++) {
+				if (((y + DVS_NOISE_HALO_ROWS) >= bands[i].rowStart)
+					&& (y < ((size_t) bands[i].rowEnd + DVS_NOISE_HALO_ROWS))) {
+					for (size_t x = 0; x < noiseFilter->sizeX; x++) {
+						bands[i].timestampsMap[bandMapIndex(noiseFilter, &bands[i], x, y)]
+							= timestampShift(band->timestampsMap[bandMapIndex(noiseFilter, band, x, y)], shift);
 					}
 				}
 			}
-			else {
-				goto WriteTimestamp;
-			}
 		}
+	}
+	else {
+		bandsMapClear(noiseFilter, bands, bandsNumber);
+	}
 
-		// Event is not supported by any neighbor if we get here, invalidate it.
-		// Then jump over the Refractory Period filter, as it's useless to
-		// execute it (and would cause a double-invalidate error).
-		if (!statisticsOnly) {
-			caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
+	// Start the worker threads, for all bands except the first one.
+	for (size_t i = 1; i < bandsNumber; i++) {
+		bands[i].threadRun = true;
+
+		if (mtx_init(&bands[i].threadLock, mtx_plain) != thrd_success) {
+			goto ThreadsFailure;
 		}
-		if (pol) {
-			noiseFilter->backgroundActivityStatOn++;
+
+		if (cnd_init(&bands[i].threadCond) != thrd_success) {
+			mtx_destroy(&bands[i].threadLock);
+			goto ThreadsFailure;
 		}
-		else {
-			noiseFilter->backgroundActivityStatOff++;
+
+		if (thrd_create(&bands[i].thread, &filterBandThread, &bands[i]) != thrd_success) {
+			cnd_destroy(&bands[i].threadCond);
+			mtx_destroy(&bands[i].threadLock);
+			goto ThreadsFailure;
+		}
+
+		continue;
+
+	ThreadsFailure:
+		// Stop the threads started so far.
+		for (size_t j = 1; j < i; j++) {
+			mtx_lock(&bands[j].threadLock);
+			bands[j].threadRun = false;
+			cnd_signal(&bands[j].threadCond);
+			mtx_unlock(&bands[j].threadLock);
+
+			thrd_join(bands[j].thread, NULL);
+
+			cnd_destroy(&bands[j].threadCond);
+			mtx_destroy(&bands[j].threadLock);
 		}
+
+		free(rowBands);
+		free(bands);
+		portable_aligned_free(timestampsMap);
+
+		return (false);
 	}
 
-WriteTimestamp:
-	// Update pixel timestamp (one write). Always update so filters are
-	// ready at enable-time right away.
-	noiseFilter->timestampsMap[pixelIndex] = SET_TSPOL(ts, pol);
-	CAER_POLARITY_ITERATOR_VALID_END
+	// Switch over to the new bands.
+	bandsThreadsStop(noiseFilter);
+
+	free(noiseFilter->rowBands);
+	free(noiseFilter->bands);
+	portable_aligned_free(noiseFilter->timestampsMap);
+
+	noiseFilter->rowBands      = rowBands;
+	noiseFilter->bands         = bands;
+	noiseFilter->bandsNumber   = bandsNumber;
+	noiseFilter->timestampsMap = timestampsMap;
+	noiseFilter->threads       = U8T(threads);
+
+	return (true);
+}
+
+static void bandsThreadsStop(caerFilterDVSNoise noiseFilter) {
+	for (size_t i = 1; i < noiseFilter->bandsNumber; i++) {
+		struct dvs_noise_band *band = &noiseFilter->bands[i];
+
+		mtx_lock(&band->threadLock);
+		band->threadRun = false;
+		cnd_signal(&band->threadCond);
+		mtx_unlock(&band->threadLock);
+
+		thrd_join(band->thread, NULL);
+
+		cnd_destroy(&band->threadCond);
+		mtx_destroy(&band->threadLock);
+	}
 }
 
 bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAddr, uint64_t param) {
@@ -424,6 +1153,10 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			noiseFilter->hotPixelLearn = param;
 			break;
 
+		case CAER_FILTER_DVS_HOTPIXEL_LEARN_INCREMENTAL:
+			noiseFilter->hotPixelLearnIncremental = param;
+			break;
+
 		case CAER_FILTER_DVS_HOTPIXEL_TIME:
 			noiseFilter->hotPixelTime = U32T(param);
 			break;
@@ -441,7 +1174,8 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			break;
 
 		case CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TIME:
-			noiseFilter->backgroundActivityTime = U32T(param);
+			// Longer times can't be told apart from expired timestamps, see DVS_NOISE_TS_RANGE.
+			noiseFilter->backgroundActivityTime = (param > DVS_NOISE_TIME_MAX) ? (DVS_NOISE_TIME_MAX) : (U32T(param));
 			break;
 
 		case CAER_FILTER_DVS_BACKGROUND_ACTIVITY_TWO_LEVELS:
@@ -465,13 +1199,28 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			break;
 
 		case CAER_FILTER_DVS_REFRACTORY_PERIOD_TIME:
-			noiseFilter->refractoryPeriodTime = U32T(param);
+			noiseFilter->refractoryPeriodTime = (param > DVS_NOISE_TIME_MAX) ? (DVS_NOISE_TIME_MAX) : (U32T(param));
 			break;
 
 		case CAER_FILTER_DVS_LOG_LEVEL:
 			noiseFilter->logLevel = U8T(param);
 			break;
 
+		case CAER_FILTER_DVS_THREADS:
+			if ((param == 0) || (param > DVS_NOISE_THREADS_MAX)) {
+				return (false);
+			}
+
+			if (param != noiseFilter->threads) {
+				if (!bandsSetup(noiseFilter, (size_t) param)) {
+					filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter,
+						"Failed to set up %" PRIu64 " threads for filtering, keeping %" PRIu8 ".", param,
+						noiseFilter->threads);
+					return (false);
+				}
+			}
+			break;
+
 		case CAER_FILTER_DVS_RESET:
 			if (param) {
 				// Reset hot pixel list and timestamp map.
@@ -481,8 +1230,9 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 					noiseFilter->hotPixelArray = NULL;
 				}
 
-				memset(noiseFilter->timestampsMap, 0,
-					(size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY * sizeof(int64_t));
+				memset(noiseFilter->hotPixelMap, 0, hotPixelMapWords(noiseFilter) * sizeof(uint64_t));
+
+				bandsMapClear(noiseFilter, noiseFilter->bands, noiseFilter->bandsNumber);
 
 				// Reset statistics to zero
 				noiseFilter->hotPixelStatOn            = 0;
@@ -512,6 +1262,10 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			*param = noiseFilter->hotPixelLearn;
 			break;
 
+		case CAER_FILTER_DVS_HOTPIXEL_LEARN_INCREMENTAL:
+			*param = noiseFilter->hotPixelLearnIncremental;
+			break;
+
 		case CAER_FILTER_DVS_HOTPIXEL_TIME:
 			*param = noiseFilter->hotPixelTime;
 			break;
@@ -596,6 +1350,14 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			*param = noiseFilter->logLevel;
 			break;
 
+		case CAER_FILTER_DVS_THREADS:
+			*param = noiseFilter->threads;
+			break;
+
+		case CAER_FILTER_DVS_MAP_LAYOUT:
+			*param = noiseFilter->timestampsMapLayout;
+			break;
+
 		default:
 			// Unrecognized or invalid parameter address.
 			return (false);
@@ -608,23 +1370,67 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 ssize_t caerFilterDVSNoiseGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilterDVSPixel *hotPixels) {
 	*hotPixels = NULL;
 
+	// The map holds the pixels of the array, plus those learned incrementally
+	// since it was generated, so go through its copy without the former.
+	size_t mapWords       = hotPixelMapWords(noiseFilter);
+	uint64_t *hotPixelMap = malloc(mapWords * sizeof(uint64_t));
+	if (hotPixelMap == NULL) {
+		// Memory allocation failure.
+		return (-1);
+	}
+
+	memcpy(hotPixelMap, noiseFilter->hotPixelMap, mapWords * sizeof(uint64_t));
+
+	for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
+		size_t pixelIndex
+			= (noiseFilter->hotPixelArray[i].y * (size_t) noiseFilter->sizeX) + noiseFilter->hotPixelArray[i].x;
+
+		hotPixelMap[pixelIndex / 64] &= ~(UINT64_C(1) << (pixelIndex % 64));
+	}
+
+	size_t hotPixelsNumber = noiseFilter->hotPixelArraySize;
+
+	for (size_t i = 0; i < mapWords; i++) {
+		for (uint64_t word = hotPixelMap[i]; word != 0; word &= (word - 1)) {
+			hotPixelsNumber++;
+		}
+	}
+
 	// No hot pixels listed.
-	if (noiseFilter->hotPixelArraySize == 0) {
+	if (hotPixelsNumber == 0) {
+		free(hotPixelMap);
 		return (0);
 	}
 
 	// Allocate memory for array copy.
-	*hotPixels = malloc(noiseFilter->hotPixelArraySize * sizeof(struct caer_filter_dvs_pixel));
+	*hotPixels = malloc(hotPixelsNumber * sizeof(struct caer_filter_dvs_pixel));
 	if (*hotPixels == NULL) {
 		// Memory allocation failure.
+		free(hotPixelMap);
 		return (-1);
 	}
 
-	// Copy pixel array over.
+	// Copy pixel array over, then add the incrementally learned pixels.
 	memcpy(
 		*hotPixels, noiseFilter->hotPixelArray, noiseFilter->hotPixelArraySize * sizeof(struct caer_filter_dvs_pixel));
 
-	return ((ssize_t) noiseFilter->hotPixelArraySize);
+	size_t idx = noiseFilter->hotPixelArraySize;
+
+	for (size_t i = 0; i < mapWords; i++) {
+		for (size_t j = 0; j < 64; j++) {
+			if (((hotPixelMap[i] >> j) & 0x01) != 0) {
+				size_t pixelIndex = (i * 64) + j;
+
+				(*hotPixels)[idx].x = U16T(pixelIndex % noiseFilter->sizeX);
+				(*hotPixels)[idx].y = U16T(pixelIndex / noiseFilter->sizeX);
+				idx++;
+			}
+		}
+	}
+
+	free(hotPixelMap);
+
+	return ((ssize_t) hotPixelsNumber);
 }
 
 static int hotPixelArrayCountCompare(const void *a, const void *b) {
@@ -650,6 +1456,8 @@ static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter) {
 		noiseFilter->hotPixelArraySize = 0;
 	}
 
+	memset(noiseFilter->hotPixelMap, 0, hotPixelMapWords(noiseFilter) * sizeof(uint64_t));
+
 	size_t pixelNumber = (size_t) (noiseFilter->sizeX * noiseFilter->sizeY);
 
 	// Count number of hot pixels.
@@ -696,6 +1504,10 @@ static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter) {
 	for (size_t i = 0; i < hotPixelsNumber; i++) {
 		noiseFilter->hotPixelArray[i].x = hotPixels[i].address.x;
 		noiseFilter->hotPixelArray[i].y = hotPixels[i].address.y;
+
+		size_t pixelIndex = (hotPixels[i].address.y * (size_t) noiseFilter->sizeX) + hotPixels[i].address.x;
+
+		noiseFilter->hotPixelMap[pixelIndex / 64] |= (UINT64_C(1) << (pixelIndex % 64));
 	}
 
 	free(hotPixels);
@@ -0,0 +1,113 @@
+#ifndef LIBCAER_SRC_POLARITY_GROUP_H_
+#define LIBCAER_SRC_POLARITY_GROUP_H_
+
+#include "libcaer/events/polarity.h"
+
+#include <string.h>
+
+/**
+ * Complete data word of a valid polarity event, as stored in the packet.
+ */
+static inline uint32_t polarityGroupEventData(uint16_t xAddr, uint16_t yAddr, bool polarity) {
+	return (htole32((U32T(xAddr & POLARITY_X_ADDR_MASK) << POLARITY_X_ADDR_SHIFT)
+					| (U32T(yAddr & POLARITY_Y_ADDR_MASK) << POLARITY_Y_ADDR_SHIFT)
+					| (U32T(polarity) << POLARITY_SHIFT) | (U32T(1) << VALID_MARK_SHIFT)));
+}
+
+/**
+ * Data word increment to go from one pixel of a group to the next,
+ * along the Y axis, or along the X axis if the axes are swapped.
+ */
+static inline uint32_t polarityGroupPixelStep(bool alongX) {
+	return ((alongX) ? (U32T(1) << POLARITY_X_ADDR_SHIFT) : (U32T(1) << POLARITY_Y_ADDR_SHIFT));
+}
+
+/**
+ * Store a valid polarity event at 'position', with a single store for its
+ * data word. The packet's event counters are not touched: translators only
+ * track their position while filling a packet, all events being valid by
+ * construction, and set the counters once at commit time with
+ * polarityGroupCountersCommit().
+ */
+static inline void polarityGroupEventStore(caerPolarityEventPacket packet, int32_t position, uint16_t xAddr,
+	uint16_t yAddr, bool polarity, int32_t timestamp) {
+	packet->events[position].data      = polarityGroupEventData(xAddr, yAddr, polarity);
+	packet->events[position].timestamp = I32T(htole32(U32T(timestamp)));
+}
+
+/**
+ * Set the packet's event counters at commit time, for the 'position' valid
+ * events stored in it. The packet is dense: all its events are valid.
+ */
+static inline void polarityGroupCountersCommit(caerPolarityEventPacket packet, int32_t position) {
+	caerEventPacketHeaderSetEventNumber(&packet->packetHeader, position);
+	caerEventPacketHeaderSetEventValid(&packet->packetHeader, position);
+}
+
+/**
+ * Expand an 8-pixel group event into one polarity event per set bit of
+ * 'presence', lowest bit first, and append them to the packet at 'position'.
+ * All per-pixel address handling (flip, axes swap) must be folded by the
+ * caller into 'firstData' (see polarityGroupEventData(), for pixel 0) and
+ * 'pixelStep' (see polarityGroupPixelStep()).
+ *
+ * Every pixel is stored unconditionally and the position only advances for
+ * present ones, so there are no data-dependent branches. The one store that
+ * can end up past the last event is undone, as unused events must stay zeroed.
+ * Space for 8 events from 'position' on must be available. Like with
+ * polarityGroupEventStore(), the packet's event counters are not touched.
+ *
+ * @return number of events added to the packet.
+ */
+static inline int32_t polarityGroupExpand(caerPolarityEventPacket packet, int32_t position, uint8_t presence,
+	uint32_t firstData, uint32_t pixelStep, int32_t timestamp) {
+	caerPolarityEvent events = &packet->events[position];
+	int32_t leTimestamp      = I32T(htole32(U32T(timestamp)));
+	uint32_t data            = le32toh(firstData);
+	int32_t count            = 0;
+
+	for (int32_t i = 0; i < 8; i++) {
+		events[count].data      = htole32(data);
+		events[count].timestamp = leTimestamp;
+
+		count += (presence >> i) & 0x01;
+		data += pixelStep;
+	}
+
+	if (count < 8) {
+		memset(&events[count], 0, sizeof(struct caer_polarity_event));
+	}
+
+	return (count);
+}
+
+/**
+ * Expand the two 8-pixel groups of a 32 bit group word at once, as a single
+ * store sequence of 16 events. Bits 7-0 of 'presence' are the first group,
+ * starting at 'firstData1', bits 15-8 the second one, starting at 'firstData2'.
+ * Same rules as polarityGroupExpand() apply, with space for 16 events needed.
+ *
+ * @return number of events added to the packet.
+ */
+static inline int32_t polarityGroupPairExpand(caerPolarityEventPacket packet, int32_t position, uint16_t presence,
+	uint32_t firstData1, uint32_t firstData2, uint32_t pixelStep, int32_t timestamp) {
+	caerPolarityEvent events    = &packet->events[position];
+	int32_t leTimestamp         = I32T(htole32(U32T(timestamp)));
+	const uint32_t firstData[2] = {le32toh(firstData1), le32toh(firstData2)};
+	int32_t count               = 0;
+
+	for (int32_t i = 0; i < 16; i++) {
+		events[count].data      = htole32(firstData[i >> 3] + (U32T(i & 0x07) * pixelStep));
+		events[count].timestamp = leTimestamp;
+
+		count += (presence >> i) & 0x01;
+	}
+
+	if (count < 16) {
+		memset(&events[count], 0, sizeof(struct caer_polarity_event));
+	}
+
+	return (count);
+}
+
+#endif /* LIBCAER_SRC_POLARITY_GROUP_H_ */
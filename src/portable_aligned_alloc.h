@@ -5,7 +5,8 @@
 #	include <stdlib.h>
 
 static inline void *portable_aligned_alloc(size_t alignment, size_t size) {
-	return (aligned_alloc(alignment, size));
+	// C11 requires the size to be a multiple of the alignment.
+	return (aligned_alloc(alignment, ((size + alignment - 1) / alignment) * alignment));
 }
 
 static inline void portable_aligned_free(void *mem) {
@@ -103,6 +103,31 @@ void *caerRingBufferGet(caerRingBuffer rBuf) {
 	return (NULL);
 }
 
+size_t caerRingBufferGetMany(caerRingBuffer rBuf, void **elems, size_t maxElems) {
+	size_t getPos = rBuf->getPos;
+	size_t count  = 0;
+
+	// Drain up to maxElems elements in one pass, stopping at the first empty place.
+	while (count < maxElems) {
+		void *curr = (void *) atomic_load_explicit(&rBuf->elements[getPos], memory_order_acquire);
+
+		if (curr == NULL) {
+			break;
+		}
+
+		atomic_store_explicit(&rBuf->elements[getPos], (uintptr_t) NULL, memory_order_release);
+
+		elems[count++] = curr;
+
+		getPos = ((getPos + 1) & (rBuf->size - 1));
+	}
+
+	// Update local get pointer once for the whole batch.
+	rBuf->getPos = getPos;
+
+	return (count);
+}
+
 void *caerRingBufferLook(caerRingBuffer rBuf) {
 	void *curr = (void *) atomic_load_explicit(&rBuf->elements[rBuf->getPos], memory_order_acquire);
 
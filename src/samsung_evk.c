@@ -3,6 +3,8 @@
 static void samsungEVKLog(enum caer_log_level logLevel, samsungEVKHandle handle, const char *format, ...)
 	ATTRIBUTE_FORMAT(3);
 static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const size_t bytesSent);
+static void samsungEVKContainerCommit(samsungEVKHandle handle, bool tsReset);
+static caerEventPacketHeader samsungEVKRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity);
 static void resetParser(samsungEVKHandle handle, const char *reason);
 
 static bool i2cConfigSend(usbState state, uint16_t deviceAddr, uint16_t byteAddr, uint8_t param);
@@ -42,7 +44,7 @@ static void populateDeviceInfo(
 		// Get USB firmware version.
 		uint8_t firmwareVersion = 0;
 		libusb_control_transfer(devHandle, LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE,
-			VENDOR_REQUEST_I2C_READ, DEVICE_FPGA, 0xFF00, &firmwareVersion, 1, 0);
+			VENDOR_REQUEST_I2C_READ, FPGA_DEVICE, 0xFF00, &firmwareVersion, 1, 0);
 
 		evkInfoPtr->firmwareVersion = firmwareVersion;
 	}
@@ -64,14 +66,14 @@ static inline void freeAllDataMemory(samsungEVKState state) {
 	// already assigned to the current packet container, we
 	// free them separately from it.
 	if (state->currentPackets.polarity != NULL) {
-		free(state->currentPackets.polarity);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.polarity);
 		state->currentPackets.polarity = NULL;
 
 		containerGenerationSetPacket(&state->container, POLARITY_EVENT, NULL);
 	}
 
 	if (state->currentPackets.special != NULL) {
-		free(state->currentPackets.special);
+		caerEventPacketFree((caerEventPacketHeader) state->currentPackets.special);
 		state->currentPackets.special = NULL;
 
 		containerGenerationSetPacket(&state->container, SPECIAL_EVENT, NULL);
@@ -111,8 +113,9 @@ caerDeviceHandle samsungEVKOpen(
 	usbSetLogLevel(&state->usbState, globalLogLevel);
 
 	// Set device thread name. Maximum length of 15 chars due to Linux limitations.
-	char usbThreadName[MAX_THREAD_NAME_LENGTH + 1];
-	snprintf(usbThreadName, MAX_THREAD_NAME_LENGTH + 1, "%s %" PRIu16, SAMSUNG_EVK_DEVICE_NAME, deviceID);
+	// The device name is too long for that, so the full name is cut to size.
+	char usbThreadName[sizeof(SAMSUNG_EVK_DEVICE_NAME) + 6];
+	snprintf(usbThreadName, sizeof(usbThreadName), "%s %" PRIu16, SAMSUNG_EVK_DEVICE_NAME, deviceID);
 	usbThreadName[MAX_THREAD_NAME_LENGTH] = '\0';
 
 	usbSetThreadName(&state->usbState, usbThreadName);
@@ -159,6 +162,8 @@ caerDeviceHandle samsungEVKOpen(
 
 	// Setup USB.
 	usbSetDataCallback(&state->usbState, &samsungEVKEventTranslator, handle);
+	usbSetRawDataCallback(&state->usbState, &samsungEVKRawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
 	usbSetDataEndpoint(&state->usbState, SAMSUNG_EVK_DATA_ENDPOINT);
 	usbSetTransfersNumber(&state->usbState, 16);
 	usbSetTransfersSize(&state->usbState, 8192);
@@ -187,59 +192,59 @@ caerDeviceHandle samsungEVKOpen(
 	thrd_sleep(10000);
 
 	// FPGA settings.
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x020C, 0x3F); // MI2C
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x020D, 0x04); // MI2C
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x0200, 0x00); // Turn all IMU features off.
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x020C, 0x3F); // MI2C
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x020D, 0x04); // MI2C
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x0200, 0x00); // Turn all IMU features off.
 
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x0000, 0x11); // Big endian transfer, enable FX3 transfer.
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x0004, 0x01); // Take DVS out of reset.
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x0000, 0x11); // Big endian transfer, enable FX3 transfer.
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x0004, 0x01); // Take DVS out of reset.
 
 	// Enable FX3 timeout, set to 500us.
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x0002, 0xF4); // 8 lower bits of timeout.
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x0002, 0xF4); // 8 lower bits of timeout.
 	i2cConfigSend(
-		&state->usbState, DEVICE_FPGA, 0x0003, 0x81); // bit 7 enable timeout, bits 1-0 are bits 9-8 of timeout.
+		&state->usbState, FPGA_DEVICE, 0x0003, 0x81); // bit 7 enable timeout, bits 1-0 are bits 9-8 of timeout.
 
 	// Wait 10ms for DVS to start.
 	thrd_sleep(10000);
 
 	// Bias reset.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_OTP_TRIM, 0x24);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_OTP_TRIM, 0x24);
 
 	// Bias enable.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_PINS_DBGP, 0x07);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_PINS_DBGN, 0xFF);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_PINS_BUFP, 0x03);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_PINS_BUFN, 0x7F);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_PINS_DOB, 0x00);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_PINS_DBGP, 0x07);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_PINS_DBGN, 0xFF);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_PINS_BUFP, 0x03);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_PINS_BUFN, 0x7F);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_PINS_DOB, 0x00);
 
 	samsungEVKConfigSet((caerDeviceHandle) handle, SAMSUNG_EVK_DVS_BIAS, SAMSUNG_EVK_DVS_BIAS_SIMPLE,
 		SAMSUNG_EVK_DVS_BIAS_SIMPLE_DEFAULT);
 
 	// System settings.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_CLOCK_DIVIDER_SYS, 0xA0); // Divide freq by 10.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PARALLEL_OUT_CONTROL, 0x00);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PARALLEL_OUT_ENABLE, 0x01);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT, 0x80); // Enable MGROUP compression.
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_CLOCK_DIVIDER_SYS, 0xA0); // Divide freq by 10.
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PARALLEL_OUT_CONTROL, 0x00);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PARALLEL_OUT_ENABLE, 0x01);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT, 0x80); // Enable MGROUP compression.
 
 	// Digital settings.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_TIMESTAMP_SUBUNIT, 0x31);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_MODE_CONTROL, 0x0C); // R/AY signals enable.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_BOOT_SEQUENCE, 0x08);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_TIMESTAMP_SUBUNIT, 0x31);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_MODE_CONTROL, 0x0C); // R/AY signals enable.
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_BOOT_SEQUENCE, 0x08);
 
 	// Fine clock counts based on clock frequency.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GH_COUNT_FINE, 50);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_COUNT_FINE, 50);
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_END_FINE, 50);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GH_COUNT_FINE, 50);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_COUNT_FINE, 50);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_END_FINE, 50);
 
 	// Disable histogram, not currently used/mapped.
-	i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_SPATIAL_HISTOGRAM_OFF, 0x01);
+	i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_SPATIAL_HISTOGRAM_OFF, 0x01);
 
 	// Commands in firmware but not documented, unused.
-	// i2cConfigSend(&state->usbState, DEVICE_DVS, 0x3043, 0x01); // Bypass ESP.
-	// i2cConfigSend(&state->usbState, DEVICE_DVS, 0x3249, 0x00);
-	// i2cConfigSend(&state->usbState, DEVICE_DVS, 0x324A, 0x01);
-	// i2cConfigSend(&state->usbState, DEVICE_DVS, 0x325A, 0x00);
-	// i2cConfigSend(&state->usbState, DEVICE_DVS, 0x325B, 0x01);
+	// i2cConfigSend(&state->usbState, DVS_DEVICE, 0x3043, 0x01); // Bypass ESP.
+	// i2cConfigSend(&state->usbState, DVS_DEVICE, 0x3249, 0x00);
+	// i2cConfigSend(&state->usbState, DVS_DEVICE, 0x324A, 0x01);
+	// i2cConfigSend(&state->usbState, DVS_DEVICE, 0x325A, 0x00);
+	// i2cConfigSend(&state->usbState, DVS_DEVICE, 0x325B, 0x01);
 
 	// Setup data parser.
 	resetParser(handle, "startup");
@@ -261,8 +266,8 @@ bool samsungEVKClose(caerDeviceHandle cdh) {
 
 	samsungEVKLog(CAER_LOG_DEBUG, handle, "Shutting down ...");
 
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x0004, 0x00); // Put DVS in reset.
-	i2cConfigSend(&state->usbState, DEVICE_FPGA, 0x0000, 0x10); // Disable FX3 transfer.
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x0004, 0x00); // Put DVS in reset.
+	i2cConfigSend(&state->usbState, FPGA_DEVICE, 0x0000, 0x10); // Disable FX3 transfer.
 
 	// Shut down USB handling thread.
 	usbThreadStop(&state->usbState);
@@ -279,6 +284,128 @@ bool samsungEVKClose(caerDeviceHandle cdh) {
 	return (true);
 }
 
+// Device state needed by the translator, saved with raw recordings.
+static void recordFieldsGet(samsungEVKHandle handle, struct usb_record_field fields[SAMSUNG_EVK_RECORD_FIELDS]) {
+	struct caer_samsung_evk_info *info = &handle->info;
+	samsungEVKState state              = &handle->state;
+
+	fields[0]  = USB_RECORD_FIELD(info->deviceID, USB_RECORD_INT16);
+	fields[1]  = USB_RECORD_FIELD(info->deviceSerialNumber, USB_RECORD_STRING);
+	fields[2]  = USB_RECORD_FIELD(info->deviceUSBBusNumber, USB_RECORD_UINT8);
+	fields[3]  = USB_RECORD_FIELD(info->deviceUSBDeviceAddress, USB_RECORD_UINT8);
+	fields[4]  = USB_RECORD_FIELD(info->firmwareVersion, USB_RECORD_INT16);
+	fields[5]  = USB_RECORD_FIELD(info->chipID, USB_RECORD_INT16);
+	fields[6]  = USB_RECORD_FIELD(info->dvsSizeX, USB_RECORD_INT16);
+	fields[7]  = USB_RECORD_FIELD(info->dvsSizeY, USB_RECORD_INT16);
+	fields[8]  = USB_RECORD_FIELD(state->timestamps.reference, USB_RECORD_INT64);
+	fields[9]  = USB_RECORD_FIELD(state->timestamps.referenceOverflow, USB_RECORD_INT64);
+	fields[10] = USB_RECORD_FIELD(state->timestamps.lastReference, USB_RECORD_INT32);
+	fields[11] = USB_RECORD_FIELD(state->timestamps.lastUsedSub, USB_RECORD_INT32);
+	fields[12] = USB_RECORD_FIELD(state->timestamps.lastUsedReference, USB_RECORD_INT64);
+	fields[13] = USB_RECORD_FIELD(state->timestamps.currTimestamp, USB_RECORD_INT64);
+	fields[14] = USB_RECORD_FIELD(state->timestamps.lastTimestamp, USB_RECORD_INT64);
+	fields[15] = USB_RECORD_FIELD(state->timestamps.last, USB_RECORD_INT32);
+	fields[16] = USB_RECORD_FIELD(state->timestamps.current, USB_RECORD_INT32);
+	fields[17] = USB_RECORD_FIELD(state->timestamps.wrapOverflow, USB_RECORD_INT32);
+	fields[18] = USB_RECORD_FIELD(state->dvs.lastColumn, USB_RECORD_INT16);
+	fields[19] = USB_RECORD_FIELD(state->dvs.cropperYStart, USB_RECORD_UINT16);
+	fields[20] = USB_RECORD_FIELD(state->dvs.cropperYEnd, USB_RECORD_UINT16);
+}
+
+caerDeviceHandle samsungEVKReplayOpen(uint16_t deviceID, const char *filePath, bool maxSpeed) {
+	errno = 0;
+
+	caerLog(CAER_LOG_DEBUG, __func__, "Initializing %s replay.", SAMSUNG_EVK_DEVICE_NAME);
+
+	samsungEVKHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		// Failed to allocate memory for device handle!
+		caerLog(CAER_LOG_CRITICAL, __func__, "Failed to allocate memory for device handle.");
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	// Set main deviceType correctly right away.
+	handle->deviceType = CAER_DEVICE_SAMSUNG_EVK;
+
+	samsungEVKState state = &handle->state;
+
+	// Initialize state variables to default values (if not zero, taken care of by calloc above).
+	dataExchangeSettingsInit(&state->dataExchange);
+
+	// Replay must not drop data, to reproduce the recorded output exactly.
+	atomic_store(&state->dataExchange.dropPolicy, CAER_HOST_CONFIG_DATAEXCHANGE_BLOCK_PRODUCER);
+
+	// Packet settings (size (in events) and time interval (in µs)).
+	containerGenerationSettingsInit(&state->container);
+
+	// Logging settings (initialize to global log-level).
+	enum caer_log_level globalLogLevel = caerLogLevelGet();
+	atomic_store(&state->deviceLogLevel, globalLogLevel);
+	usbSetLogLevel(&state->usbState, globalLogLevel);
+
+	// Set device thread name. Maximum length of 15 chars due to Linux limitations.
+	// The device name is too long for that, so the full name is cut to size.
+	char usbThreadName[sizeof(SAMSUNG_EVK_DEVICE_NAME) + 6];
+	snprintf(usbThreadName, sizeof(usbThreadName), "%s %" PRIu16, SAMSUNG_EVK_DEVICE_NAME, deviceID);
+	usbThreadName[MAX_THREAD_NAME_LENGTH] = '\0';
+
+	usbSetThreadName(&state->usbState, usbThreadName);
+
+	// Restore recorded info and translator state.
+	struct usb_record_field fields[SAMSUNG_EVK_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	bool replayOpened = usbReplayOpen(
+		&state->usbState, filePath, maxSpeed, CAER_DEVICE_SAMSUNG_EVK, fields, SAMSUNG_EVK_RECORD_FIELDS);
+
+	handle->info.deviceString = usbThreadName; // Temporary, until replaced by full string.
+
+	if (!replayOpened) {
+		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to open replay, see above log message for more information.");
+
+		free(handle);
+
+		// errno set by usbReplayOpen().
+		return (NULL);
+	}
+
+	char *replayInfoString = malloc(USB_INFO_STRING_SIZE);
+	if (replayInfoString == NULL) {
+		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to generate replay information string.");
+
+		usbDeviceClose(&state->usbState);
+		free(handle);
+
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
+	snprintf(replayInfoString, USB_INFO_STRING_SIZE, SAMSUNG_EVK_DEVICE_NAME " ID-%" PRIu16 " SN-%s [replay]",
+		deviceID, handle->info.deviceSerialNumber);
+
+	handle->info.deviceID     = I16T(deviceID);
+	handle->info.deviceString = replayInfoString;
+
+	// Setup replay, same translator as USB.
+	usbSetDataCallback(&state->usbState, &samsungEVKEventTranslator, handle);
+	usbSetRawDataCallback(&state->usbState, &samsungEVKRawDataExchange, handle);
+	usbSetStatistics(&state->usbState, &state->container.statistics);
+
+	samsungEVKLog(CAER_LOG_DEBUG, handle, "Initialized replay of '%s' successfully.", filePath);
+
+	return ((caerDeviceHandle) handle);
+}
+
+bool samsungEVKRawRecordStart(caerDeviceHandle cdh, const char *filePath) {
+	samsungEVKHandle handle = (samsungEVKHandle) cdh;
+
+	struct usb_record_field fields[SAMSUNG_EVK_RECORD_FIELDS];
+	recordFieldsGet(handle, fields);
+
+	return (usbRecordStart(&handle->state.usbState, filePath, handle->deviceType, fields, SAMSUNG_EVK_RECORD_FIELDS));
+}
+
 struct caer_samsung_evk_info caerSamsungEVKInfoGet(caerDeviceHandle cdh) {
 	samsungEVKHandle handle = (samsungEVKHandle) cdh;
 
@@ -380,7 +507,7 @@ bool samsungEVKSendDefaultConfig(caerDeviceHandle cdh) {
 	samsungEVKConfigSet(cdh, SAMSUNG_EVK_DVS_ACTIVITY_DECISION, SAMSUNG_EVK_DVS_ACTIVITY_DECISION_POS_MAX_COUNT, 300);
 
 	// DTAG restart after config.
-	i2cConfigSend(&handle->state.usbState, DEVICE_DVS, REGISTER_DIGITAL_RESTART, 0x02);
+	i2cConfigSend(&handle->state.usbState, DVS_DEVICE, REGISTER_DIGITAL_RESTART, 0x02);
 
 	return (true);
 }
@@ -402,6 +529,10 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			return (containerGenerationConfigSet(&state->container, U8T(paramAddr), param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigSet(&state->container.statistics, &state->dataExchange, U8T(paramAddr), param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -424,18 +555,18 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_MODE, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_MODE, U8T(param)));
 					break;
 				}
 
 				case SAMSUNG_EVK_DVS_EVENT_FLATTEN: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT,
 						(param) ? U8T(currVal | 0x40) : U8T(currVal & ~0x40)));
 					break;
 				}
@@ -443,11 +574,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_EVENT_ON_ONLY: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT,
 						(param) ? U8T(currVal | 0x20) : U8T(currVal & ~0x20)));
 					break;
 				}
@@ -455,11 +586,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_EVENT_OFF_ONLY: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT,
 						(param) ? U8T(currVal | 0x10) : U8T(currVal & ~0x10)));
 					break;
 				}
@@ -467,11 +598,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_SUBSAMPLE_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_ENABLE, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_ENABLE, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_ENABLE,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_ENABLE,
 						(param) ? U8T(currVal & ~0x04) : U8T(currVal | 0x04)));
 					break;
 				}
@@ -479,18 +610,18 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_AREA_BLOCKING_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_ENABLE, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_ENABLE, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_ENABLE,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_ENABLE,
 						(param) ? U8T(currVal & ~0x02) : U8T(currVal | 0x02)));
 					break;
 				}
 
 				case SAMSUNG_EVK_DVS_DUAL_BINNING_ENABLE: {
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_DUAL_BINNING, (param) ? (0x01) : (0x00)));
+						&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_DUAL_BINNING, (param) ? (0x01) : (0x00)));
 					break;
 				}
 
@@ -501,13 +632,13 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
 						return (false);
 					}
 
 					currVal = U8T(U8T(currVal) & ~0x38) | U8T(param << 3);
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_SUBSAMPLE_RATIO, currVal));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_SUBSAMPLE_RATIO, currVal));
 					break;
 				}
 
@@ -518,13 +649,13 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
 						return (false);
 					}
 
 					currVal = U8T(U8T(currVal) & ~0x07) | U8T(param);
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_SUBSAMPLE_RATIO, currVal));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_SUBSAMPLE_RATIO, currVal));
 					break;
 				}
 
@@ -551,18 +682,18 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint16_t regAddr
 						= REGISTER_DIGITAL_AREA_BLOCK + (2 * (paramAddr - SAMSUNG_EVK_DVS_AREA_BLOCKING_0));
 
-					if (!i2cConfigSend(&state->usbState, DEVICE_DVS, regAddr, U8T(param >> 8))) {
+					if (!i2cConfigSend(&state->usbState, DVS_DEVICE, regAddr, U8T(param >> 8))) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, U16T(regAddr + 1), U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, U16T(regAddr + 1), U8T(param)));
 					break;
 				}
 
 				case SAMSUNG_EVK_DVS_TIMESTAMP_RESET: {
 					if (param) {
-						i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_TIMESTAMP_RESET, 0x01);
-						return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_TIMESTAMP_RESET, 0x00));
+						i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_TIMESTAMP_RESET, 0x01);
+						return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_TIMESTAMP_RESET, 0x00));
 					}
 					break;
 				}
@@ -570,17 +701,17 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_GLOBAL_RESET_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_MODE_CONTROL,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_MODE_CONTROL,
 						(param) ? U8T(currVal | 0x02) : U8T(currVal & ~0x02)));
 					break;
 				}
 
 				case SAMSUNG_EVK_DVS_GLOBAL_RESET_DURING_READOUT: {
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_GLOBAL_RESET_READOUT,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_GLOBAL_RESET_READOUT,
 						(param) ? (0x01) : (0x00)));
 					break;
 				}
@@ -588,18 +719,18 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_GLOBAL_HOLD_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_MODE_CONTROL,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_MODE_CONTROL,
 						(param) ? U8T(currVal | 0x01) : U8T(currVal & ~0x01)));
 					break;
 				}
 
 				case SAMSUNG_EVK_DVS_FIXED_READ_TIME_ENABLE: {
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_FIXED_READ_TIME, (param) ? (0x01) : (0x00)));
+						&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_FIXED_READ_TIME, (param) ? (0x01) : (0x00)));
 					break;
 				}
 
@@ -608,7 +739,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_EXTERNAL_TRIGGER, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_EXTERNAL_TRIGGER, U8T(param)));
 					break;
 				}
 
@@ -618,9 +749,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GH_COUNT, 0x00);
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GH_COUNT + 1, 0x00);
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GH_COUNT + 2, 0x02));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GH_COUNT, 0x00);
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GH_COUNT + 1, 0x00);
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GH_COUNT + 2, 0x02));
 					break;
 				}
 
@@ -630,9 +761,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_COUNT, 0x00);
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_COUNT + 1, 0x00);
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_COUNT + 2, 0x00));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_COUNT, 0x00);
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_COUNT + 1, 0x00);
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_COUNT + 2, 0x00));
 					break;
 				}
 
@@ -642,9 +773,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_END, 0x00);
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_END + 1, 0x00);
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_END + 2, 0x01));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_END, 0x00);
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_END + 1, 0x00);
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_END + 2, 0x01));
 					break;
 				}
 
@@ -653,7 +784,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_FIRST_SELX_START, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_FIRST_SELX_START, U8T(param)));
 					break;
 				}
 
@@ -662,7 +793,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_SELX_WIDTH, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_SELX_WIDTH, U8T(param)));
 					break;
 				}
 
@@ -671,7 +802,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_AY_START, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_AY_START, U8T(param)));
 					break;
 				}
 
@@ -680,7 +811,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_AY_END, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_AY_END, U8T(param)));
 					break;
 				}
 
@@ -689,7 +820,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_R_START, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_R_START, U8T(param)));
 					break;
 				}
 
@@ -698,7 +829,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_R_END, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_R_END, U8T(param)));
 					break;
 				}
 
@@ -707,13 +838,13 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_NEXT_SELX_START, U8T(param >> 8));
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_NEXT_SELX_START + 1, U8T(param));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_NEXT_SELX_START, U8T(param >> 8));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_NEXT_SELX_START + 1, U8T(param));
 
 					// Also set MAX_EVENT_NUM, which is defined as NEXT_SEL-5, up to a maximum of 60.
 					uint8_t maxEventNum = (param < 65) ? U8T(param - 5) : U8T(60);
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_MAX_EVENT_NUM, maxEventNum));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_MAX_EVENT_NUM, maxEventNum));
 					break;
 				}
 
@@ -722,7 +853,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_NEXT_GH_CNT, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_NEXT_GH_CNT, U8T(param)));
 					break;
 				}
 
@@ -731,9 +862,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_TIMING_READ_TIME_INTERVAL, U8T(param >> 8));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_TIMING_READ_TIME_INTERVAL, U8T(param >> 8));
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_TIMING_READ_TIME_INTERVAL + 1, U8T(param)));
+						&state->usbState, DVS_DEVICE, REGISTER_TIMING_READ_TIME_INTERVAL + 1, U8T(param)));
 					break;
 				}
 
@@ -747,7 +878,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			switch (paramAddr) {
 				case SAMSUNG_EVK_DVS_CROPPER_ENABLE: {
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_CROPPER_BYPASS, (param) ? (0x00) : (0x01)));
+						&state->usbState, DVS_DEVICE, REGISTER_CROPPER_BYPASS, (param) ? (0x00) : (0x01)));
 					break;
 				}
 
@@ -784,11 +915,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						startMask = 0xFF;
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_Y_START_GROUP, startGroup);
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_Y_START_MASK, startMask);
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_Y_START_GROUP, startGroup);
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_Y_START_MASK, startMask);
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_Y_END_GROUP, endGroup);
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_Y_END_MASK, endMask));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_Y_END_GROUP, endGroup);
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_Y_END_MASK, endMask));
 					break;
 				}
 
@@ -797,9 +928,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_START_ADDRESS, U8T(param >> 8));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_START_ADDRESS, U8T(param >> 8));
 					return (
-						i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_START_ADDRESS + 1, U8T(param)));
+						i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_START_ADDRESS + 1, U8T(param)));
 					break;
 				}
 
@@ -808,9 +939,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_END_ADDRESS, U8T(param >> 8));
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_END_ADDRESS, U8T(param >> 8));
 					return (
-						i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_END_ADDRESS + 1, U8T(param)));
+						i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_END_ADDRESS + 1, U8T(param)));
 					break;
 				}
 
@@ -824,7 +955,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			switch (paramAddr) {
 				case SAMSUNG_EVK_DVS_ACTIVITY_DECISION_ENABLE: {
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_BYPASS, (param) ? (0x00) : (0x01)));
+						&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_BYPASS, (param) ? (0x00) : (0x01)));
 					break;
 				}
 
@@ -834,9 +965,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					}
 
 					i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD, U8T(param >> 8));
+						&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD, U8T(param >> 8));
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD + 1, U8T(param)));
+						&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD + 1, U8T(param)));
 					break;
 				}
 
@@ -846,9 +977,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					}
 
 					i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD, U8T(param >> 8));
+						&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD, U8T(param >> 8));
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD + 1, U8T(param)));
+						&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD + 1, U8T(param)));
 					break;
 				}
 
@@ -858,7 +989,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					}
 
 					return (
-						i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_DEC_RATE, U8T(param)));
+						i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_DEC_RATE, U8T(param)));
 					break;
 				}
 
@@ -868,7 +999,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					}
 
 					return (
-						i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_DEC_TIME, U8T(param)));
+						i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_DEC_TIME, U8T(param)));
 					break;
 				}
 
@@ -878,9 +1009,9 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					}
 
 					i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT, U8T(param >> 8));
+						&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT, U8T(param >> 8));
 					return (i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT + 1, U8T(param)));
+						&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT + 1, U8T(param)));
 					break;
 				}
 
@@ -896,11 +1027,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
 						(param) ? U8T(currVal | 0x08) : U8T(currVal & ~0x08)));
 					break;
 				}
@@ -909,11 +1040,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
 						(param) ? U8T(currVal | 0x04) : U8T(currVal & ~0x04)));
 					break;
 				}
@@ -922,11 +1053,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
 						(param) ? U8T(currVal | 0x02) : U8T(currVal & ~0x02)));
 					break;
 				}
@@ -935,11 +1066,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST,
 						(param) ? U8T(currVal | 0x01) : U8T(currVal & ~0x01)));
 					break;
 				}
@@ -947,13 +1078,13 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_RANGE_LOGA: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS,
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE,
 							REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR, &currVal)) {
 						return (false);
 					}
 
 					return (
-						i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR,
+						i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR,
 							(param) ? U8T(currVal | 0x10) : U8T(currVal & ~0x10)));
 					break;
 				}
@@ -965,12 +1096,12 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS,
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE,
 							REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE,
 						REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR, U8T((currVal & ~0x0C) | U8T(param << 2))));
 					break;
 				}
@@ -978,11 +1109,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_LEVEL_SF: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF,
 						(param) ? U8T(currVal | 0x10) : U8T(currVal & ~0x10)));
 					break;
 				}
@@ -990,11 +1121,11 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_LEVEL_nOFF: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF,
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF,
 						(param) ? U8T(currVal | 0x02) : U8T(currVal & ~0x02)));
 					break;
 				}
@@ -1004,7 +1135,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_AMP, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_AMP, U8T(param)));
 					break;
 				}
 
@@ -1013,7 +1144,7 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_ON, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_ON, U8T(param)));
 					break;
 				}
 
@@ -1022,64 +1153,64 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 						return (false);
 					}
 
-					return (i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_OFF, U8T(param)));
+					return (i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_OFF, U8T(param)));
 					break;
 				}
 
 				case SAMSUNG_EVK_DVS_BIAS_SIMPLE:
-					i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_AMP, 0x04);
+					i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_AMP, 0x04);
 					i2cConfigSend(
-						&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR, 0x14);
+						&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR, 0x14);
 
 					switch (param) {
 						case SAMSUNG_EVK_DVS_BIAS_SIMPLE_VERY_LOW: {
 							i2cConfigSend(
-								&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x06);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7D);
+								&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x06);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7D);
 
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_ON, 0x06);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_OFF, 0x02);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_ON, 0x06);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_OFF, 0x02);
 							break;
 						}
 
 						case SAMSUNG_EVK_DVS_BIAS_SIMPLE_LOW: {
 							i2cConfigSend(
-								&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x06);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7D);
+								&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x06);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7D);
 
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_ON, 0x03);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_OFF, 0x05);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_ON, 0x03);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_OFF, 0x05);
 							break;
 						}
 
 						case SAMSUNG_EVK_DVS_BIAS_SIMPLE_HIGH: {
 							i2cConfigSend(
-								&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x04);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7F);
+								&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x04);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7F);
 
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_ON, 0x05);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_OFF, 0x03);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_ON, 0x05);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_OFF, 0x03);
 							break;
 						}
 
 						case SAMSUNG_EVK_DVS_BIAS_SIMPLE_VERY_HIGH: {
 							i2cConfigSend(
-								&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x04);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7F);
+								&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x04);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7F);
 
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_ON, 0x02);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_OFF, 0x06);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_ON, 0x02);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_OFF, 0x06);
 							break;
 						}
 
 						case SAMSUNG_EVK_DVS_BIAS_SIMPLE_DEFAULT:
 						default: {
 							i2cConfigSend(
-								&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x06);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7D);
+								&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, 0x06);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, 0x7D);
 
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_ON, 0x00);
-							i2cConfigSend(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_OFF, 0x08);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_ON, 0x00);
+							i2cConfigSend(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_OFF, 0x08);
 							break;
 						}
 					}
@@ -1116,6 +1247,10 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_STATISTICS:
+			return (dataStatisticsConfigGet(&state->container.statistics, &state->dataExchange, paramAddr, param));
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1133,7 +1268,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_MODE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_MODE, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_MODE, &currVal)) {
 						return (false);
 					}
 
@@ -1144,7 +1279,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_EVENT_FLATTEN: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
 						return (false);
 					}
 
@@ -1155,7 +1290,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_EVENT_ON_ONLY: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
 						return (false);
 					}
 
@@ -1166,7 +1301,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_EVENT_OFF_ONLY: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CONTROL_PACKET_FORMAT, &currVal)) {
 						return (false);
 					}
 
@@ -1177,7 +1312,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_SUBSAMPLE_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_ENABLE, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_ENABLE, &currVal)) {
 						return (false);
 					}
 
@@ -1188,7 +1323,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_AREA_BLOCKING_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_ENABLE, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_ENABLE, &currVal)) {
 						return (false);
 					}
 
@@ -1199,7 +1334,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_DUAL_BINNING_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_ENABLE, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_ENABLE, &currVal)) {
 						return (false);
 					}
 
@@ -1210,7 +1345,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_SUBSAMPLE_VERTICAL: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
 						return (false);
 					}
 
@@ -1221,7 +1356,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_SUBSAMPLE_HORIZONTAL: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_SUBSAMPLE_RATIO, &currVal)) {
 						return (false);
 					}
 
@@ -1254,13 +1389,13 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, regAddr, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, regAddr, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, U16T(regAddr + 1), &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, U16T(regAddr + 1), &currVal)) {
 						return (false);
 					}
 
@@ -1276,7 +1411,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_GLOBAL_RESET_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
 						return (false);
 					}
 
@@ -1288,7 +1423,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_GLOBAL_RESET_READOUT, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_GLOBAL_RESET_READOUT, &currVal)) {
 						return (false);
 					}
 
@@ -1299,7 +1434,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_GLOBAL_HOLD_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_MODE_CONTROL, &currVal)) {
 						return (false);
 					}
 
@@ -1310,7 +1445,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_FIXED_READ_TIME_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_FIXED_READ_TIME, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_FIXED_READ_TIME, &currVal)) {
 						return (false);
 					}
 
@@ -1321,7 +1456,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_EXTERNAL_TRIGGER_MODE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_DIGITAL_EXTERNAL_TRIGGER, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_DIGITAL_EXTERNAL_TRIGGER, &currVal)) {
 						return (false);
 					}
 
@@ -1332,19 +1467,19 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_ED: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GH_COUNT + 1, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GH_COUNT + 1, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GH_COUNT + 2, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GH_COUNT + 2, &currVal)) {
 						return (false);
 					}
 
 					*param |= currVal;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GH_COUNT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GH_COUNT, &currVal)) {
 						return (false);
 					}
 
@@ -1355,19 +1490,19 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_GH2GRS: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_COUNT + 1, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_COUNT + 1, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_COUNT + 2, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_COUNT + 2, &currVal)) {
 						return (false);
 					}
 
 					*param |= currVal;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_COUNT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_COUNT, &currVal)) {
 						return (false);
 					}
 
@@ -1378,19 +1513,19 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_GRS: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_END + 1, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_END + 1, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_END + 2, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_END + 2, &currVal)) {
 						return (false);
 					}
 
 					*param |= currVal;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_GRS_END, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_GRS_END, &currVal)) {
 						return (false);
 					}
 
@@ -1401,7 +1536,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_GH2SEL: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_FIRST_SELX_START, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_FIRST_SELX_START, &currVal)) {
 						return (false);
 					}
 
@@ -1412,7 +1547,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_SELW: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_SELX_WIDTH, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_SELX_WIDTH, &currVal)) {
 						return (false);
 					}
 
@@ -1423,7 +1558,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_SEL2AY_R: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_AY_START, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_AY_START, &currVal)) {
 						return (false);
 					}
 
@@ -1434,7 +1569,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_SEL2AY_F: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_AY_END, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_AY_END, &currVal)) {
 						return (false);
 					}
 
@@ -1445,7 +1580,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_SEL2R_R: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_R_START, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_R_START, &currVal)) {
 						return (false);
 					}
 
@@ -1456,7 +1591,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_SEL2R_F: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_R_END, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_R_END, &currVal)) {
 						return (false);
 					}
 
@@ -1467,14 +1602,14 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_NEXT_SEL: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_NEXT_SELX_START, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_NEXT_SELX_START, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_TIMING_NEXT_SELX_START + 1, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_TIMING_NEXT_SELX_START + 1, &currVal)) {
 						return (false);
 					}
 
@@ -1485,7 +1620,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_NEXT_GH: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_NEXT_GH_CNT, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_NEXT_GH_CNT, &currVal)) {
 						return (false);
 					}
 
@@ -1496,14 +1631,14 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_TIMING_READ_FIXED: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_TIMING_READ_TIME_INTERVAL, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_TIMING_READ_TIME_INTERVAL, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_TIMING_READ_TIME_INTERVAL + 1, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_TIMING_READ_TIME_INTERVAL + 1, &currVal)) {
 						return (false);
 					}
 
@@ -1522,7 +1657,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_CROPPER_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_BYPASS, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_BYPASS, &currVal)) {
 						return (false);
 					}
 
@@ -1543,14 +1678,14 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_CROPPER_X_START_ADDRESS: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_START_ADDRESS, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_START_ADDRESS, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_START_ADDRESS + 1, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_START_ADDRESS + 1, &currVal)) {
 						return (false);
 					}
 
@@ -1561,13 +1696,13 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_CROPPER_X_END_ADDRESS: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_END_ADDRESS, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_END_ADDRESS, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_CROPPER_X_END_ADDRESS + 1, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_CROPPER_X_END_ADDRESS + 1, &currVal)) {
 						return (false);
 					}
 
@@ -1586,7 +1721,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_ACTIVITY_DECISION_ENABLE: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_BYPASS, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_BYPASS, &currVal)) {
 						return (false);
 					}
 
@@ -1598,14 +1733,14 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD + 1, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_THRESHOLD + 1, &currVal)) {
 						return (false);
 					}
 
@@ -1617,14 +1752,14 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD + 1, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_NEG_THRESHOLD + 1, &currVal)) {
 						return (false);
 					}
 
@@ -1636,7 +1771,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_DEC_RATE, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_DEC_RATE, &currVal)) {
 						return (false);
 					}
 
@@ -1648,7 +1783,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_DEC_TIME, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_DEC_TIME, &currVal)) {
 						return (false);
 					}
 
@@ -1660,14 +1795,14 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT, &currVal)) {
 						return (false);
 					}
 
 					*param = U32T(currVal << 8);
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT + 1, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_ACTIVITY_DECISION_POS_MAX_COUNT + 1, &currVal)) {
 						return (false);
 					}
 
@@ -1687,7 +1822,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
@@ -1699,7 +1834,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
@@ -1711,7 +1846,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
@@ -1723,7 +1858,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 					uint8_t currVal = 0;
 
 					if (!i2cConfigReceive(
-							&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
+							&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST, &currVal)) {
 						return (false);
 					}
 
@@ -1734,7 +1869,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_RANGE_LOGA: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS,
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE,
 							REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR, &currVal)) {
 						return (false);
 					}
@@ -1746,7 +1881,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_RANGE_LOGD: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS,
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE,
 							REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR, &currVal)) {
 						return (false);
 					}
@@ -1758,7 +1893,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_LEVEL_SF: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
 						return (false);
 					}
 
@@ -1769,7 +1904,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_LEVEL_nOFF: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_LEVEL_SFOFF, &currVal)) {
 						return (false);
 					}
 
@@ -1780,7 +1915,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_AMP: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_AMP, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_AMP, &currVal)) {
 						return (false);
 					}
 
@@ -1791,7 +1926,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_ON: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_ON, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_ON, &currVal)) {
 						return (false);
 					}
 
@@ -1802,7 +1937,7 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 				case SAMSUNG_EVK_DVS_BIAS_CURRENT_OFF: {
 					uint8_t currVal = 0;
 
-					if (!i2cConfigReceive(&state->usbState, DEVICE_DVS, REGISTER_BIAS_CURRENT_OFF, &currVal)) {
+					if (!i2cConfigReceive(&state->usbState, DVS_DEVICE, REGISTER_BIAS_CURRENT_OFF, &currVal)) {
 						return (false);
 					}
 
@@ -1842,6 +1977,15 @@ bool samsungEVKDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *
 		return (false);
 	}
 
+	if (!containerGenerationPoolInit(&state->container)) {
+		freeAllDataMemory(state);
+
+		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to initialize packet container recycling pool.");
+		return (false);
+	}
+
+	containerGenerationPolaritySizeInit(&state->container, SAMSUNG_EVK_POLARITY_DEFAULT_SIZE);
+
 	// Allocate packets.
 	if (!containerGenerationAllocate(&state->container, SAMSUNG_EVK_EVENT_TYPES)) {
 		freeAllDataMemory(state);
@@ -1868,8 +2012,18 @@ bool samsungEVKDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *
 		return (false);
 	}
 
-	// And reset the USB side of things.
-	usbControlResetDataEndpoint(&state->usbState, SAMSUNG_EVK_DATA_ENDPOINT);
+	// And reset the USB side of things. A replay has no device to configure.
+	if (!usbIsReplay(&state->usbState)) {
+		usbControlResetDataEndpoint(&state->usbState, SAMSUNG_EVK_DATA_ENDPOINT);
+	}
+
+	if (usbRawDataIsEnabled(&state->usbState)) {
+		containerGenerationRawDataPoolFill(
+			&state->container, I32T(usbGetTransfersSize(&state->usbState)), handle->info.deviceID);
+	}
+
+	// The decode thread, if any, gets the same back-pressure as the data exchange.
+	usbSetDecodeQueueBlocking(&state->usbState, dataExchangeBlocksProducer(&state->dataExchange));
 
 	if (!usbDataTransfersStart(&state->usbState)) {
 		freeAllDataMemory(state);
@@ -1878,7 +2032,7 @@ bool samsungEVKDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *
 		return (false);
 	}
 
-	if (dataExchangeStartProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&state->usbState) && dataExchangeStartProducers(&state->dataExchange)) {
 		samsungEVKConfigSet(cdh, SAMSUNG_EVK_DVS, SAMSUNG_EVK_DVS_TIMESTAMP_RESET, true);
 		samsungEVKConfigSet(cdh, SAMSUNG_EVK_DVS, SAMSUNG_EVK_DVS_MODE, SAMSUNG_EVK_DVS_MODE_STREAM);
 	}
@@ -1890,7 +2044,7 @@ bool samsungEVKDataStop(caerDeviceHandle cdh) {
 	samsungEVKHandle handle = (samsungEVKHandle) cdh;
 	samsungEVKState state   = &handle->state;
 
-	if (dataExchangeStopProducers(&state->dataExchange)) {
+	if (!usbIsReplay(&state->usbState) && dataExchangeStopProducers(&state->dataExchange)) {
 		samsungEVKConfigSet(cdh, SAMSUNG_EVK_DVS, SAMSUNG_EVK_DVS_MODE, SAMSUNG_EVK_DVS_MODE_OFF);
 	}
 
@@ -1915,6 +2069,28 @@ caerEventPacketContainer samsungEVKDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&state->dataExchange, &state->usbState.dataTransfersRun));
 }
 
+size_t samsungEVKDataGetMany(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	samsungEVKHandle handle = (samsungEVKHandle) cdh;
+	samsungEVKState state   = &handle->state;
+
+	return (dataExchangeGetMany(&state->dataExchange, &state->usbState.dataTransfersRun, containers, maxContainers));
+}
+
+void samsungEVKDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	samsungEVKHandle handle = (samsungEVKHandle) cdh;
+	samsungEVKState state   = &handle->state;
+
+	containerGenerationRecycle(&state->container, container);
+}
+
+static caerEventPacketHeader samsungEVKRawDataExchange(void *vhd, caerEventPacketHeader packet, int32_t capacity) {
+	samsungEVKHandle handle = vhd;
+	samsungEVKState state   = &handle->state;
+
+	return (containerGenerationRawDataExchange(&state->container, packet, capacity, &state->dataExchange,
+		&state->usbState.dataTransfersRun, handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel));
+}
+
 static inline bool ensureSpaceForEvents(
 	caerEventPacketHeader *packet, size_t position, size_t numEvents, samsungEVKHandle handle) {
 	if ((position + numEvents) <= (size_t) caerEventPacketHeaderGetEventCapacity(*packet)) {
@@ -1929,6 +2105,8 @@ static inline bool ensureSpaceForEvents(
 		return (false);
 	}
 
+	dataStatisticsIncrease(&handle->state.container.statistics.packetsGrown, 1);
+
 	*packet = grownPacket;
 	return (true);
 }
@@ -1945,6 +2123,52 @@ static void resetParser(samsungEVKHandle handle, const char *reason) {
 	samsungEVKLog(CAER_LOG_INFO, handle, "Parser reset, reason: %s.", reason);
 }
 
+// Per-event-type commit triggers, see containerGenerationIsTypeCommitDue().
+static inline bool samsungEVKIsTypeCommitDue(samsungEVKState state) {
+	containerGeneration container = &state->container;
+	int64_t timestamp             = generateFullTimestamp(state->timestamps.wrapOverflow, state->timestamps.current);
+
+	return (containerGenerationIsTypeCommitDue(
+				container, SPECIAL_EVENT, state->currentPackets.specialPosition, timestamp)
+			|| containerGenerationIsTypeCommitDue(
+				container, POLARITY_EVENT, state->currentPackets.polarityPosition, timestamp));
+}
+
+static void samsungEVKContainerCommit(samsungEVKHandle handle, bool tsReset) {
+	samsungEVKState state = &handle->state;
+
+	// One or more of the commit triggers are hit. Set the packet container up to contain
+	// any non-empty packets. Empty packets are not forwarded to save memory.
+	bool emptyContainerCommit = true;
+
+	// Track how many polarity events go into a container, to pre-size the next packet.
+	containerGenerationPolaritySizeUpdate(&state->container, state->currentPackets.polarityPosition);
+
+	if (state->currentPackets.polarityPosition > 0) {
+		polarityGroupCountersCommit(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+		containerGenerationSetPacket(
+			&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+		state->currentPackets.polarity         = NULL;
+		state->currentPackets.polarityPosition = 0;
+		emptyContainerCommit                   = false;
+	}
+
+	if (state->currentPackets.specialPosition > 0) {
+		containerGenerationSetPacket(
+			&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+		state->currentPackets.special         = NULL;
+		state->currentPackets.specialPosition = 0;
+		emptyContainerCommit                  = false;
+	}
+
+	containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+		state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
+		handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+}
+
 static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const size_t bufferSize) {
 	samsungEVKHandle handle = vhd;
 	samsungEVKState state   = &handle->state;
@@ -1972,8 +2196,13 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 		}
 
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			state->currentPackets.special = (caerSpecialEventPacket) containerGenerationPacketReuse(&state->container,
+				SPECIAL_EVENT, SPECIAL_EVENT, SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, state->timestamps.wrapOverflow);
+			if (state->currentPackets.special == NULL) {
+				state->currentPackets.special = caerSpecialEventPacketAllocate(
+					SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.special == NULL) {
 				samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
 				return;
@@ -1981,8 +2210,15 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 		}
 
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				SAMSUNG_EVK_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			int32_t polaritySize = containerGenerationPolaritySizePredict(&state->container);
+
+			state->currentPackets.polarity = (caerPolarityEventPacket) containerGenerationPacketReuse(
+				&state->container, POLARITY_EVENT, POLARITY_EVENT, polaritySize, state->timestamps.wrapOverflow);
+			if (state->currentPackets.polarity == NULL) {
+				state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+					polaritySize, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+			}
+
 			if (state->currentPackets.polarity == NULL) {
 				samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
 				return;
@@ -2032,49 +2268,16 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 				continue;
 			}
 
-			uint8_t group1Events = (event >> 0) & 0x00FF;
-			bool group1Polarity  = (((event >> 16) & 0x01) == 0); // ON polarity is 0 here.
-
-			for (uint8_t i = 0, mask = 0x01; i < 8; i++, mask = U8T(mask << 1)) {
-				// Check if event present first.
-				if ((group1Events & mask) == 0) {
-					continue;
-				}
+			// Bits 15-0 hold the presence masks of both groups, bits 17-16 their polarities.
+			const uint16_t groupsEvents = event & 0xFFFF;
+			const bool group1Polarity   = (((event >> 16) & 0x01) == 0); // ON polarity is 0 here.
+			const bool group2Polarity   = (((event >> 17) & 0x01) == 0);
 
-				// Received event!
-				caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-					state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-				// Timestamp at event-stream insertion point.
-				caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-				caerPolarityEventSetPolarity(currentPolarityEvent, group1Polarity);
-				caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastColumn));
-				caerPolarityEventSetY(currentPolarityEvent, U16T(group1Address + i));
-				caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-				state->currentPackets.polarityPosition++;
-			}
-
-			uint8_t group2Events = (event >> 8) & 0x00FF;
-			bool group2Polarity  = (((event >> 17) & 0x01) == 0); // ON polarity is 0 here.
-
-			for (uint8_t i = 0, mask = 0x01; i < 8; i++, mask = U8T(mask << 1)) {
-				// Check if event present first.
-				if ((group2Events & mask) == 0) {
-					continue;
-				}
-
-				// Received event!
-				caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-					state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-				// Timestamp at event-stream insertion point.
-				caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-				caerPolarityEventSetPolarity(currentPolarityEvent, group2Polarity);
-				caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastColumn));
-				caerPolarityEventSetY(currentPolarityEvent, U16T(group2Address + i));
-				caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-				state->currentPackets.polarityPosition++;
-			}
+			state->currentPackets.polarityPosition += polarityGroupPairExpand(state->currentPackets.polarity,
+				state->currentPackets.polarityPosition, groupsEvents,
+				polarityGroupEventData(U16T(state->dvs.lastColumn), U16T(group1Address), group1Polarity),
+				polarityGroupEventData(U16T(state->dvs.lastColumn), U16T(group2Address), group2Polarity),
+				polarityGroupPixelStep(false), state->timestamps.current);
 		}
 		else {
 			// COLUMN event.
@@ -2192,36 +2395,20 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
+		bool containerTypeCommit
+			= containerGenerationIsTypeCommitEnabled(&state->container) && samsungEVKIsTypeCommitDue(state);
+
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
-
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
-
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
-			}
-
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
-				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit || containerTypeCommit) {
+			samsungEVKContainerCommit(handle, tsReset);
 		}
 	}
+
+	// Host-clock latency bound: also commit when no further events come to trigger it.
+	if (containerGenerationIsCommitLatencyElapsed(&state->container)) {
+		samsungEVKContainerCommit(handle, false);
+	}
 }
 
 static bool i2cConfigSend(usbState state, uint16_t deviceAddr, uint16_t byteAddr, uint8_t param) {
@@ -6,6 +6,7 @@
 
 #include "container_generation.h"
 #include "data_exchange.h"
+#include "polarity_group.h"
 #include "usb_utils.h"
 
 #define SAMSUNG_EVK_EVENT_TYPES 2
@@ -15,6 +16,8 @@
 
 #define SAMSUNG_EVK_DEVICE_NAME "Samsung EVK"
 
+#define SAMSUNG_EVK_RECORD_FIELDS 21
+
 #define SAMSUNG_EVK_DEVICE_VID 0x04B4
 #define SAMSUNG_EVK_DEVICE_PID 0x00F1
 
@@ -24,8 +27,9 @@
 #define VENDOR_REQUEST_I2C_READ  0xBB
 #define VENDOR_REQUEST_RESET     0xBC
 
-#define DEVICE_FPGA 0x0040
-#define DEVICE_DVS  0x0020
+// I2C device addresses.
+#define FPGA_DEVICE 0x0040
+#define DVS_DEVICE  0x0020
 
 #define REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGSFONREST      0x000B
 #define REGISTER_BIAS_CURRENT_RANGE_SELECT_LOGALOGD_MONITOR 0x000C
@@ -160,6 +164,9 @@ caerDeviceHandle samsungEVKOpen(
 	uint16_t deviceID, uint8_t busNumberRestrict, uint8_t devAddressRestrict, const char *serialNumberRestrict);
 bool samsungEVKClose(caerDeviceHandle cdh);
 
+caerDeviceHandle samsungEVKReplayOpen(uint16_t deviceID, const char *filePath, bool maxSpeed);
+bool samsungEVKRawRecordStart(caerDeviceHandle cdh, const char *filePath);
+
 bool samsungEVKSendDefaultConfig(caerDeviceHandle cdh);
 // Negative addresses are used for host-side configuration.
 // Positive addresses (including zero) are used for device-side configuration.
@@ -171,5 +178,7 @@ bool samsungEVKDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(voi
 	void *dataShutdownUserPtr);
 bool samsungEVKDataStop(caerDeviceHandle handle);
 caerEventPacketContainer samsungEVKDataGet(caerDeviceHandle handle);
+size_t samsungEVKDataGetMany(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+void samsungEVKDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_SAMSUNG_EVK_H_ */
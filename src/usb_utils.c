@@ -1,5 +1,7 @@
 #include "usb_utils.h"
 
+#include "portable_time.h"
+
 struct usb_control_struct {
 	union {
 		void (*controlOutCallback)(void *controlOutCallbackPtr, int status);
@@ -24,12 +26,61 @@ static void caerUSBLog(enum caer_log_level logLevel, usbState state, const char
 
 static int usbThreadRun(void *usbStatePtr);
 
+static void usbThreadSchedulingUpdate(usbState state, uint32_t *cpuAffinity, uint32_t *realTimePriority);
+
 static bool usbAllocateTransfers(usbState state);
 
-static void usbCancelAndDeallocateTransfers(usbState state);
+static void usbCancelAndDeallocateTransfers(usbState state, bool handleEvents);
+
+static void usbAutoTuneUpdate(usbState state);
+
+static bool usbAutoTuneApply(usbState state, uint32_t transfersNumber, uint32_t transfersSize);
+
+static void usbFreeTransfer(usbState state, struct libusb_transfer *transfer);
+
+static uint8_t *usbDataBufferAllocate(usbState state, size_t capacity);
+
+static void usbDataBufferFree(usbState state, uint8_t *buffer);
+
+static uint8_t *usbDataBufferHandle(usbState state, uint8_t *buffer, size_t length, size_t capacity);
+
+static caerEventPacketHeader usbRawDataHandOver(
+	usbState state, caerEventPacketHeader packet, int32_t length, int32_t capacity);
+
+static bool usbDecodeThreadStart(usbState state);
+
+static void usbDecodeThreadStop(usbState state);
+
+static int usbDecodeThreadRun(void *usbStatePtr);
+
+static usbDecodeBuffer usbDecodeBufferGet(usbState state, size_t capacity);
+
+static void usbDecodeWaitForSpace(usbState state, int64_t waitTimeUs);
+
+static uint8_t *usbDecodeHandOver(usbState state, uint8_t *data, size_t length, size_t capacity);
+
+static void usbDecodeQueueDrain(usbState state);
+
+static bool usbRecordThreadStart(usbState state);
+
+static void usbRecordThreadStop(usbState state);
+
+static int usbRecordThreadRun(void *usbStatePtr);
+
+static void usbRecordTransfer(usbState state, const uint8_t *buffer, size_t bufferSize);
+
+static void usbRecordStop(usbState state);
+
+static int usbReplayThreadRun(void *usbStatePtr);
 
 static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer);
 
+static void usbDataTransferResubmit(usbState state, struct libusb_transfer *transfer);
+
+static void usbCompletedTransfersHandle(usbState state);
+
+static void usbDataIdleHandle(usbState state);
+
 static bool usbControlTransferAsync(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
 	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status),
 	void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize),
@@ -308,6 +359,8 @@ bool usbDeviceOpen(usbState state, uint16_t devVID, uint16_t devPID, uint8_t bus
 	// Ensure no content.
 	memset(deviceInfo, 0, sizeof(struct caer_device_discovery_result));
 
+	atomic_store(&state->usbEventTimeout, USB_EVENT_TIMEOUT_DEFAULT);
+
 	// Search for device and open it.
 	// Initialize libusb using a separate context for each device.
 	// This is to correctly support one thread per device.
@@ -685,6 +738,12 @@ bool usbDeviceOpen(usbState state, uint16_t devVID, uint16_t devPID, uint8_t bus
 void usbDeviceClose(usbState state) {
 	mtx_destroy(&state->dataTransfersLock);
 
+	if (usbIsReplay(state)) {
+		fclose(state->replayFile);
+		state->replayFile = NULL;
+		return;
+	}
+
 	// Release interface 0 (default).
 	libusb_release_interface(state->deviceHandle, 0);
 
@@ -737,6 +796,18 @@ void usbSetDataCallback(usbState state,
 	state->usbDataCallbackPtr = usbDataCallbackPtr;
 }
 
+void usbSetRawDataCallback(usbState state,
+	caerEventPacketHeader (*usbRawDataCallback)(
+		void *usbRawDataCallbackPtr, caerEventPacketHeader packet, int32_t capacity),
+	void *usbRawDataCallbackPtr) {
+	state->usbRawDataCallback    = usbRawDataCallback;
+	state->usbRawDataCallbackPtr = usbRawDataCallbackPtr;
+}
+
+void usbSetStatistics(usbState state, dataStatistics statistics) {
+	state->statistics = statistics;
+}
+
 void usbSetShutdownCallback(
 	usbState state, void (*usbShutdownCallback)(void *usbShutdownCallbackPtr), void *usbShutdownCallbackPtr) {
 	state->usbShutdownCallback    = usbShutdownCallback;
@@ -749,6 +820,11 @@ void usbSetDataEndpoint(usbState state, uint8_t dataEndPoint) {
 	state->dataEndPoint = dataEndPoint;
 }
 
+// Only takes effect on usbDataTransfersStart() calls.
+void usbSetDecodeQueueBlocking(usbState state, bool decodeQueueBlocking) {
+	state->decodeQueueBlocking = decodeQueueBlocking;
+}
+
 void usbSetTransfersNumber(usbState state, uint32_t transfersNumber) {
 	mtx_lock(&state->dataTransfersLock);
 
@@ -761,9 +837,9 @@ void usbSetTransfersNumber(usbState state, uint32_t transfersNumber) {
 	atomic_store(&state->usbBufferNumber, transfersNumber);
 
 	// Cancel transfers, wait for them to terminate, deallocate, and
-	// then reallocate with new size/number.
-	if (usbDataTransfersAreRunning(state)) {
-		usbCancelAndDeallocateTransfers(state);
+	// then reallocate with new size/number. Replay has no transfers.
+	if (usbDataTransfersAreRunning(state) && !usbIsReplay(state)) {
+		usbCancelAndDeallocateTransfers(state, false);
 
 		// Check again, for exceptional shutdown may have set this to false.
 		if (usbDataTransfersAreRunning(state)) {
@@ -786,9 +862,9 @@ void usbSetTransfersSize(usbState state, uint32_t transfersSize) {
 	atomic_store(&state->usbBufferSize, transfersSize);
 
 	// Cancel transfers, wait for them to terminate, deallocate, and
-	// then reallocate with new size/number.
-	if (usbDataTransfersAreRunning(state)) {
-		usbCancelAndDeallocateTransfers(state);
+	// then reallocate with new size/number. Replay has no transfers.
+	if (usbDataTransfersAreRunning(state) && !usbIsReplay(state)) {
+		usbCancelAndDeallocateTransfers(state, false);
 
 		// Check again, for exceptional shutdown may have set this to false.
 		if (usbDataTransfersAreRunning(state)) {
@@ -808,6 +884,11 @@ uint32_t usbGetTransfersSize(usbState state) {
 }
 
 bool usbThreadStart(usbState state) {
+	// Replay has no USB events to handle.
+	if (usbIsReplay(state)) {
+		return (true);
+	}
+
 	// Start USB thread.
 	if ((errno = thrd_create(&state->usbThread, &usbThreadRun, state)) != thrd_success) {
 		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to create USB thread. Error: %d.", errno);
@@ -823,6 +904,10 @@ bool usbThreadStart(usbState state) {
 }
 
 void usbThreadStop(usbState state) {
+	if (usbIsReplay(state)) {
+		return;
+	}
+
 	// Shut down USB thread.
 	atomic_store(&state->usbThreadRun, false);
 
@@ -843,255 +928,1713 @@ static int usbThreadRun(void *usbStatePtr) {
 	// Set thread name.
 	thrd_set_name(state->usbThreadName);
 
+	// Scheduling starts out inherited from the creating thread.
+	uint32_t cpuAffinity      = 0;
+	uint32_t realTimePriority = 0;
+	usbThreadSchedulingUpdate(state, &cpuAffinity, &realTimePriority);
+
 	// Signal data thread ready back to start function.
 	atomic_store(&state->usbThreadRun, true);
 
 	caerUSBLog(CAER_LOG_DEBUG, state, "USB thread running.");
 
-	// Handle USB events (10 millisecond timeout).
-	struct timeval te = {.tv_sec = 0, .tv_usec = 10000};
-
+	// Handle USB events (configurable timeout, 10 milliseconds by default).
 	while (atomic_load_explicit(&state->usbThreadRun, memory_order_relaxed)) {
-		libusb_handle_events_timeout(state->deviceContext, &te);
-	}
+		uint32_t timeout = U32T(atomic_load_explicit(&state->usbEventTimeout, memory_order_relaxed));
 
-	caerUSBLog(CAER_LOG_DEBUG, state, "USB thread shut down.");
+		struct timeval te = {.tv_sec = (long) (timeout / 1000000), .tv_usec = (long) (timeout % 1000000)};
 
-	return (EXIT_SUCCESS);
-}
+		libusb_handle_events_timeout(state->deviceContext, &te);
 
-bool usbDataTransfersStart(usbState state) {
-	mtx_lock(&state->dataTransfersLock);
-	bool retVal = usbAllocateTransfers(state);
-	if (retVal) {
-		atomic_store(&state->dataTransfersRun, TRANS_RUNNING);
-	}
-	mtx_unlock(&state->dataTransfersLock);
+		if (state->completedTransfersNumber > 0) {
+			usbCompletedTransfersHandle(state);
+		}
 
-	return (retVal);
-}
+		if (!state->dataReceived) {
+			usbDataIdleHandle(state);
+		}
 
-void usbDataTransfersStop(usbState state) {
-	mtx_lock(&state->dataTransfersLock);
-	atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
-	usbCancelAndDeallocateTransfers(state);
-	mtx_unlock(&state->dataTransfersLock);
-}
+		state->dataReceived = false;
 
-// MUST LOCK ON 'dataTransfersLock'.
-static bool usbAllocateTransfers(usbState state) {
-	uint32_t bufferNum  = usbGetTransfersNumber(state);
-	uint32_t bufferSize = usbGetTransfersSize(state);
+		usbAutoTuneUpdate(state);
 
-	// Set number of transfers and allocate memory for the main transfer array.
-	state->dataTransfers = calloc(bufferNum, sizeof(struct libusb_transfer *));
-	if (state->dataTransfers == NULL) {
-		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to allocate memory for %" PRIu32 " libusb transfers. Error: %d.",
-			bufferNum, errno);
-		return (false);
+		usbThreadSchedulingUpdate(state, &cpuAffinity, &realTimePriority);
 	}
-	state->dataTransfersLength = bufferNum;
 
-	// Allocate transfers and set them up.
-	for (size_t i = 0; i < bufferNum; i++) {
-		state->dataTransfers[i] = libusb_alloc_transfer(0);
-		if (state->dataTransfers[i] == NULL) {
-			caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to allocate further libusb transfers (%zu of %" PRIu32 ").", i,
-				bufferNum);
-			continue;
-		}
+	caerUSBLog(CAER_LOG_DEBUG, state, "USB thread shut down.");
 
-		// Create data buffer.
-		state->dataTransfers[i]->length = (int) bufferSize;
-		state->dataTransfers[i]->buffer = malloc(bufferSize);
-		if (state->dataTransfers[i]->buffer == NULL) {
-			caerUSBLog(
-				CAER_LOG_CRITICAL, state, "Unable to allocate buffer for libusb transfer %zu. Error: %d.", i, errno);
+	return (EXIT_SUCCESS);
+}
 
-			libusb_free_transfer(state->dataTransfers[i]);
-			state->dataTransfers[i] = NULL;
+// Apply the configured CPU affinity and real-time priority to the calling
+// thread, if they differ from the ones it currently uses, which are updated.
+static void usbThreadSchedulingUpdate(usbState state, uint32_t *cpuAffinity, uint32_t *realTimePriority) {
+	uint32_t newCpuAffinity = U32T(atomic_load_explicit(&state->usbThreadCpuAffinity, memory_order_relaxed));
 
-			continue;
+	if (newCpuAffinity != *cpuAffinity) {
+		*cpuAffinity = newCpuAffinity;
+
+		if (thrd_set_affinity(newCpuAffinity) != thrd_success) {
+			caerUSBLog(CAER_LOG_ERROR, state, "Failed to set thread CPU affinity to 0x%" PRIX32 ".", newCpuAffinity);
 		}
+	}
 
-		// Initialize Transfer.
-		state->dataTransfers[i]->dev_handle = state->deviceHandle;
-		state->dataTransfers[i]->endpoint   = state->dataEndPoint;
-		state->dataTransfers[i]->type       = LIBUSB_TRANSFER_TYPE_BULK;
-		state->dataTransfers[i]->callback   = &usbDataTransferCallback;
-		state->dataTransfers[i]->user_data  = state;
-		state->dataTransfers[i]->timeout    = 0;
-		state->dataTransfers[i]->flags      = LIBUSB_TRANSFER_FREE_BUFFER;
+	uint32_t newRealTimePriority = U32T(atomic_load_explicit(&state->usbThreadRealTimePriority, memory_order_relaxed));
 
-		if ((errno = libusb_submit_transfer(state->dataTransfers[i])) == LIBUSB_SUCCESS) {
-			atomic_fetch_add(&state->activeDataTransfers, 1);
-		}
-		else {
-			caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to submit libusb transfer %zu. Error: %s (%d).", i,
-				libusb_strerror(errno), errno);
+	if (newRealTimePriority != *realTimePriority) {
+		*realTimePriority = newRealTimePriority;
 
-			// The transfer buffer is freed automatically here thanks to
-			// the LIBUSB_TRANSFER_FREE_BUFFER flag set above.
-			libusb_free_transfer(state->dataTransfers[i]);
-			state->dataTransfers[i] = NULL;
+		if (thrd_set_realtime_priority((int) newRealTimePriority) != thrd_success) {
+			caerUSBLog(CAER_LOG_ERROR, state,
+				"Failed to set thread real-time priority to %" PRIu32 ". Missing privileges?", newRealTimePriority);
 		}
 	}
+}
 
-	if (atomic_load(&state->activeDataTransfers) == 0) {
-		// Didn't manage to allocate any USB transfers, free array memory and log failure.
-		free(state->dataTransfers);
-		state->dataTransfers       = NULL;
-		state->dataTransfersLength = 0;
+// Grow or shrink the data transfers depending on how full they were over the
+// last statistics window. Mostly full buffers mean data is piling up on the
+// device, mostly empty ones that the data rate is low. The two thresholds are
+// far apart, and several windows in a row must agree, so changes never flip
+// back and forth: after halving the size, buffers are at most 25% filled.
+static void usbAutoTuneUpdate(usbState state) {
+	struct timespec currentTime;
+	portable_clock_gettime_monotonic(&currentTime);
 
-		caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to allocate any libusb transfers.");
-		return (false);
+	int64_t windowTimeUs = (I64T(currentTime.tv_sec - state->autoTuneWindowStart.tv_sec) * 1000000LL)
+						   + (I64T(currentTime.tv_nsec - state->autoTuneWindowStart.tv_nsec) / 1000);
+
+	if (windowTimeUs < USB_AUTO_TUNE_WINDOW_US) {
+		return;
 	}
 
-	return (true);
-}
+	uint32_t transfers     = state->autoTuneTransfers;
+	uint32_t fullTransfers = state->autoTuneFullTransfers;
+	uint64_t bytes         = state->autoTuneBytes;
 
-// MUST LOCK ON 'dataTransfersLock'.
-static void usbCancelAndDeallocateTransfers(usbState state) {
-	// Wait for all transfers to go away.
-	while (atomic_load(&state->activeDataTransfers) > 0) {
-		// Continue trying to cancel all transfers until there are none left.
-		// It seems like one cancel pass is not enough and some hang around.
-		for (size_t i = 0; i < state->dataTransfersLength; i++) {
-			if (state->dataTransfers[i] != NULL) {
-				errno = libusb_cancel_transfer(state->dataTransfers[i]);
-				if ((errno != LIBUSB_SUCCESS) && (errno != LIBUSB_ERROR_NOT_FOUND)) {
-					caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to cancel libusb transfer %zu. Error: %s (%d).", i,
-						libusb_strerror(errno), errno);
-					// Proceed with trying to cancel all transfers regardless of errors.
-				}
-			}
-		}
+	state->autoTuneWindowStart   = currentTime;
+	state->autoTuneTransfers     = 0;
+	state->autoTuneFullTransfers = 0;
+	state->autoTuneBytes         = 0;
 
-		// Sleep for 1ms to avoid busy loop.
-		thrd_sleep(1000);
+	if ((!atomic_load_explicit(&state->autoTune, memory_order_relaxed)) || (!usbDataTransfersAreRunning(state))
+		|| (transfers == 0)) {
+		state->autoTuneVotes = 0;
+		return;
 	}
 
-	// No more transfers in flight, deallocate them all here.
-	for (size_t i = 0; i < state->dataTransfersLength; i++) {
-		if (state->dataTransfers[i] != NULL) {
-			libusb_free_transfer(state->dataTransfers[i]);
-			state->dataTransfers[i] = NULL;
-		}
-	}
+	uint32_t transfersNumber = usbGetTransfersNumber(state);
+	uint32_t transfersSize   = usbGetTransfersSize(state);
 
-	// And lastly free the transfers array.
-	free(state->dataTransfers);
-	state->dataTransfers       = NULL;
-	state->dataTransfersLength = 0;
-}
+	double fullRatio = (double) fullTransfers / (double) transfers;
+	double fillRatio = (double) bytes / ((double) transfers * (double) transfersSize);
 
-static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer) {
-	usbState state = transfer->user_data;
+	int32_t vote = 0;
 
-	// Completed or cancelled transfers are what we expect to handle here, so
-	// if they do have data attached, try to parse them.
-	if (((transfer->status == LIBUSB_TRANSFER_COMPLETED) || (transfer->status == LIBUSB_TRANSFER_CANCELLED))
-		&& (transfer->actual_length > 0)) {
-		// Handle data.
-		(*state->usbDataCallback)(state->usbDataCallbackPtr, transfer->buffer, (size_t) transfer->actual_length);
+	if ((fullRatio >= 0.5)
+		&& ((transfersSize < USB_AUTO_TUNE_SIZE_MAX) || (transfersNumber < USB_AUTO_TUNE_NUMBER_MAX))) {
+		vote = 1;
 	}
-
-	// Only status that indicates a new transfer can be really submitted is
-	// COMPLETED. TIMED_OUT is impossible, and ERROR/STALL/NO_DEVICE/CANCELLED
-	// are not recoverable, as all of them appear on different OSes when a
-	// device is physically unplugged for example.
-	if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
-		// Submit transfer again.
-		if (libusb_submit_transfer(transfer) == LIBUSB_SUCCESS) {
-			return;
-		}
+	else if ((fillRatio <= 0.125)
+			 && ((transfersSize > USB_AUTO_TUNE_SIZE_MIN) || (transfersNumber > USB_AUTO_TUNE_NUMBER_MIN))) {
+		vote = -1;
 	}
 
-	// Cannot recover (cancelled, no device, or other critical error).
-	// Signal this by adjusting the counters and exiting.
-	// Freeing the transfers is taken care of by usbCancelAndDeallocateTransfers().
-	// 'activeDataTransfers' drops to zero in three cases:
-	// - the device went away
-	// - the data transfers were stopped, which cancels all transfers
-	// - the USB buffer number/size changed, which cancels all transfers
-	// The second and third case are intentional user actions, so we don't notify.
-	// In the first case, the last transfer to go away calls the shutdown
-	// callback and notifies that we're exiting, and not via normal cancellation.
-	// On MacOS X, when an error occurs (like device being unplugged), not all
-	// transfers return with the expected error code, but only one, the rest returns
-	// LIBUSB_TRANSFER_CANCELLED, which we only expect on actual user cancel actions.
-	// To track this, we count the transfers that did fail with any other error code,
-	// and use that information to determine if the shutdown was intentional by the
-	// user or not. If not, at least one transfer would fail with a non-cancel error.
-	if (transfer->status != LIBUSB_TRANSFER_CANCELLED) {
-		// This also captures COMPLETED but with re-submit failure.
-		state->failedDataTransfers++;
+	// Votes only add up while they agree.
+	if ((vote == 0) || ((vote > 0) != (state->autoTuneVotes > 0))) {
+		state->autoTuneVotes = vote;
+	}
+	else {
+		state->autoTuneVotes += vote;
 	}
 
-	// Transfers are handled sequentially always in the same thread, so these
-	// reads here are correct.
-	if ((atomic_load(&state->activeDataTransfers) == 1) && (state->failedDataTransfers > 0)) {
-		// Ensure run is set to false on exceptional shut-down.
-		atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+	if (abs(state->autoTuneVotes) < USB_AUTO_TUNE_VOTES) {
+		return;
+	}
 
-		// We make sure to first set 'dataTransfersRun' to false on exceptional
-		// shut-down, before doing the subtraction, so that anyone waiting on
-		// 'activeDataTransfers' to become zero, will see RUN changed to false too.
-		atomic_store(&state->activeDataTransfers, 0);
+	// Buffer size changes first, as it trades per-transfer overhead against latency.
+	uint32_t newTransfersNumber = transfersNumber;
+	uint32_t newTransfersSize   = transfersSize;
 
-		// Call exceptional shut-down callback,
-		if (state->usbShutdownCallback != NULL) {
-			state->usbShutdownCallback(state->usbShutdownCallbackPtr);
+	if (vote > 0) {
+		if (transfersSize < USB_AUTO_TUNE_SIZE_MAX) {
+			newTransfersSize = (transfersSize > (USB_AUTO_TUNE_SIZE_MAX / 2)) ? (USB_AUTO_TUNE_SIZE_MAX)
+																			  : (transfersSize * 2);
+		}
+		else {
+			newTransfersNumber = (transfersNumber > (USB_AUTO_TUNE_NUMBER_MAX / 2)) ? (USB_AUTO_TUNE_NUMBER_MAX)
+																					: (transfersNumber * 2);
 		}
 	}
 	else {
-		// Normal shutdown/count-down.
-		atomic_fetch_sub(&state->activeDataTransfers, 1);
+		if (transfersSize > USB_AUTO_TUNE_SIZE_MIN) {
+			newTransfersSize = (transfersSize < (USB_AUTO_TUNE_SIZE_MIN * 2)) ? (USB_AUTO_TUNE_SIZE_MIN)
+																			  : (transfersSize / 2);
+		}
+		else {
+			newTransfersNumber = (transfersNumber < (USB_AUTO_TUNE_NUMBER_MIN * 2)) ? (USB_AUTO_TUNE_NUMBER_MIN)
+																					: (transfersNumber / 2);
+		}
 	}
 
-	// Clear error tracking counter on last exit.
-	if ((atomic_load(&state->activeDataTransfers) == 0) && (state->failedDataTransfers > 0)) {
-		state->failedDataTransfers = 0;
+	// If busy, votes stay, so this is retried after the next window.
+	if (!usbAutoTuneApply(state, newTransfersNumber, newTransfersSize)) {
+		return;
 	}
+
+	state->autoTuneVotes = 0;
+
+	caerUSBLog(CAER_LOG_INFO, state,
+		"Buffer auto-tuning: %.0f transfers/s, %.0f%% full, %.0f%% filled on average. %s buffers from %" PRIu32
+		" x %" PRIu32 " to %" PRIu32 " x %" PRIu32 " bytes.",
+		(double) transfers * 1.0E6 / (double) windowTimeUs, fullRatio * 100.0, fillRatio * 100.0,
+		(vote > 0) ? ("Growing") : ("Shrinking"), transfersNumber, transfersSize, newTransfersNumber,
+		newTransfersSize);
 }
 
-static bool usbControlTransferAsync(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
-	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status),
-	void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize),
-	void *controlCallbackPtr, bool directionOut) {
-	// If doing IN, data must always be NULL, the callback will handle it.
-	if ((!directionOut) && (data != NULL)) {
+// Change the data transfers' number and size from the USB thread. Returns
+// false if busy, as the lock holder may be waiting for the USB thread.
+static bool usbAutoTuneApply(usbState state, uint32_t transfersNumber, uint32_t transfersSize) {
+	if (mtx_trylock(&state->dataTransfersLock) != thrd_success) {
 		return (false);
 	}
 
-	// If doing OUT and data is NULL (no data), dataSize must be zero!
-	if (directionOut && (data == NULL) && (dataSize != 0)) {
-		return (false);
-	}
+	atomic_store(&state->usbBufferNumber, transfersNumber);
+	atomic_store(&state->usbBufferSize, transfersSize);
 
-	struct libusb_transfer *controlTransfer = libusb_alloc_transfer(0);
-	if (controlTransfer == NULL) {
-		return (false);
+	if (usbDataTransfersAreRunning(state)) {
+		usbCancelAndDeallocateTransfers(state, true);
+
+		// Check again, for exceptional shutdown may have set this to false.
+		if (usbDataTransfersAreRunning(state)) {
+			usbAllocateTransfers(state);
+		}
 	}
 
-	// Create data buffer.
-	uint8_t *controlTransferBuffer
-		= calloc(1, (LIBUSB_CONTROL_SETUP_SIZE + dataSize + sizeof(struct usb_control_struct)));
-	if (controlTransferBuffer == NULL) {
-		caerUSBLog(
-			CAER_LOG_CRITICAL, state, "Unable to allocate buffer for libusb control transfer. Error: %d.", errno);
+	mtx_unlock(&state->dataTransfersLock);
 
-		libusb_free_transfer(controlTransfer);
+	return (true);
+}
+
+bool usbDataTransfersStart(usbState state) {
+	state->rawDataActive = usbRawDataIsEnabled(state);
 
+	// Raw data is not translated, so there is nothing to decode.
+	state->decodeThreadActive = atomic_load(&state->decodeThreadEnabled) && !state->rawDataActive;
+
+	if (state->decodeThreadActive && !usbDecodeThreadStart(state)) {
+		state->decodeThreadActive = false;
 		return (false);
 	}
 
-	// Put additional data in the unused part of the transfer buffer, this way
-	// all memory is in one block and freed when the transfer is freed.
-	usbControl extraControlData = (usbControl) &controlTransferBuffer[LIBUSB_CONTROL_SETUP_SIZE + dataSize];
+	if (usbIsReplay(state)) {
+		// Replay always restarts from the first recorded transfer.
+		if (fseek(state->replayFile, state->replayDataOffset, SEEK_SET) != 0) {
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to rewind raw replay file.");
+			return (false);
+		}
 
-	if (controlOutCallback != NULL) {
-		extraControlData->controlOutCallback = controlOutCallback;
+		atomic_store(&state->dataTransfersRun, TRANS_RUNNING);
+
+		if ((errno = thrd_create(&state->replayThread, &usbReplayThreadRun, state)) != thrd_success) {
+			atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to create replay thread. Error: %d.", errno);
+
+			usbDecodeThreadStop(state);
+			return (false);
+		}
+
+		state->replayThreadStarted = true;
+
+		return (true);
+	}
+
+	if ((state->recordFile != NULL) && !usbRecordThreadStart(state)) {
+		usbRecordStop(state);
+		usbDecodeThreadStop(state);
+		return (false);
+	}
+
+	mtx_lock(&state->dataTransfersLock);
+	bool retVal = usbAllocateTransfers(state);
+	if (retVal) {
+		atomic_store(&state->dataTransfersRun, TRANS_RUNNING);
+	}
+	mtx_unlock(&state->dataTransfersLock);
+
+	if (!retVal) {
+		usbRecordStop(state);
+		usbDecodeThreadStop(state);
+	}
+
+	return (retVal);
+}
+
+void usbDataTransfersStop(usbState state) {
+	if (usbIsReplay(state)) {
+		atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+
+		if (state->replayThreadStarted) {
+			if ((errno = thrd_join(state->replayThread, NULL)) != thrd_success) {
+				// This should never happen!
+				caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to join replay thread. Error: %d.", errno);
+			}
+
+			state->replayThreadStarted = false;
+		}
+
+		usbDecodeThreadStop(state);
+		return;
+	}
+
+	mtx_lock(&state->dataTransfersLock);
+	atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+	usbCancelAndDeallocateTransfers(state, false);
+	mtx_unlock(&state->dataTransfersLock);
+
+	// All transfers are gone, so the recording can be safely closed.
+	usbRecordStop(state);
+
+	// Nothing can be queued anymore, so the decode thread can go too.
+	usbDecodeThreadStop(state);
+}
+
+static bool usbDecodeThreadStart(usbState state) {
+	// Queue size must be a power of two. The number of transfers can change while
+	// running, up to USB_AUTO_TUNE_NUMBER_MAX with auto-tuning, and the queue can't.
+	uint32_t transfersNumber = usbGetTransfersNumber(state);
+	if (transfersNumber < USB_AUTO_TUNE_NUMBER_MAX) {
+		transfersNumber = USB_AUTO_TUNE_NUMBER_MAX;
+	}
+
+	size_t queueSize = 16;
+	while (queueSize < (USB_DECODE_QUEUE_BUFFERS_FACTOR * (size_t) transfersNumber)) {
+		queueSize *= 2;
+	}
+
+	if (mtx_init(&state->decodeWaitLock, mtx_plain) != thrd_success) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize decode wait lock.");
+		return (false);
+	}
+
+	if (cnd_init(&state->decodeWaitCond) != thrd_success) {
+		mtx_destroy(&state->decodeWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize decode wait condition.");
+		return (false);
+	}
+
+	if (mtx_init(&state->decodeSpaceWaitLock, mtx_plain) != thrd_success) {
+		cnd_destroy(&state->decodeWaitCond);
+		mtx_destroy(&state->decodeWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize decode space wait lock.");
+		return (false);
+	}
+
+	if (cnd_init(&state->decodeSpaceWaitCond) != thrd_success) {
+		mtx_destroy(&state->decodeSpaceWaitLock);
+		cnd_destroy(&state->decodeWaitCond);
+		mtx_destroy(&state->decodeWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize decode space wait condition.");
+		return (false);
+	}
+
+	state->decodeQueue     = caerRingBufferInit(queueSize);
+	state->decodeFreeQueue = caerRingBufferInit(queueSize);
+	if ((state->decodeQueue == NULL) || (state->decodeFreeQueue == NULL)) {
+		if (state->decodeQueue != NULL) {
+			caerRingBufferFree(state->decodeQueue);
+		}
+		if (state->decodeFreeQueue != NULL) {
+			caerRingBufferFree(state->decodeFreeQueue);
+		}
+		cnd_destroy(&state->decodeSpaceWaitCond);
+		mtx_destroy(&state->decodeSpaceWaitLock);
+		cnd_destroy(&state->decodeWaitCond);
+		mtx_destroy(&state->decodeWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to allocate decode queues.");
+		return (false);
+	}
+
+	atomic_store(&state->decodeQueueDepth, 0);
+	atomic_store(&state->decodeQueueDepthMax, 0);
+	atomic_store(&state->decodeQueueDropped, 0);
+	atomic_store(&state->decodeWaiting, false);
+	atomic_store(&state->decodeSpaceWaiting, false);
+	atomic_store(&state->decodeThreadRun, true);
+
+	if ((errno = thrd_create(&state->decodeThread, &usbDecodeThreadRun, state)) != thrd_success) {
+		caerRingBufferFree(state->decodeQueue);
+		caerRingBufferFree(state->decodeFreeQueue);
+		cnd_destroy(&state->decodeSpaceWaitCond);
+		mtx_destroy(&state->decodeSpaceWaitLock);
+		cnd_destroy(&state->decodeWaitCond);
+		mtx_destroy(&state->decodeWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to create decode thread. Error: %d.", errno);
+		return (false);
+	}
+
+	return (true);
+}
+
+static void usbDecodeThreadStop(usbState state) {
+	if (!state->decodeThreadActive) {
+		return;
+	}
+
+	atomic_store(&state->decodeThreadRun, false);
+
+	mtx_lock(&state->decodeWaitLock);
+	cnd_signal(&state->decodeWaitCond);
+	mtx_unlock(&state->decodeWaitLock);
+
+	if ((errno = thrd_join(state->decodeThread, NULL)) != thrd_success) {
+		// This should never happen!
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to join decode thread. Error: %d.", errno);
+	}
+
+	// Data still queued after stopping is discarded, like any data arriving late.
+	usbDecodeBuffer buffer;
+
+	while ((buffer = caerRingBufferGet(state->decodeQueue)) != NULL) {
+		free(buffer);
+	}
+
+	while ((buffer = caerRingBufferGet(state->decodeFreeQueue)) != NULL) {
+		free(buffer);
+	}
+
+	caerRingBufferFree(state->decodeQueue);
+	caerRingBufferFree(state->decodeFreeQueue);
+	cnd_destroy(&state->decodeSpaceWaitCond);
+	mtx_destroy(&state->decodeSpaceWaitLock);
+	cnd_destroy(&state->decodeWaitCond);
+	mtx_destroy(&state->decodeWaitLock);
+
+	atomic_store(&state->decodeQueueDepth, 0);
+
+	state->decodeThreadActive = false;
+}
+
+// This thread translates the queued USB data, from data transfers start to stop.
+static int usbDecodeThreadRun(void *usbStatePtr) {
+	usbState state = usbStatePtr;
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Starting decode thread ...");
+
+	// Set thread name.
+	thrd_set_name(state->usbThreadName);
+
+	// Same scheduling as the USB thread, see usbThreadRun().
+	uint32_t cpuAffinity      = 0;
+	uint32_t realTimePriority = 0;
+	usbThreadSchedulingUpdate(state, &cpuAffinity, &realTimePriority);
+
+	while (atomic_load_explicit(&state->decodeThreadRun, memory_order_relaxed)) {
+		usbThreadSchedulingUpdate(state, &cpuAffinity, &realTimePriority);
+
+		usbDecodeBuffer buffer = caerRingBufferGet(state->decodeQueue);
+
+		if (buffer == NULL) {
+			// Wait for new data (same timeout as the USB thread), see dataExchangeWaitForData().
+			uint32_t waitTimeout = U32T(atomic_load_explicit(&state->usbEventTimeout, memory_order_relaxed));
+
+			mtx_lock(&state->decodeWaitLock);
+
+			atomic_store(&state->decodeWaiting, true);
+			atomic_thread_fence(memory_order_seq_cst);
+
+			if (caerRingBufferEmpty(state->decodeQueue)
+				&& atomic_load_explicit(&state->decodeThreadRun, memory_order_relaxed)) {
+				cnd_timedwait(&state->decodeWaitCond, &state->decodeWaitLock, waitTimeout);
+			}
+
+			atomic_store(&state->decodeWaiting, false);
+
+			mtx_unlock(&state->decodeWaitLock);
+
+			// Still no data, let the translator run anyway, see usbDataIdleHandle().
+			if (caerRingBufferEmpty(state->decodeQueue) && usbDataTransfersAreRunning(state)) {
+				(*state->usbDataCallback)(state->usbDataCallbackPtr, NULL, 0);
+			}
+
+			continue;
+		}
+
+		// Wake up the producer, if it is waiting for space, see usbDecodeHandOver().
+		atomic_thread_fence(memory_order_seq_cst);
+
+		if (atomic_load_explicit(&state->decodeSpaceWaiting, memory_order_relaxed)) {
+			mtx_lock(&state->decodeSpaceWaitLock);
+			cnd_signal(&state->decodeSpaceWaitCond);
+			mtx_unlock(&state->decodeSpaceWaitLock);
+		}
+
+		(*state->usbDataCallback)(state->usbDataCallbackPtr, buffer->data, buffer->length);
+
+		// Only counts as dequeued once translated, see usbDecodeQueueDrain().
+		atomic_fetch_sub_explicit(&state->decodeQueueDepth, 1, memory_order_release);
+
+		// Give the buffer back for reuse, or free it if enough are waiting.
+		if (!caerRingBufferPut(state->decodeFreeQueue, buffer)) {
+			free(buffer);
+		}
+	}
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Decode thread shut down.");
+
+	return (EXIT_SUCCESS);
+}
+
+// Wait for all queued data to be translated, or for data transfers to stop.
+static void usbDecodeQueueDrain(usbState state) {
+	if (!state->decodeThreadActive) {
+		return;
+	}
+
+	while ((atomic_load_explicit(&state->decodeQueueDepth, memory_order_acquire) != 0)
+		   && usbDataTransfersAreRunning(state)) {
+		thrd_sleep(1000);
+	}
+}
+
+// Buffers are reused if big enough, possibly replacing them with bigger ones.
+// The free queue only supports a single consumer: this is called by the USB
+// thread (or the replay thread), or before any transfer is submitted.
+static usbDecodeBuffer usbDecodeBufferGet(usbState state, size_t capacity) {
+	usbDecodeBuffer buffer = caerRingBufferGet(state->decodeFreeQueue);
+
+	if (buffer != NULL) {
+		if (buffer->capacity >= capacity) {
+			return (buffer);
+		}
+
+		free(buffer);
+	}
+
+	buffer = malloc(sizeof(struct usb_decode_buffer) + capacity);
+	if (buffer == NULL) {
+		return (NULL);
+	}
+
+	buffer->capacity = capacity;
+	buffer->length   = 0;
+
+	return (buffer);
+}
+
+// Wait for the decode thread to make space in the queue, or until waitTimeUs
+// have elapsed, see dataExchangeWaitForSpace().
+static void usbDecodeWaitForSpace(usbState state, int64_t waitTimeUs) {
+	mtx_lock(&state->decodeSpaceWaitLock);
+
+	atomic_store(&state->decodeSpaceWaiting, true);
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (caerRingBufferFull(state->decodeQueue)) {
+		cnd_timedwait(&state->decodeSpaceWaitCond, &state->decodeSpaceWaitLock, waitTimeUs);
+	}
+
+	atomic_store(&state->decodeSpaceWaiting, false);
+
+	mtx_unlock(&state->decodeSpaceWaitLock);
+}
+
+// Queue the 'length' bytes of data just received for the decode thread.
+// Returns the empty buffer to receive the next data into, or the same one
+// if the data had to be dropped.
+static uint8_t *usbDecodeHandOver(usbState state, uint8_t *data, size_t length, size_t capacity) {
+	// The decode thread is running behind. With the block-producer policy, wait
+	// for space: this applies back-pressure on the device, as if translating on
+	// this thread, like the data exchange does. Otherwise drop the new data, as
+	// only the decode thread can take data out of the queue. Replay always waits,
+	// it has no device to lose data on.
+	while (caerRingBufferFull(state->decodeQueue)) {
+		if (!state->decodeQueueBlocking && !usbIsReplay(state)) {
+			atomic_fetch_add_explicit(&state->decodeQueueDropped, 1, memory_order_relaxed);
+			return (data);
+		}
+
+		if (!usbDataTransfersAreRunning(state)) {
+			return (data);
+		}
+
+		usbDecodeWaitForSpace(state, 10000);
+	}
+
+	usbDecodeBuffer emptyBuffer = usbDecodeBufferGet(state, capacity);
+	if (emptyBuffer == NULL) {
+		caerUSBLog(CAER_LOG_ERROR, state, "Failed to allocate decode buffer, dropping USB data.");
+		return (data);
+	}
+
+	usbDecodeBuffer buffer = usbDecodeBufferFromData(data);
+	buffer->length         = length;
+
+	// The depth is increased first, so that it never goes negative when the
+	// decode thread is quick to take the buffer out, see dataExchangeCommitNoNotify().
+	uint_fast32_t depth = atomic_fetch_add_explicit(&state->decodeQueueDepth, 1, memory_order_relaxed) + 1;
+	if (depth > atomic_load_explicit(&state->decodeQueueDepthMax, memory_order_relaxed)) {
+		atomic_store_explicit(&state->decodeQueueDepthMax, depth, memory_order_relaxed);
+	}
+
+	// Can't fail, there is space and this is the only producer.
+	caerRingBufferPut(state->decodeQueue, buffer);
+
+	// Wake up the decode thread, if it is waiting, see dataExchangeWakeConsumer().
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (atomic_load_explicit(&state->decodeWaiting, memory_order_relaxed)) {
+		mtx_lock(&state->decodeWaitLock);
+		cnd_signal(&state->decodeWaitCond);
+		mtx_unlock(&state->decodeWaitLock);
+	}
+
+	return (emptyBuffer->data);
+}
+
+// Fixed-width, little-endian encoding of recording data, see struct usb_record_header.
+static inline void usbRecordPut16(uint8_t *bytes, uint16_t value) {
+	value = htole16(value);
+	memcpy(bytes, &value, sizeof(value));
+}
+
+static inline void usbRecordPut32(uint8_t *bytes, uint32_t value) {
+	value = htole32(value);
+	memcpy(bytes, &value, sizeof(value));
+}
+
+static inline void usbRecordPut64(uint8_t *bytes, uint64_t value) {
+	value = htole64(value);
+	memcpy(bytes, &value, sizeof(value));
+}
+
+static inline uint16_t usbRecordGet16(const uint8_t *bytes) {
+	uint16_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return (le16toh(value));
+}
+
+static inline uint32_t usbRecordGet32(const uint8_t *bytes) {
+	uint32_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return (le32toh(value));
+}
+
+static inline uint64_t usbRecordGet64(const uint8_t *bytes) {
+	uint64_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return (le64toh(value));
+}
+
+// Size of a field in memory, zero for strings, whose size is their array's.
+static size_t usbRecordFieldMemorySize(enum usb_record_field_type type) {
+	switch (type) {
+		case USB_RECORD_BOOL:
+			return (sizeof(bool));
+
+		case USB_RECORD_UINT8:
+			return (sizeof(uint8_t));
+
+		case USB_RECORD_ATOMIC_UINT8:
+			return (sizeof(atomic_uint_fast8_t));
+
+		case USB_RECORD_INT16:
+		case USB_RECORD_UINT16:
+			return (sizeof(uint16_t));
+
+		case USB_RECORD_INT32:
+			return (sizeof(int32_t));
+
+		case USB_RECORD_INT64:
+			return (sizeof(int64_t));
+
+		case USB_RECORD_ENUM:
+			return (sizeof(int));
+
+		case USB_RECORD_FLOAT:
+			return (sizeof(float));
+
+		case USB_RECORD_STRING:
+		default:
+			return (0);
+	}
+}
+
+// Size of a field in the recording, excluding its type and, for strings, their content.
+static size_t usbRecordFieldFileSize(enum usb_record_field_type type) {
+	switch (type) {
+		case USB_RECORD_BOOL:
+		case USB_RECORD_UINT8:
+		case USB_RECORD_ATOMIC_UINT8:
+			return (1);
+
+		case USB_RECORD_INT16:
+		case USB_RECORD_UINT16:
+		case USB_RECORD_STRING:
+			return (2);
+
+		case USB_RECORD_INT32:
+		case USB_RECORD_ENUM:
+		case USB_RECORD_FLOAT:
+			return (4);
+
+		case USB_RECORD_INT64:
+			return (8);
+
+		default:
+			return (0);
+	}
+}
+
+static bool usbRecordFieldIsValid(const struct usb_record_field *field) {
+	if (field->type == USB_RECORD_STRING) {
+		// Strings must fit their array, with the NUL, and their length a uint16.
+		return ((field->size > 0) && (field->size <= UINT16_MAX));
+	}
+
+	size_t memorySize = usbRecordFieldMemorySize(field->type);
+
+	return ((memorySize != 0) && (field->size == memorySize));
+}
+
+static bool usbRecordFieldWrite(FILE *recordFile, const struct usb_record_field *field) {
+	uint8_t bytes[1 + 8];
+	bytes[0] = U8T(field->type);
+
+	size_t stringLength = 0;
+
+	switch (field->type) {
+		case USB_RECORD_BOOL:
+			bytes[1] = *((const bool *) field->data);
+			break;
+
+		case USB_RECORD_UINT8:
+			bytes[1] = *((const uint8_t *) field->data);
+			break;
+
+		case USB_RECORD_ATOMIC_UINT8:
+			bytes[1] = U8T(atomic_load((atomic_uint_fast8_t *) field->data));
+			break;
+
+		case USB_RECORD_INT16:
+		case USB_RECORD_UINT16: {
+			uint16_t value;
+			memcpy(&value, field->data, sizeof(value));
+			usbRecordPut16(&bytes[1], value);
+			break;
+		}
+
+		case USB_RECORD_INT32:
+		case USB_RECORD_FLOAT: {
+			uint32_t value;
+			memcpy(&value, field->data, sizeof(value));
+			usbRecordPut32(&bytes[1], value);
+			break;
+		}
+
+		case USB_RECORD_INT64: {
+			uint64_t value;
+			memcpy(&value, field->data, sizeof(value));
+			usbRecordPut64(&bytes[1], value);
+			break;
+		}
+
+		case USB_RECORD_ENUM:
+			usbRecordPut32(&bytes[1], U32T(*((const int *) field->data)));
+			break;
+
+		case USB_RECORD_STRING:
+			stringLength = strnlen(field->data, field->size - 1);
+			usbRecordPut16(&bytes[1], U16T(stringLength));
+			break;
+	}
+
+	if (fwrite(bytes, 1 + usbRecordFieldFileSize(field->type), 1, recordFile) != 1) {
+		return (false);
+	}
+
+	return ((stringLength == 0) || (fwrite(field->data, stringLength, 1, recordFile) == 1));
+}
+
+static bool usbRecordFieldRead(FILE *replayFile, const struct usb_record_field *field) {
+	uint8_t bytes[1 + 8];
+
+	// The type must match too, else the state layout changed.
+	if ((fread(bytes, 1 + usbRecordFieldFileSize(field->type), 1, replayFile) != 1) || (bytes[0] != field->type)) {
+		return (false);
+	}
+
+	switch (field->type) {
+		case USB_RECORD_BOOL:
+			*((bool *) field->data) = (bytes[1] != 0);
+			break;
+
+		case USB_RECORD_UINT8:
+			*((uint8_t *) field->data) = bytes[1];
+			break;
+
+		case USB_RECORD_ATOMIC_UINT8:
+			atomic_store((atomic_uint_fast8_t *) field->data, bytes[1]);
+			break;
+
+		case USB_RECORD_INT16:
+		case USB_RECORD_UINT16: {
+			uint16_t value = usbRecordGet16(&bytes[1]);
+			memcpy(field->data, &value, sizeof(value));
+			break;
+		}
+
+		case USB_RECORD_INT32:
+		case USB_RECORD_FLOAT: {
+			uint32_t value = usbRecordGet32(&bytes[1]);
+			memcpy(field->data, &value, sizeof(value));
+			break;
+		}
+
+		case USB_RECORD_INT64: {
+			uint64_t value = usbRecordGet64(&bytes[1]);
+			memcpy(field->data, &value, sizeof(value));
+			break;
+		}
+
+		case USB_RECORD_ENUM:
+			*((int *) field->data) = I32T(usbRecordGet32(&bytes[1]));
+			break;
+
+		case USB_RECORD_STRING: {
+			size_t stringLength = usbRecordGet16(&bytes[1]);
+			if (stringLength >= field->size) {
+				return (false);
+			}
+
+			if ((stringLength > 0) && (fread(field->data, stringLength, 1, replayFile) != 1)) {
+				return (false);
+			}
+
+			((char *) field->data)[stringLength] = '\0';
+			break;
+		}
+	}
+
+	return (true);
+}
+
+bool usbRecordStart(usbState state, const char *filePath, uint16_t deviceType, const struct usb_record_field *fields,
+	size_t fieldsNumber) {
+	if ((filePath == NULL) || (fieldsNumber > USB_RECORD_FIELDS)) {
+		return (false);
+	}
+
+	for (size_t i = 0; i < fieldsNumber; i++) {
+		if (!usbRecordFieldIsValid(&fields[i])) {
+			// This should never happen!
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Raw recording field %zu has an invalid type or size.", i);
+			return (false);
+		}
+	}
+
+	// The recording must cover a full data session, so that replay starts
+	// from the same translator state. The file is closed on data stop.
+	if (usbIsReplay(state) || (state->recordFile != NULL) || usbDataTransfersAreRunning(state)) {
+		caerUSBLog(CAER_LOG_ERROR, state,
+			"Raw recording can only be started once, before data transfers are started, and not on replay.");
+		return (false);
+	}
+
+	FILE *recordFile = fopen(filePath, "wb");
+	if (recordFile == NULL) {
+		caerUSBLog(CAER_LOG_ERROR, state, "Failed to open raw recording file '%s'. Error: %d.", filePath, errno);
+		return (false);
+	}
+
+	uint8_t headerBytes[USB_RECORD_HEADER_SIZE];
+	memcpy(headerBytes, USB_RECORD_MAGIC, sizeof(USB_RECORD_MAGIC));
+	usbRecordPut32(&headerBytes[8], USB_RECORD_VERSION);
+	usbRecordPut16(&headerBytes[12], deviceType);
+	usbRecordPut16(&headerBytes[14], U16T(fieldsNumber));
+
+	bool headerWritten = (fwrite(headerBytes, sizeof(headerBytes), 1, recordFile) == 1);
+
+	for (size_t i = 0; i < fieldsNumber; i++) {
+		headerWritten = headerWritten && usbRecordFieldWrite(recordFile, &fields[i]);
+	}
+
+	if (!headerWritten) {
+		caerUSBLog(CAER_LOG_ERROR, state, "Failed to write raw recording header to '%s'.", filePath);
+
+		fclose(recordFile);
+		return (false);
+	}
+
+	state->recordFile = recordFile;
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Raw recording to '%s' armed.", filePath);
+
+	return (true);
+}
+
+// Append one USB data transfer to the recording: its entry, then its data.
+bool usbRecordEntryWrite(FILE *recordFile, uint64_t timestamp, const uint8_t *buffer, size_t bufferSize) {
+	uint8_t entryBytes[USB_RECORD_ENTRY_SIZE];
+	usbRecordPut64(&entryBytes[0], timestamp);
+	usbRecordPut32(&entryBytes[8], U32T(bufferSize));
+	usbRecordPut32(&entryBytes[12], 0);
+
+	return ((fwrite(entryBytes, sizeof(entryBytes), 1, recordFile) == 1)
+			&& (fwrite(buffer, bufferSize, 1, recordFile) == 1));
+}
+
+static bool usbReplayEntryRead(FILE *replayFile, struct usb_record_entry *entry) {
+	uint8_t entryBytes[USB_RECORD_ENTRY_SIZE];
+
+	if (fread(entryBytes, sizeof(entryBytes), 1, replayFile) != 1) {
+		return (false);
+	}
+
+	entry->timestamp = usbRecordGet64(&entryBytes[0]);
+	entry->length    = usbRecordGet32(&entryBytes[8]);
+	entry->reserved  = usbRecordGet32(&entryBytes[12]);
+
+	return (true);
+}
+
+static bool usbRecordThreadStart(usbState state) {
+	if (mtx_init(&state->recordWaitLock, mtx_plain) != thrd_success) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize recording wait lock.");
+		return (false);
+	}
+
+	if (cnd_init(&state->recordWaitCond) != thrd_success) {
+		mtx_destroy(&state->recordWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize recording wait condition.");
+		return (false);
+	}
+
+	state->recordQueue     = caerRingBufferInit(USB_RECORD_QUEUE_SIZE);
+	state->recordFreeQueue = caerRingBufferInit(USB_RECORD_QUEUE_SIZE);
+	if ((state->recordQueue == NULL) || (state->recordFreeQueue == NULL)) {
+		if (state->recordQueue != NULL) {
+			caerRingBufferFree(state->recordQueue);
+		}
+		if (state->recordFreeQueue != NULL) {
+			caerRingBufferFree(state->recordFreeQueue);
+		}
+		cnd_destroy(&state->recordWaitCond);
+		mtx_destroy(&state->recordWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to allocate recording queues.");
+		return (false);
+	}
+
+	portable_clock_gettime_monotonic(&state->recordStartTime);
+
+	atomic_store(&state->recordWaiting, false);
+	atomic_store(&state->recordActive, true);
+	atomic_store(&state->recordThreadRun, true);
+
+	if ((errno = thrd_create(&state->recordThread, &usbRecordThreadRun, state)) != thrd_success) {
+		caerRingBufferFree(state->recordQueue);
+		caerRingBufferFree(state->recordFreeQueue);
+		cnd_destroy(&state->recordWaitCond);
+		mtx_destroy(&state->recordWaitLock);
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to create recording thread. Error: %d.", errno);
+		return (false);
+	}
+
+	state->recordThreadActive = true;
+
+	return (true);
+}
+
+// Only called once nothing is queueing data anymore: all queued data is still written.
+static void usbRecordThreadStop(usbState state) {
+	if (!state->recordThreadActive) {
+		return;
+	}
+
+	atomic_store(&state->recordThreadRun, false);
+
+	mtx_lock(&state->recordWaitLock);
+	cnd_signal(&state->recordWaitCond);
+	mtx_unlock(&state->recordWaitLock);
+
+	if ((errno = thrd_join(state->recordThread, NULL)) != thrd_success) {
+		// This should never happen!
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to join recording thread. Error: %d.", errno);
+	}
+
+	usbRecordBuffer buffer;
+
+	while ((buffer = caerRingBufferGet(state->recordQueue)) != NULL) {
+		free(buffer);
+	}
+
+	while ((buffer = caerRingBufferGet(state->recordFreeQueue)) != NULL) {
+		free(buffer);
+	}
+
+	caerRingBufferFree(state->recordQueue);
+	caerRingBufferFree(state->recordFreeQueue);
+	cnd_destroy(&state->recordWaitCond);
+	mtx_destroy(&state->recordWaitLock);
+
+	state->recordThreadActive = false;
+}
+
+// This thread writes the queued USB data to the recording, so that disk
+// latency never holds up the USB thread and the resubmission of transfers.
+static int usbRecordThreadRun(void *usbStatePtr) {
+	usbState state = usbStatePtr;
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Starting recording thread ...");
+
+	// Set thread name.
+	thrd_set_name(state->usbThreadName);
+
+	while (true) {
+		usbRecordBuffer buffer = caerRingBufferGet(state->recordQueue);
+
+		if (buffer == NULL) {
+			// Stop only once all the data queued until then is written.
+			if (!atomic_load(&state->recordThreadRun)) {
+				break;
+			}
+
+			// Wait for new data, see dataExchangeWaitForData().
+			mtx_lock(&state->recordWaitLock);
+
+			atomic_store(&state->recordWaiting, true);
+			atomic_thread_fence(memory_order_seq_cst);
+
+			if (caerRingBufferEmpty(state->recordQueue) && atomic_load(&state->recordThreadRun)) {
+				cnd_timedwait(&state->recordWaitCond, &state->recordWaitLock, 100000);
+			}
+
+			atomic_store(&state->recordWaiting, false);
+
+			mtx_unlock(&state->recordWaitLock);
+
+			continue;
+		}
+
+		if (atomic_load_explicit(&state->recordActive, memory_order_relaxed)
+			&& !usbRecordEntryWrite(state->recordFile, buffer->timestamp, buffer->data, buffer->length)) {
+			caerUSBLog(CAER_LOG_ERROR, state, "Failed to write to raw recording, stopping it.");
+
+			atomic_store(&state->recordActive, false);
+		}
+
+		// Give the buffer back for reuse, or free it if enough are waiting.
+		if (!caerRingBufferPut(state->recordFreeQueue, buffer)) {
+			free(buffer);
+		}
+	}
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Recording thread shut down.");
+
+	return (EXIT_SUCCESS);
+}
+
+// Queue a copy of the data just received for the writer thread. If it falls
+// too far behind, the recording is stopped, as it can't have gaps in it.
+static void usbRecordTransfer(usbState state, const uint8_t *buffer, size_t bufferSize) {
+	if (!atomic_load_explicit(&state->recordActive, memory_order_relaxed)) {
+		return;
+	}
+
+	struct timespec currentTime;
+	portable_clock_gettime_monotonic(&currentTime);
+
+	int64_t timeDifferenceNano = (I64T(currentTime.tv_sec - state->recordStartTime.tv_sec) * 1000000000LL)
+								 + I64T(currentTime.tv_nsec - state->recordStartTime.tv_nsec);
+
+	// Buffers are reused if big enough, see usbDecodeBufferGet().
+	usbRecordBuffer recordBuffer = caerRingBufferGet(state->recordFreeQueue);
+
+	if ((recordBuffer != NULL) && (recordBuffer->capacity < bufferSize)) {
+		free(recordBuffer);
+		recordBuffer = NULL;
+	}
+
+	if (recordBuffer == NULL) {
+		recordBuffer = malloc(sizeof(struct usb_record_buffer) + bufferSize);
+		if (recordBuffer == NULL) {
+			caerUSBLog(CAER_LOG_ERROR, state, "Failed to allocate raw recording buffer, stopping recording.");
+
+			atomic_store(&state->recordActive, false);
+			return;
+		}
+
+		recordBuffer->capacity = bufferSize;
+	}
+
+	recordBuffer->timestamp = U64T(timeDifferenceNano / 1000);
+	recordBuffer->length    = bufferSize;
+	memcpy(recordBuffer->data, buffer, bufferSize);
+
+	if (!caerRingBufferPut(state->recordQueue, recordBuffer)) {
+		caerUSBLog(CAER_LOG_ERROR, state, "Raw recording can't keep up with the data rate, stopping it.");
+
+		free(recordBuffer);
+		atomic_store(&state->recordActive, false);
+		return;
+	}
+
+	// Wake up the writer thread, if it is waiting, see dataExchangeWakeConsumer().
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (atomic_load_explicit(&state->recordWaiting, memory_order_relaxed)) {
+		mtx_lock(&state->recordWaitLock);
+		cnd_signal(&state->recordWaitCond);
+		mtx_unlock(&state->recordWaitLock);
+	}
+}
+
+static void usbRecordStop(usbState state) {
+	if (state->recordFile == NULL) {
+		return;
+	}
+
+	usbRecordThreadStop(state);
+
+	fclose(state->recordFile);
+	state->recordFile = NULL;
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Raw recording stopped.");
+}
+
+static FILE *usbReplayReadHeader(const char *filePath, struct usb_record_header *header) {
+	FILE *replayFile = fopen(filePath, "rb");
+	if (replayFile == NULL) {
+		return (NULL);
+	}
+
+	uint8_t headerBytes[USB_RECORD_HEADER_SIZE];
+
+	if ((fread(headerBytes, sizeof(headerBytes), 1, replayFile) != 1)
+		|| (memcmp(headerBytes, USB_RECORD_MAGIC, sizeof(USB_RECORD_MAGIC)) != 0)
+		|| (usbRecordGet32(&headerBytes[8]) != USB_RECORD_VERSION)) {
+		fclose(replayFile);
+		return (NULL);
+	}
+
+	memcpy(header->magic, headerBytes, sizeof(header->magic));
+	header->version      = usbRecordGet32(&headerBytes[8]);
+	header->deviceType   = usbRecordGet16(&headerBytes[12]);
+	header->fieldsNumber = usbRecordGet16(&headerBytes[14]);
+
+	return (replayFile);
+}
+
+int32_t usbReplayDeviceType(const char *filePath) {
+	if (filePath == NULL) {
+		return (-1);
+	}
+
+	struct usb_record_header header;
+
+	FILE *replayFile = usbReplayReadHeader(filePath, &header);
+	if (replayFile == NULL) {
+		return (-1);
+	}
+
+	fclose(replayFile);
+
+	return (header.deviceType);
+}
+
+bool usbReplayOpen(usbState state, const char *filePath, bool maxSpeed, uint16_t deviceType,
+	const struct usb_record_field *fields, size_t fieldsNumber) {
+	struct usb_record_header header;
+
+	FILE *replayFile = usbReplayReadHeader(filePath, &header);
+	if (replayFile == NULL) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to open raw replay file '%s', or invalid format.", filePath);
+		errno = CAER_ERROR_OPEN_ACCESS;
+		return (false);
+	}
+
+	if ((header.deviceType != deviceType) || (header.fieldsNumber != fieldsNumber)) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Raw replay file '%s' was recorded from a different device type.",
+			filePath);
+
+		fclose(replayFile);
+		errno = CAER_ERROR_OPEN_ACCESS;
+		return (false);
+	}
+
+	// Field types must match exactly, else the state layout changed.
+	bool headerRead = true;
+
+	for (size_t i = 0; i < fieldsNumber; i++) {
+		headerRead = headerRead && usbRecordFieldIsValid(&fields[i]) && usbRecordFieldRead(replayFile, &fields[i]);
+	}
+
+	if (!headerRead) {
+		caerUSBLog(CAER_LOG_CRITICAL, state,
+			"Raw replay file '%s' has an incompatible header, it was probably recorded by a different libcaer version.",
+			filePath);
+
+		fclose(replayFile);
+		errno = CAER_ERROR_OPEN_ACCESS;
+		return (false);
+	}
+
+	if (mtx_init(&state->dataTransfersLock, mtx_plain) != thrd_success) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to initialize USB transfer mutex.");
+
+		fclose(replayFile);
+		errno = CAER_ERROR_RESOURCE_ALLOCATION;
+		return (false);
+	}
+
+	state->replayFile       = replayFile;
+	state->replayDataOffset = ftell(replayFile);
+	state->replayMaxSpeed   = maxSpeed;
+
+	return (true);
+}
+
+// This thread stands in for the USB thread on replay, feeding the recorded
+// transfers to the same data callback, either paced at their original
+// wall-clock time or as fast as possible.
+static int usbReplayThreadRun(void *usbStatePtr) {
+	usbState state = usbStatePtr;
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Starting replay thread ...");
+
+	// Set thread name.
+	thrd_set_name(state->usbThreadName);
+
+	// Scheduling starts out inherited from the creating thread.
+	uint32_t cpuAffinity      = 0;
+	uint32_t realTimePriority = 0;
+	usbThreadSchedulingUpdate(state, &cpuAffinity, &realTimePriority);
+
+	struct timespec startTime;
+	portable_clock_gettime_monotonic(&startTime);
+
+	uint8_t *buffer       = NULL;
+	size_t bufferCapacity = 0;
+
+	while (usbDataTransfersAreRunning(state)) {
+		usbThreadSchedulingUpdate(state, &cpuAffinity, &realTimePriority);
+
+		struct usb_record_entry entry;
+
+		if (!usbReplayEntryRead(state->replayFile, &entry)) {
+			break; // End of recording.
+		}
+
+		if (entry.length > bufferCapacity) {
+			usbDataBufferFree(state, buffer);
+
+			buffer = usbDataBufferAllocate(state, entry.length);
+			if (buffer == NULL) {
+				caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to allocate replay buffer of %" PRIu32 " bytes.",
+					entry.length);
+				break;
+			}
+
+			bufferCapacity = entry.length;
+		}
+
+		if (fread(buffer, entry.length, 1, state->replayFile) != 1) {
+			caerUSBLog(CAER_LOG_WARNING, state, "Raw replay file is truncated, stopping.");
+			break;
+		}
+
+		// Wait until the transfer's original time, in steps of the USB event timeout, so
+		// stop requests are honored, and the translator runs without data after each full
+		// step, like on the USB thread, so the container latency bound is still enforced.
+		while ((!state->replayMaxSpeed) && usbDataTransfersAreRunning(state)) {
+			struct timespec currentTime;
+			portable_clock_gettime_monotonic(&currentTime);
+
+			int64_t timeDifferenceNano = (I64T(currentTime.tv_sec - startTime.tv_sec) * 1000000000LL)
+										 + I64T(currentTime.tv_nsec - startTime.tv_nsec);
+			int64_t waitTimeMicro      = I64T(entry.timestamp) - (timeDifferenceNano / 1000);
+
+			if (waitTimeMicro <= 0) {
+				break;
+			}
+
+			int64_t eventTimeout = I64T(atomic_load_explicit(&state->usbEventTimeout, memory_order_relaxed));
+
+			if (waitTimeMicro > eventTimeout) {
+				thrd_sleep(eventTimeout);
+
+				usbDataIdleHandle(state);
+			}
+			else {
+				thrd_sleep(waitTimeMicro);
+			}
+		}
+
+		if (state->statistics != NULL) {
+			dataStatisticsTransfer(state->statistics, entry.length);
+		}
+
+		// Handle data.
+		buffer = usbDataBufferHandle(state, buffer, entry.length, bufferCapacity);
+	}
+
+	usbDataBufferFree(state, buffer);
+
+	// All data must be translated before signaling the end of the recording.
+	usbDecodeQueueDrain(state);
+
+	// The recording ended on its own: signal this like a device going away.
+	if (usbDataTransfersAreRunning(state)) {
+		atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+
+		if (state->usbShutdownCallback != NULL) {
+			state->usbShutdownCallback(state->usbShutdownCallbackPtr);
+		}
+	}
+
+	caerUSBLog(CAER_LOG_DEBUG, state, "Replay thread shut down.");
+
+	return (EXIT_SUCCESS);
+}
+
+// MUST LOCK ON 'dataTransfersLock'.
+static bool usbAllocateTransfers(usbState state) {
+	uint32_t bufferNum  = usbGetTransfersNumber(state);
+	uint32_t bufferSize = usbGetTransfersSize(state);
+
+	// Set number of transfers and allocate memory for the main transfer array.
+	state->dataTransfers = calloc(bufferNum, sizeof(struct libusb_transfer *));
+	if (state->dataTransfers == NULL) {
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to allocate memory for %" PRIu32 " libusb transfers. Error: %d.",
+			bufferNum, errno);
+		return (false);
+	}
+	state->dataTransfersLength = bufferNum;
+
+	// At most all transfers can be waiting for completion coalescing.
+	state->completedTransfers       = calloc(bufferNum, sizeof(struct libusb_transfer *));
+	state->completedTransfersNumber = 0;
+	if (state->completedTransfers == NULL) {
+		free(state->dataTransfers);
+		state->dataTransfers       = NULL;
+		state->dataTransfersLength = 0;
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Failed to allocate memory for completed transfers. Error: %d.", errno);
+		return (false);
+	}
+
+	// Allocate transfers and set them up. All buffers are taken before any transfer
+	// is submitted: once one completes, the USB thread also takes buffers from the
+	// same pools (recycled raw data packets, decode buffers), which only support a
+	// single consumer, see usbDataBufferHandle().
+	for (size_t i = 0; i < bufferNum; i++) {
+		state->dataTransfers[i] = libusb_alloc_transfer(0);
+		if (state->dataTransfers[i] == NULL) {
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to allocate further libusb transfers (%zu of %" PRIu32 ").", i,
+				bufferNum);
+			continue;
+		}
+
+		// Create data buffer.
+		state->dataTransfers[i]->length = (int) bufferSize;
+		state->dataTransfers[i]->buffer = usbDataBufferAllocate(state, bufferSize);
+		if (state->dataTransfers[i]->buffer == NULL) {
+			caerUSBLog(
+				CAER_LOG_CRITICAL, state, "Unable to allocate buffer for libusb transfer %zu. Error: %d.", i, errno);
+
+			libusb_free_transfer(state->dataTransfers[i]);
+			state->dataTransfers[i] = NULL;
+
+			continue;
+		}
+
+		// Initialize Transfer.
+		state->dataTransfers[i]->dev_handle = state->deviceHandle;
+		state->dataTransfers[i]->endpoint   = state->dataEndPoint;
+		state->dataTransfers[i]->type       = LIBUSB_TRANSFER_TYPE_BULK;
+		state->dataTransfers[i]->callback   = &usbDataTransferCallback;
+		state->dataTransfers[i]->user_data  = state;
+		state->dataTransfers[i]->timeout    = 0;
+		state->dataTransfers[i]->flags
+			= (state->rawDataActive || state->decodeThreadActive) ? (0) : (LIBUSB_TRANSFER_FREE_BUFFER);
+	}
+
+	// Submit all transfers that could be set up.
+	for (size_t i = 0; i < bufferNum; i++) {
+		if (state->dataTransfers[i] == NULL) {
+			continue;
+		}
+
+		if ((errno = libusb_submit_transfer(state->dataTransfers[i])) == LIBUSB_SUCCESS) {
+			atomic_fetch_add(&state->activeDataTransfers, 1);
+		}
+		else {
+			caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to submit libusb transfer %zu. Error: %s (%d).", i,
+				libusb_strerror(errno), errno);
+
+			usbFreeTransfer(state, state->dataTransfers[i]);
+			state->dataTransfers[i] = NULL;
+		}
+	}
+
+	if (atomic_load(&state->activeDataTransfers) == 0) {
+		// Didn't manage to allocate any USB transfers, free array memory and log failure.
+		free(state->dataTransfers);
+		state->dataTransfers       = NULL;
+		state->dataTransfersLength = 0;
+
+		free(state->completedTransfers);
+		state->completedTransfers = NULL;
+
+		caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to allocate any libusb transfers.");
+		return (false);
+	}
+
+	return (true);
+}
+
+// MUST LOCK ON 'dataTransfersLock'.
+// When called from the USB thread itself, 'handleEvents' must be true, as the
+// cancelled transfers only go away once their events are handled.
+static void usbCancelAndDeallocateTransfers(usbState state, bool handleEvents) {
+	// Wait for all transfers to go away.
+	while (atomic_load(&state->activeDataTransfers) > 0) {
+		// Continue trying to cancel all transfers until there are none left.
+		// It seems like one cancel pass is not enough and some hang around.
+		for (size_t i = 0; i < state->dataTransfersLength; i++) {
+			if (state->dataTransfers[i] != NULL) {
+				errno = libusb_cancel_transfer(state->dataTransfers[i]);
+				if ((errno != LIBUSB_SUCCESS) && (errno != LIBUSB_ERROR_NOT_FOUND)) {
+					caerUSBLog(CAER_LOG_CRITICAL, state, "Unable to cancel libusb transfer %zu. Error: %s (%d).", i,
+						libusb_strerror(errno), errno);
+					// Proceed with trying to cancel all transfers regardless of errors.
+				}
+			}
+		}
+
+		if (handleEvents) {
+			// Handle events for 1ms, completed transfers are handled as usual.
+			struct timeval te = {.tv_sec = 0, .tv_usec = 1000};
+
+			libusb_handle_events_timeout(state->deviceContext, &te);
+
+			if (state->completedTransfersNumber > 0) {
+				usbCompletedTransfersHandle(state);
+			}
+		}
+		else {
+			// Sleep for 1ms to avoid busy loop.
+			thrd_sleep(1000);
+		}
+	}
+
+	// No more transfers in flight, deallocate them all here.
+	for (size_t i = 0; i < state->dataTransfersLength; i++) {
+		if (state->dataTransfers[i] != NULL) {
+			usbFreeTransfer(state, state->dataTransfers[i]);
+			state->dataTransfers[i] = NULL;
+		}
+	}
+
+	// And lastly free the transfers array.
+	free(state->dataTransfers);
+	state->dataTransfers       = NULL;
+	state->dataTransfersLength = 0;
+
+	free(state->completedTransfers);
+	state->completedTransfers = NULL;
+}
+
+static void usbFreeTransfer(usbState state, struct libusb_transfer *transfer) {
+	// Plain transfer buffers are freed automatically here thanks to the
+	// LIBUSB_TRANSFER_FREE_BUFFER flag, the others are part of a bigger
+	// memory block, see usbDataBufferAllocate().
+	if ((transfer->flags & LIBUSB_TRANSFER_FREE_BUFFER) == 0) {
+		usbDataBufferFree(state, transfer->buffer);
+	}
+
+	libusb_free_transfer(transfer);
+}
+
+// Data buffers are plain memory, unless their data is handed over as a whole
+// instead of being translated right away: with raw data pass-through, they are
+// the data of raw data packets, and with a decode thread, of decode buffers.
+static uint8_t *usbDataBufferAllocate(usbState state, size_t capacity) {
+	if (state->rawDataActive) {
+		return (usbRawDataBuffer((*state->usbRawDataCallback)(state->usbRawDataCallbackPtr, NULL, I32T(capacity))));
+	}
+
+	if (state->decodeThreadActive) {
+		usbDecodeBuffer buffer = usbDecodeBufferGet(state, capacity);
+
+		return ((buffer == NULL) ? (NULL) : (buffer->data));
+	}
+
+	return (malloc(capacity));
+}
+
+static void usbDataBufferFree(usbState state, uint8_t *buffer) {
+	if (state->rawDataActive) {
+		caerEventPacketFree(usbRawDataPacket(buffer));
+	}
+	else if (state->decodeThreadActive) {
+		free(usbDecodeBufferFromData(buffer));
+	}
+	else {
+		free(buffer);
+	}
+}
+
+// Handle the 'length' bytes of data just received into a buffer of 'capacity'
+// bytes. Returns the buffer to receive the next data into, a new one if the
+// data was handed over together with its buffer.
+static uint8_t *usbDataBufferHandle(usbState state, uint8_t *buffer, size_t length, size_t capacity) {
+	if (state->rawDataActive) {
+		return (usbRawDataBuffer(usbRawDataHandOver(state, usbRawDataPacket(buffer), I32T(length), I32T(capacity))));
+	}
+
+	if (state->decodeThreadActive) {
+		return (usbDecodeHandOver(state, buffer, length, capacity));
+	}
+
+	(*state->usbDataCallback)(state->usbDataCallbackPtr, buffer, length);
+
+	return (buffer);
+}
+
+// Complete a raw data packet with the 'length' bytes just received into it, and
+// hand it over. Returns the empty packet to receive the next data into.
+static caerEventPacketHeader usbRawDataHandOver(
+	usbState state, caerEventPacketHeader packet, int32_t length, int32_t capacity) {
+	// Empty packets can be reused ones: data past the new length, left over
+	// from their previous use, must be zeroed, as unused events always are.
+	int32_t previousLength = caerEventPacketHeaderGetEventNumber(packet);
+	if (previousLength > length) {
+		memset(usbRawDataBuffer(packet) + length, 0, (size_t) (previousLength - length));
+	}
+
+	caerEventPacketHeaderSetEventNumber(packet, length);
+	caerEventPacketHeaderSetEventValid(packet, length);
+
+	// Always gives back an empty packet when given one.
+	return ((*state->usbRawDataCallback)(state->usbRawDataCallbackPtr, packet, capacity));
+}
+
+// Completed or cancelled transfers are what we expect to handle, so if they
+// do have data attached, it is parsed.
+static inline bool usbDataTransferHasData(const struct libusb_transfer *transfer) {
+	return (((transfer->status == LIBUSB_TRANSFER_COMPLETED) || (transfer->status == LIBUSB_TRANSFER_CANCELLED))
+			&& (transfer->actual_length > 0));
+}
+
+static void LIBUSB_CALL usbDataTransferCallback(struct libusb_transfer *transfer) {
+	usbState state = transfer->user_data;
+
+	if (usbDataTransferHasData(transfer)) {
+		state->dataReceived = true;
+
+		if (state->statistics != NULL) {
+			dataStatisticsTransfer(state->statistics, (size_t) transfer->actual_length);
+		}
+
+		if (state->recordThreadActive) {
+			usbRecordTransfer(state, transfer->buffer, (size_t) transfer->actual_length);
+		}
+
+		// Buffer auto-tuning statistics, see usbAutoTuneUpdate().
+		if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+			state->autoTuneTransfers++;
+			state->autoTuneFullTransfers += (transfer->actual_length == transfer->length);
+			state->autoTuneBytes += (uint64_t) transfer->actual_length;
+		}
+	}
+
+	// With completion coalescing, data is handled and the transfer resubmitted
+	// at the end of the current event handling round, see usbCompletedTransfersHandle().
+	// This goes for transfers of any status, so that the data of cancelled ones, when
+	// the transfers are reallocated, still comes after that of the completed ones
+	// before them. Also once coalescing is turned off, until those are handled.
+	if (atomic_load_explicit(&state->completionCoalescing, memory_order_relaxed)
+		|| (state->completedTransfersNumber > 0)) {
+		state->completedTransfers[state->completedTransfersNumber++] = transfer;
+		return;
+	}
+
+	if (usbDataTransferHasData(transfer)) {
+		// Handle data.
+		transfer->buffer = usbDataBufferHandle(
+			state, transfer->buffer, (size_t) transfer->actual_length, (size_t) transfer->length);
+	}
+
+	usbDataTransferResubmit(state, transfer);
+}
+
+// Handle the data of all the transfers that finished during the last event handling
+// round, in completion order, and then resubmit them all, or let the cancelled and
+// failed ones go.
+static void usbCompletedTransfersHandle(usbState state) {
+	struct libusb_transfer **completedTransfers = state->completedTransfers;
+	size_t completedTransfersNumber             = state->completedTransfersNumber;
+
+	for (size_t i = 0; i < completedTransfersNumber; i++) {
+		struct libusb_transfer *transfer = completedTransfers[i];
+
+		if (usbDataTransferHasData(transfer)) {
+			transfer->buffer = usbDataBufferHandle(
+				state, transfer->buffer, (size_t) transfer->actual_length, (size_t) transfer->length);
+		}
+	}
+
+	// Once the last cancelled transfer is let go, usbCancelAndDeallocateTransfers()
+	// may free and reallocate the array from another thread, so it's done with first.
+	state->completedTransfersNumber = 0;
+
+	for (size_t i = 0; i < completedTransfersNumber; i++) {
+		usbDataTransferResubmit(state, completedTransfers[i]);
+	}
+}
+
+// Let the translator run without data, after an event handling round in which
+// none arrived, so that pending events can still be committed on the host-clock
+// latency bound, see containerGenerationIsCommitLatencyElapsed(). This counts as
+// an active transfer meanwhile, so that usbCancelAndDeallocateTransfers() waits
+// for it, and only happens while there are transfers. Replay has no transfers:
+// its thread is the only one translating, and calls this while pacing data.
+static void usbDataIdleHandle(usbState state) {
+	// Raw data is not translated, and the decode thread does this itself.
+	if (state->rawDataActive || state->decodeThreadActive) {
+		return;
+	}
+
+	if (usbIsReplay(state)) {
+		(*state->usbDataCallback)(state->usbDataCallbackPtr, NULL, 0);
+		return;
+	}
+
+	uint_fast32_t activeDataTransfers = atomic_load(&state->activeDataTransfers);
+
+	do {
+		if (activeDataTransfers == 0) {
+			return;
+		}
+	} while (!atomic_compare_exchange_weak(
+		&state->activeDataTransfers, &activeDataTransfers, activeDataTransfers + 1));
+
+	(*state->usbDataCallback)(state->usbDataCallbackPtr, NULL, 0);
+
+	atomic_fetch_sub(&state->activeDataTransfers, 1);
+}
+
+static void usbDataTransferResubmit(usbState state, struct libusb_transfer *transfer) {
+	// Only status that indicates a new transfer can be really submitted is
+	// COMPLETED. TIMED_OUT is impossible, and ERROR/STALL/NO_DEVICE/CANCELLED
+	// are not recoverable, as all of them appear on different OSes when a
+	// device is physically unplugged for example.
+	if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+		// Submit transfer again.
+		if (libusb_submit_transfer(transfer) == LIBUSB_SUCCESS) {
+			return;
+		}
+	}
+
+	// Cannot recover (cancelled, no device, or other critical error).
+	// Signal this by adjusting the counters and exiting.
+	// Freeing the transfers is taken care of by usbCancelAndDeallocateTransfers().
+	// 'activeDataTransfers' drops to zero in three cases:
+	// - the device went away
+	// - the data transfers were stopped, which cancels all transfers
+	// - the USB buffer number/size changed, which cancels all transfers
+	// The second and third case are intentional user actions, so we don't notify.
+	// In the first case, the last transfer to go away calls the shutdown
+	// callback and notifies that we're exiting, and not via normal cancellation.
+	// On MacOS X, when an error occurs (like device being unplugged), not all
+	// transfers return with the expected error code, but only one, the rest returns
+	// LIBUSB_TRANSFER_CANCELLED, which we only expect on actual user cancel actions.
+	// To track this, we count the transfers that did fail with any other error code,
+	// and use that information to determine if the shutdown was intentional by the
+	// user or not. If not, at least one transfer would fail with a non-cancel error.
+	if (transfer->status != LIBUSB_TRANSFER_CANCELLED) {
+		// This also captures COMPLETED but with re-submit failure.
+		state->failedDataTransfers++;
+	}
+
+	// Transfers are handled sequentially always in the same thread, so these
+	// reads here are correct.
+	if ((atomic_load(&state->activeDataTransfers) == 1) && (state->failedDataTransfers > 0)) {
+		// Ensure run is set to false on exceptional shut-down.
+		atomic_store(&state->dataTransfersRun, TRANS_STOPPED);
+
+		// We make sure to first set 'dataTransfersRun' to false on exceptional
+		// shut-down, before doing the subtraction, so that anyone waiting on
+		// 'activeDataTransfers' to become zero, will see RUN changed to false too.
+		atomic_store(&state->activeDataTransfers, 0);
+
+		// Call exceptional shut-down callback,
+		if (state->usbShutdownCallback != NULL) {
+			state->usbShutdownCallback(state->usbShutdownCallbackPtr);
+		}
+	}
+	else {
+		// Normal shutdown/count-down.
+		atomic_fetch_sub(&state->activeDataTransfers, 1);
+	}
+
+	// Clear error tracking counter on last exit.
+	if ((atomic_load(&state->activeDataTransfers) == 0) && (state->failedDataTransfers > 0)) {
+		state->failedDataTransfers = 0;
+	}
+}
+
+static bool usbControlTransferAsync(usbState state, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint8_t *data,
+	size_t dataSize, void (*controlOutCallback)(void *controlOutCallbackPtr, int status),
+	void (*controlInCallback)(void *controlInCallbackPtr, int status, const uint8_t *buffer, size_t bufferSize),
+	void *controlCallbackPtr, bool directionOut) {
+	// Replay has no device to talk to.
+	if (state->deviceHandle == NULL) {
+		return (false);
+	}
+
+	// If doing IN, data must always be NULL, the callback will handle it.
+	if ((!directionOut) && (data != NULL)) {
+		return (false);
+	}
+
+	// If doing OUT and data is NULL (no data), dataSize must be zero!
+	if (directionOut && (data == NULL) && (dataSize != 0)) {
+		return (false);
+	}
+
+	struct libusb_transfer *controlTransfer = libusb_alloc_transfer(0);
+	if (controlTransfer == NULL) {
+		return (false);
+	}
+
+	// Create data buffer.
+	uint8_t *controlTransferBuffer
+		= calloc(1, (LIBUSB_CONTROL_SETUP_SIZE + dataSize + sizeof(struct usb_control_struct)));
+	if (controlTransferBuffer == NULL) {
+		caerUSBLog(
+			CAER_LOG_CRITICAL, state, "Unable to allocate buffer for libusb control transfer. Error: %d.", errno);
+
+		libusb_free_transfer(controlTransfer);
+
+		return (false);
+	}
+
+	// Put additional data in the unused part of the transfer buffer, this way
+	// all memory is in one block and freed when the transfer is freed.
+	usbControl extraControlData = (usbControl) &controlTransferBuffer[LIBUSB_CONTROL_SETUP_SIZE + dataSize];
+
+	if (controlOutCallback != NULL) {
+		extraControlData->controlOutCallback = controlOutCallback;
 	}
 	if (controlInCallback != NULL) {
 		extraControlData->controlInCallback = controlInCallback;
@@ -1245,5 +2788,9 @@ static void syncControlInCallback(void *controlInCallbackPtr, int status, const
 }
 
 bool usbControlResetDataEndpoint(usbState state, uint8_t endpoint) {
+	if (state->deviceHandle == NULL) {
+		return (false);
+	}
+
 	return (libusb_clear_halt(state->deviceHandle, endpoint) == LIBUSB_SUCCESS);
 }
@@ -5,11 +5,15 @@
 
 #include "libcaer/devices/device_discover.h"
 #include "libcaer/devices/usb.h"
+#include "libcaer/events/raw.h"
+#include "libcaer/ringbuffer.h"
 
 #include "c11threads_posix.h"
+#include "data_statistics.h"
 
 #include <libusb.h>
 #include <stdatomic.h>
+#include <stdio.h>
 
 #define MAX_SERIAL_NUMBER_LENGTH 8
 
@@ -22,6 +26,31 @@
 
 #define USB_INFO_STRING_SIZE 64
 
+#define USB_RECORD_MAGIC       "CAERRAW"
+#define USB_RECORD_VERSION     2
+#define USB_RECORD_FIELDS      128
+#define USB_RECORD_HEADER_SIZE 16
+#define USB_RECORD_ENTRY_SIZE  16
+
+// Room for this many times the USB buffers in flight, minimum 16. The queue is
+// sized for the larger of their number at start and USB_AUTO_TUNE_NUMBER_MAX,
+// as auto-tuning may raise it while running.
+#define USB_DECODE_QUEUE_BUFFERS_FACTOR 4
+
+// USB buffers the recording writer thread can fall behind by (power of two).
+#define USB_RECORD_QUEUE_SIZE 256
+
+#define USB_EVENT_TIMEOUT_DEFAULT 10000
+
+// Buffer auto-tuning: statistics window, decisions in a row needed for
+// a change, and limits for the buffers' number and size.
+#define USB_AUTO_TUNE_WINDOW_US  1000000
+#define USB_AUTO_TUNE_VOTES      3
+#define USB_AUTO_TUNE_NUMBER_MIN 2
+#define USB_AUTO_TUNE_NUMBER_MAX 64
+#define USB_AUTO_TUNE_SIZE_MIN   1024
+#define USB_AUTO_TUNE_SIZE_MAX   262144
+
 enum { TRANS_STOPPED = 0, TRANS_RUNNING = 1 };
 
 struct usb_state {
@@ -34,6 +63,9 @@ struct usb_state {
 	char usbThreadName[MAX_THREAD_NAME_LENGTH + 1]; // +1 for terminating NUL character.
 	thrd_t usbThread;
 	atomic_bool usbThreadRun;
+	atomic_uint_fast32_t usbThreadCpuAffinity;
+	atomic_uint_fast32_t usbThreadRealTimePriority;
+	atomic_uint_fast32_t usbEventTimeout;
 	// USB Data Transfers
 	atomic_uint_fast32_t usbBufferNumber;
 	atomic_uint_fast32_t usbBufferSize;
@@ -44,16 +76,143 @@ struct usb_state {
 	uint32_t dataTransfersLength;           // LOCK PROTECTED.
 	atomic_uint_fast32_t activeDataTransfers;
 	uint32_t failedDataTransfers;
+	bool dataReceived; // Data arrived during the current event handling round, only accessed by the USB thread.
+	// USB Data Transfers completion coalescing (only accessed by the USB thread)
+	atomic_bool completionCoalescing;
+	struct libusb_transfer **completedTransfers; // Allocated with 'dataTransfers', same length.
+	size_t completedTransfersNumber;
+	// USB Data Transfers auto-tuning (window statistics only accessed by the USB thread)
+	atomic_bool autoTune;
+	struct timespec autoTuneWindowStart;
+	uint32_t autoTuneTransfers;
+	uint32_t autoTuneFullTransfers;
+	uint64_t autoTuneBytes;
+	int32_t autoTuneVotes;
 	// USB Data Transfers handling callback
 	void (*usbDataCallback)(void *usbDataCallbackPtr, const uint8_t *buffer, size_t bytesSent);
 	void *usbDataCallbackPtr;
+	// USB Data Transfers raw data pass-through (buffers are RAW_DATA_EVENT packets)
+	caerEventPacketHeader (*usbRawDataCallback)(
+		void *usbRawDataCallbackPtr, caerEventPacketHeader packet, int32_t capacity);
+	void *usbRawDataCallbackPtr;
+	atomic_bool rawData; // Only takes effect on usbDataTransfersStart() calls!
+	bool rawDataActive;
+	// Decode thread (translation decoupled from USB event handling)
+	atomic_bool decodeThreadEnabled; // Only takes effect on usbDataTransfersStart() calls!
+	bool decodeThreadActive;
+	thrd_t decodeThread;
+	atomic_bool decodeThreadRun;
+	caerRingBuffer decodeQueue;     // USB to decode thread, filled buffers.
+	caerRingBuffer decodeFreeQueue; // Decode to USB thread, buffers given back for reuse.
+	atomic_uint_fast32_t decodeQueueDepth;
+	atomic_uint_fast32_t decodeQueueDepthMax;
+	atomic_uint_fast32_t decodeQueueDropped;
+	mtx_t decodeWaitLock;
+	cnd_t decodeWaitCond;
+	atomic_bool decodeWaiting;
+	bool decodeQueueBlocking; // Wait for space in a full queue, instead of dropping data.
+	mtx_t decodeSpaceWaitLock;
+	cnd_t decodeSpaceWaitCond;
+	atomic_bool decodeSpaceWaiting;
 	// USB Data Transfers shutdown callback
 	void (*usbShutdownCallback)(void *usbShutdownCallbackPtr);
 	void *usbShutdownCallbackPtr;
+	// USB Data Transfers statistics
+	dataStatistics statistics;
+	// Raw data recording (armed before data transfers start)
+	FILE *recordFile;
+	struct timespec recordStartTime;
+	// Recording writer thread (file writes decoupled from USB event handling)
+	bool recordThreadActive;
+	thrd_t recordThread;
+	atomic_bool recordThreadRun;
+	atomic_bool recordActive;       // Cleared when the recording fails, stops queueing data.
+	caerRingBuffer recordQueue;     // USB to writer thread, filled buffers.
+	caerRingBuffer recordFreeQueue; // Writer to USB thread, empty buffers for reuse.
+	mtx_t recordWaitLock;
+	cnd_t recordWaitCond;
+	atomic_bool recordWaiting;
+	// Raw data replay (offline device, no USB)
+	FILE *replayFile;
+	long replayDataOffset;
+	bool replayMaxSpeed;
+	bool replayThreadStarted;
+	thrd_t replayThread;
 };
 
 typedef struct usb_state *usbState;
 
+// With a decode thread, transfer buffers are the data of these, so that
+// they can be queued with their length and given back for reuse.
+struct usb_decode_buffer {
+	size_t capacity;
+	size_t length;
+	uint8_t data[];
+};
+
+typedef struct usb_decode_buffer *usbDecodeBuffer;
+
+// Copy of a USB data transfer, queued for the recording writer thread.
+struct usb_record_buffer {
+	uint64_t timestamp;
+	size_t capacity;
+	size_t length;
+	uint8_t data[];
+};
+
+typedef struct usb_record_buffer *usbRecordBuffer;
+
+// Raw recording file layout: header, the device state fields, and then one
+// entry per USB data transfer, each followed by its data. Everything is written
+// explicitly, field by field, at a fixed width, little-endian and without any
+// padding, so that recordings can be replayed on any architecture and build.
+struct usb_record_header {
+	char magic[8];
+	uint32_t version;
+	uint16_t deviceType;
+	uint16_t fieldsNumber;
+};
+
+struct usb_record_entry {
+	uint64_t timestamp; // in µs, since data transfers were started.
+	uint32_t length;
+	uint32_t reserved;
+};
+
+/**
+ * Type of a device state field, which determines how it is stored: as one byte
+ * for booleans and uint8, as two, four or eight bytes for the wider integers,
+ * enums are stored as int32, floats as their IEEE-754 bits, and strings (char
+ * arrays) as their uint16 length followed by their content, without the NUL.
+ * Each field is preceded by its type, to detect state layout changes.
+ */
+enum usb_record_field_type {
+	USB_RECORD_BOOL         = 0,
+	USB_RECORD_UINT8        = 1,
+	USB_RECORD_ATOMIC_UINT8 = 2,
+	USB_RECORD_INT16        = 3,
+	USB_RECORD_UINT16       = 4,
+	USB_RECORD_INT32        = 5,
+	USB_RECORD_INT64        = 6,
+	USB_RECORD_ENUM         = 7,
+	USB_RECORD_FLOAT        = 8,
+	USB_RECORD_STRING       = 9,
+};
+
+/**
+ * Part of the device state that is needed to translate the raw data,
+ * saved in the header of raw recordings and restored on replay.
+ * Pointers, such as the device string, are never saved: replay builds its own.
+ */
+struct usb_record_field {
+	void *data;
+	size_t size;
+	enum usb_record_field_type type;
+};
+
+#define USB_RECORD_FIELD(member, fieldType)                                                     \
+	((struct usb_record_field){.data = &(member), .size = sizeof(member), .type = (fieldType)})
+
 struct usb_info {
 	uint8_t busNumber;
 	uint8_t devAddress;
@@ -81,14 +240,58 @@ void usbSetThreadName(usbState state, const char *threadName);
 void usbSetDataCallback(usbState state,
 	void (*usbDataCallback)(void *usbDataCallbackPtr, const uint8_t *buffer, size_t bytesSent),
 	void *usbDataCallbackPtr);
+void usbSetRawDataCallback(usbState state,
+	caerEventPacketHeader (*usbRawDataCallback)(
+		void *usbRawDataCallbackPtr, caerEventPacketHeader packet, int32_t capacity),
+	void *usbRawDataCallbackPtr);
 void usbSetShutdownCallback(
 	usbState state, void (*usbShutdownCallback)(void *usbShutdownCallbackPtr), void *usbShutdownCallbackPtr);
+void usbSetStatistics(usbState state, dataStatistics statistics);
 void usbSetDataEndpoint(usbState state, uint8_t dataEndPoint);
+void usbSetDecodeQueueBlocking(usbState state, bool decodeQueueBlocking);
 void usbSetTransfersNumber(usbState state, uint32_t transfersNumber);
 void usbSetTransfersSize(usbState state, uint32_t transfersSize);
 uint32_t usbGetTransfersNumber(usbState state);
 uint32_t usbGetTransfersSize(usbState state);
 
+bool usbRecordStart(usbState state, const char *filePath, uint16_t deviceType, const struct usb_record_field *fields,
+	size_t fieldsNumber);
+bool usbRecordEntryWrite(FILE *recordFile, uint64_t timestamp, const uint8_t *buffer, size_t bufferSize);
+int32_t usbReplayDeviceType(const char *filePath);
+bool usbReplayOpen(usbState state, const char *filePath, bool maxSpeed, uint16_t deviceType,
+	const struct usb_record_field *fields, size_t fieldsNumber);
+
+static inline bool usbIsReplay(usbState state) {
+	return (state->replayFile != NULL);
+}
+
+/**
+ * Raw data pass-through is in use for the next data transfers start,
+ * only possible if the device supports it by setting a raw data callback.
+ */
+static inline bool usbRawDataIsEnabled(usbState state) {
+	return (atomic_load(&state->rawData) && (state->usbRawDataCallback != NULL));
+}
+
+/**
+ * With raw data pass-through, the transfer buffers are the data of
+ * RAW_DATA_EVENT packets, right after their header.
+ */
+static inline uint8_t *usbRawDataBuffer(caerEventPacketHeader packet) {
+	return ((packet == NULL) ? (NULL) : (((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE));
+}
+
+static inline caerEventPacketHeader usbRawDataPacket(uint8_t *buffer) {
+	return ((buffer == NULL) ? (NULL) : ((caerEventPacketHeader) (buffer - CAER_EVENT_PACKET_HEADER_SIZE)));
+}
+
+/**
+ * With a decode thread, the transfer buffers are the data of decode buffers.
+ */
+static inline usbDecodeBuffer usbDecodeBufferFromData(uint8_t *data) {
+	return ((data == NULL) ? (NULL) : ((usbDecodeBuffer) (data - offsetof(struct usb_decode_buffer, data))));
+}
+
 static inline bool usbConfigSet(usbState state, uint8_t paramAddr, uint32_t param) {
 	switch (paramAddr) {
 		case CAER_HOST_CONFIG_USB_BUFFER_NUMBER:
@@ -99,6 +302,34 @@ static inline bool usbConfigSet(usbState state, uint8_t paramAddr, uint32_t para
 			usbSetTransfersSize(state, param);
 			break;
 
+		case CAER_HOST_CONFIG_USB_RAW_DATA:
+			atomic_store(&state->rawData, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_DECODE_THREAD:
+			atomic_store(&state->decodeThreadEnabled, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_THREAD_CPU_AFFINITY:
+			atomic_store(&state->usbThreadCpuAffinity, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_THREAD_REALTIME_PRIORITY:
+			atomic_store(&state->usbThreadRealTimePriority, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_EVENT_TIMEOUT:
+			atomic_store(&state->usbEventTimeout, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_COMPLETION_COALESCING:
+			atomic_store(&state->completionCoalescing, param);
+			break;
+
+		case CAER_HOST_CONFIG_USB_BUFFER_AUTO_TUNE:
+			atomic_store(&state->autoTune, param);
+			break;
+
 		default:
 			return (false);
 			break;
@@ -117,6 +348,46 @@ static inline bool usbConfigGet(usbState state, uint8_t paramAddr, uint32_t *par
 			*param = usbGetTransfersSize(state);
 			break;
 
+		case CAER_HOST_CONFIG_USB_RAW_DATA:
+			*param = atomic_load(&state->rawData);
+			break;
+
+		case CAER_HOST_CONFIG_USB_DECODE_THREAD:
+			*param = atomic_load(&state->decodeThreadEnabled);
+			break;
+
+		case CAER_HOST_CONFIG_USB_DECODE_QUEUE_DEPTH:
+			*param = U32T(atomic_load_explicit(&state->decodeQueueDepth, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_USB_DECODE_QUEUE_DEPTH_MAX:
+			*param = U32T(atomic_load_explicit(&state->decodeQueueDepthMax, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_USB_DECODE_QUEUE_DROPPED:
+			*param = U32T(atomic_load_explicit(&state->decodeQueueDropped, memory_order_relaxed));
+			break;
+
+		case CAER_HOST_CONFIG_USB_THREAD_CPU_AFFINITY:
+			*param = U32T(atomic_load(&state->usbThreadCpuAffinity));
+			break;
+
+		case CAER_HOST_CONFIG_USB_THREAD_REALTIME_PRIORITY:
+			*param = U32T(atomic_load(&state->usbThreadRealTimePriority));
+			break;
+
+		case CAER_HOST_CONFIG_USB_EVENT_TIMEOUT:
+			*param = U32T(atomic_load(&state->usbEventTimeout));
+			break;
+
+		case CAER_HOST_CONFIG_USB_COMPLETION_COALESCING:
+			*param = atomic_load(&state->completionCoalescing);
+			break;
+
+		case CAER_HOST_CONFIG_USB_BUFFER_AUTO_TUNE:
+			*param = atomic_load(&state->autoTune);
+			break;
+
 		default:
 			return (false);
 			break;